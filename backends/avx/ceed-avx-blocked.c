@@ -25,8 +25,14 @@
 //------------------------------------------------------------------------------
 static int CeedInit_Avx(const char *resource, Ceed ceed) {
   int ierr;
-  if (strcmp(resource, "/cpu/self") && strcmp(resource, "/cpu/self/avx") &&
-      strcmp(resource, "/cpu/self/avx/blocked"))
+  char *resource_root;
+  ierr = CeedGetResourceRoot(ceed, resource, ":", &resource_root);
+  CeedChkBackend(ierr);
+  const bool is_valid = !strcmp(resource_root, "/cpu/self") ||
+                        !strcmp(resource_root, "/cpu/self/avx") ||
+                        !strcmp(resource_root, "/cpu/self/avx/blocked");
+  ierr = CeedFree(&resource_root); CeedChkBackend(ierr);
+  if (!is_valid)
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_BACKEND,
                      "AVX backend cannot use resource: %s", resource);
@@ -48,6 +54,11 @@ static int CeedInit_Avx(const char *resource, Ceed ceed) {
                                   CeedTensorContractCreate_f32_Avx);
     CeedChkBackend(ierr);
   }
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ElemRestrictionCreate",
+                                CeedElemRestrictionCreate_Avx); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed,
+                                "ElemRestrictionCreateBlocked",
+                                CeedElemRestrictionCreate_Avx); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
@@ -25,8 +25,13 @@
 //------------------------------------------------------------------------------
 static int CeedInit_Avx(const char *resource, Ceed ceed) {
   int ierr;
-  if (strcmp(resource, "/cpu/self")
-      && strcmp(resource, "/cpu/self/avx/serial"))
+  char *resource_root;
+  ierr = CeedGetResourceRoot(ceed, resource, ":", &resource_root);
+  CeedChkBackend(ierr);
+  const bool is_valid = !strcmp(resource_root, "/cpu/self") ||
+                        !strcmp(resource_root, "/cpu/self/avx/serial");
+  ierr = CeedFree(&resource_root); CeedChkBackend(ierr);
+  if (!is_valid)
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_BACKEND,
                      "AVX backend cannot use resource: %s", resource);
@@ -48,6 +53,11 @@ static int CeedInit_Avx(const char *resource, Ceed ceed) {
                                   CeedTensorContractCreate_f32_Avx);
     CeedChkBackend(ierr);
   }
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ElemRestrictionCreate",
+                                CeedElemRestrictionCreate_Avx); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed,
+                                "ElemRestrictionCreateBlocked",
+                                CeedElemRestrictionCreate_Avx); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
@@ -238,6 +238,103 @@ static inline int CeedTensorContract_Avx_Single(CeedTensorContract contract,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Blocked Even-Odd Tensor Contract
+//   Rows b and B-1-b of u are folded in registers into u_e = u_b + sign*u_r and
+//   u_o = u_b - sign*u_r, then each half row j of the folded matrix gives
+//   v_e = t_e u_e and v_o = t_o u_o for CC columns, unfolded into the rows
+//   v_j = v_e + v_o and v_{J-1-j} = sign*(v_e - v_o),
+//   see CeedTensorContractFoldEvenOdd()
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx_EvenOdd(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    CeedInt parity, CeedTransposeMode t_mode, const double *restrict u,
+    double *restrict v, const CeedInt JJ, const CeedInt CC) {
+  const bool is_transpose = t_mode == CEED_TRANSPOSE;
+  // For the transpose, the middle entry of u with odd B has even and odd parts
+  //   and the middle entry of v with odd J only an even part
+  const CeedInt B_lo = B/2, J_lo = J/2, B_even = (B+1)/2, J_even = (J+1)/2,
+                B_odd = is_transpose ? B_even : B_lo,
+                J_odd = is_transpose ? J_lo : J_even;
+  const double sign_u = is_transpose ? parity : 1,
+               sign_v = is_transpose ? 1 : parity;
+  const double *t_even = t, *t_odd = t + B_even*J_even;
+  CeedInt t_even_stride_0 = B_even, t_even_stride_1 = 1,
+          t_odd_stride_0 = B_odd, t_odd_stride_1 = 1;
+  if (is_transpose) {
+    t_even_stride_0 = 1; t_even_stride_1 = J_even;
+    t_odd_stride_0 = 1; t_odd_stride_1 = J_odd;
+  }
+
+  // Coefficients in blocks of JJ half rows, zero past the folded matrix
+  const CeedInt J_pad = ((J_even+JJ-1)/JJ)*JJ;
+  double t_even_blk[J_pad*B_even], t_odd_blk[J_pad*B_even];
+  for (CeedInt j=0; j<J_pad; j++)
+    for (CeedInt b=0; b<B_even; b++) {
+      const CeedInt k = ((j/JJ)*B_even + b)*JJ + j%JJ;
+      t_even_blk[k] = j < J_even ?
+                      t_even[j*t_even_stride_0 + b*t_even_stride_1] : 0.0;
+      t_odd_blk[k] = j < J_odd && b < B_odd ?
+                     t_odd[j*t_odd_stride_0 + b*t_odd_stride_1] : 0.0;
+    }
+
+  const __m256d s_u = _mm256_set1_pd(sign_u);
+  for (CeedInt a=0; a<A; a++)
+    // Blocks of JJ half rows
+    for (CeedInt j=0; j<J_even; j+=JJ) {
+      const double *t_e_blk = &t_even_blk[j*B_even],
+                    *t_o_blk = &t_odd_blk[j*B_even];
+      for (CeedInt c=0; c<C; c+=CC) {
+        // Output tile to be held in registers
+        __m256d v_even[JJ][CC/4], v_odd[JJ][CC/4];
+        for (CeedInt jj=0; jj<JJ; jj++)
+          for (CeedInt cc=0; cc<CC/4; cc++) {
+            v_even[jj][cc] = _mm256_setzero_pd();
+            v_odd[jj][cc] = _mm256_setzero_pd();
+          }
+
+        for (CeedInt b=0; b<B_even; b++) {
+          // The middle row of odd B is its own mirror image
+          const bool is_mid = b == B_lo;
+          __m256d u_e[CC/4], u_o[CC/4];
+          for (CeedInt cc=0; cc<CC/4; cc++) { // unroll
+            const __m256d u_l = _mm256_loadu_pd(&u[(a*B+b)*C+c+cc*4]);
+            if (is_mid) {
+              u_e[cc] = u_l;
+              u_o[cc] = u_l;
+            } else {
+              const __m256d u_r = _mm256_loadu_pd(&u[(a*B+B-1-b)*C+c+cc*4]);
+              u_e[cc] = _mm256_add_pd(u_l, _mm256_mul_pd(s_u, u_r));
+              u_o[cc] = _mm256_sub_pd(u_l, _mm256_mul_pd(s_u, u_r));
+            }
+          }
+          for (CeedInt jj=0; jj<JJ; jj++) { // unroll
+            const __m256d t_e = _mm256_set1_pd(t_e_blk[b*JJ+jj]),
+                          t_o = _mm256_set1_pd(t_o_blk[b*JJ+jj]);
+            for (CeedInt cc=0; cc<CC/4; cc++) { // unroll
+              fmadd(v_even[jj][cc], t_e, u_e[cc]);
+              fmadd(v_odd[jj][cc], t_o, u_o[cc]);
+            }
+          }
+        }
+        // Unfold, the middle row of odd J is written once
+        for (CeedInt jj=0; jj<JJ && j+jj<J_even; jj++) {
+          const __m256d s_v = _mm256_set1_pd(j+jj < J_lo ? sign_v : 0.0);
+          for (CeedInt cc=0; cc<CC/4; cc++) {
+            double *v_l = &v[(a*J+j+jj)*C+c+cc*4],
+                    *v_r = &v[(a*J+J-1-j-jj)*C+c+cc*4];
+            __m256d v_sum = _mm256_add_pd(v_even[jj][cc], v_odd[jj][cc]),
+                    v_diff = _mm256_sub_pd(v_even[jj][cc], v_odd[jj][cc]);
+            _mm256_storeu_pd(v_r, _mm256_add_pd(_mm256_loadu_pd(v_r),
+                                                _mm256_mul_pd(s_v, v_diff)));
+            _mm256_storeu_pd(v_l, _mm256_add_pd(_mm256_loadu_pd(v_l), v_sum));
+          }
+        }
+      }
+    }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract - Common Sizes
 //------------------------------------------------------------------------------
@@ -297,6 +394,30 @@ static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Even-Odd
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyEvenOdd_Avx(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    const double *restrict t_even_odd, CeedInt parity,
+    CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
+    double *restrict v) {
+  const CeedInt blk_size = 8;
+
+  // Columns not in blocks of 8 use the full matrix
+  if (C % blk_size)
+    return CeedTensorContractApply_Avx(contract, A, B, C, J, t, t_mode, add, u,
+                                       v);
+
+  if (!add)
+    for (CeedInt q=0; q<A*J*C; q++)
+      v[q] = (double) 0.0;
+
+  CeedTensorContract_Avx_EvenOdd(contract, A, B, C, J, t_even_odd, parity,
+                                 t_mode, u, v, 2, blk_size);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
@@ -308,6 +429,9 @@ int CeedTensorContractCreate_f64_Avx(CeedBasis basis,
 
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
                                 CeedTensorContractApply_Avx); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract,
+                                "ApplyEvenOdd", CeedTensorContractApplyEvenOdd_Avx);
+  CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
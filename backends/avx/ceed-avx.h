@@ -25,4 +25,7 @@ CEED_INTERN int CeedTensorContractCreate_f32_Avx(CeedBasis basis,
 CEED_INTERN int CeedTensorContractCreate_f64_Avx(CeedBasis basis,
     CeedTensorContract contract);
 
+CEED_INTERN int CeedElemRestrictionCreate_Avx(CeedMemType mem_type,
+    CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction r);
+
 #endif // _ceed_avx_h
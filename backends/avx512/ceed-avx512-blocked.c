@@ -0,0 +1,78 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ceed-avx512.h"
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Avx512(const char *resource, Ceed ceed) {
+  int ierr;
+  char *resource_root;
+  ierr = CeedGetResourceRoot(ceed, resource, ":", &resource_root);
+  CeedChkBackend(ierr);
+  const bool is_valid = !strcmp(resource_root, "/cpu/self") ||
+                        !strcmp(resource_root, "/cpu/self/avx512") ||
+                        !strcmp(resource_root, "/cpu/self/avx512/blocked");
+  ierr = CeedFree(&resource_root); CeedChkBackend(ierr);
+  if (!is_valid)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND,
+                     "AVX-512 backend cannot use resource: %s", resource);
+  // LCOV_EXCL_STOP
+  if (!CeedCpuHasAvx512())
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "AVX-512 backend requires a CPU with AVX-512F");
+  // LCOV_EXCL_STOP
+  ierr = CeedSetDeterministic(ceed, true); CeedChkBackend(ierr);
+
+  // Create reference CEED that implementation will be dispatched
+  //   through unless overridden
+  Ceed ceed_ref;
+  CeedInit("/cpu/self/opt/blocked", &ceed_ref);
+  ierr = CeedSetDelegate(ceed, ceed_ref); CeedChkBackend(ierr);
+
+  if (CEED_SCALAR_TYPE == CEED_SCALAR_FP64) {
+    ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
+                                  CeedTensorContractCreate_f64_Avx512);
+    CeedChkBackend(ierr);
+  } else {
+    ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
+                                  CeedTensorContractCreate_f32_Avx512);
+    CeedChkBackend(ierr);
+  }
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ElemRestrictionCreate",
+                                CeedElemRestrictionCreate_Avx512); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed,
+                                "ElemRestrictionCreateBlocked",
+                                CeedElemRestrictionCreate_Avx512); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Avx512_Blocked(void) {
+  return CeedRegister("/cpu/self/avx512/blocked", CeedInit_Avx512,
+                      CeedCpuHasAvx512() ? 28 : CEED_MAX_BACKEND_PRIORITY);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,241 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include <immintrin.h>
+#include <stdbool.h>
+#include "ceed-avx512.h"
+#include "../ref/ceed-ref.h"
+
+// Gathers run this many vectors of offsets ahead of their L-vector prefetches
+#define CEED_AVX512_PREFETCH_DIST 2
+
+//------------------------------------------------------------------------------
+// Core ElemRestriction Apply Code, offsets without orientation
+//------------------------------------------------------------------------------
+static inline int CeedElemRestrictionApply_Avx512_Core(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
+  const CeedInt *offsets = impl->offsets;
+  const double *uu;
+  double *vv;
+  CeedInt num_elem, elem_size, v_offset;
+  ierr = CeedElemRestrictionGetNumElements(r, &num_elem); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
+  v_offset = start*blk_size*elem_size*num_comp;
+  const CeedInt blk_len = elem_size*blk_size, vec_len = blk_len - blk_len%8,
+                pf_dist = 8*CEED_AVX512_PREFETCH_DIST;
+
+  // Kernels are only set for double precision, the casts only satisfy the
+  //   compiler for other scalar types
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, (const CeedScalar **)&uu);
+  CeedChkBackend(ierr);
+  if (t_mode == CEED_NOTRANSPOSE) {
+    // Restriction from L-vector to E-vector
+    // vv has shape [elem_size, num_comp, num_elem], row-major
+    // uu has shape [nnodes, num_comp]
+    ierr = CeedVectorGetArrayWrite(v, CEED_MEM_HOST, (CeedScalar **)&vv);
+    CeedChkBackend(ierr);
+    const CeedInt *offsets_stop = &offsets[stop*blk_len];
+    for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size) {
+      const CeedInt *offsets_e = &offsets[e*elem_size];
+      double *vv_e = &vv[elem_size*num_comp*e - v_offset];
+      // Each vector of offsets is loaded once and gathers all components
+      for (CeedInt i = 0; i < vec_len; i+=8) {
+        const __m256i ind = _mm256_loadu_si256((const __m256i *)&offsets_e[i]);
+        if (&offsets_e[i + pf_dist] < offsets_stop)
+          _mm_prefetch((const char *)&uu[offsets_e[i + pf_dist]], _MM_HINT_T0);
+        for (CeedInt k = 0; k < num_comp; k++)
+          _mm512_storeu_pd(&vv_e[k*blk_len + i],
+                           _mm512_i32gather_pd(ind, &uu[k*comp_stride], 8));
+      }
+      for (CeedInt i = vec_len; i < blk_len; i++)
+        for (CeedInt k = 0; k < num_comp; k++)
+          vv_e[k*blk_len + i] = uu[offsets_e[i] + k*comp_stride];
+    }
+  } else {
+    // Restriction from E-vector to L-vector
+    // Performing v += r^T * u
+    // uu has shape [elem_size, num_comp, num_elem]
+    // vv has shape [nnodes, num_comp]
+    ierr = CeedVectorGetArray(v, CEED_MEM_HOST, (CeedScalar **)&vv);
+    CeedChkBackend(ierr);
+    for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+      for (CeedInt k = 0; k < num_comp; k++)
+        for (CeedInt i = 0; i < blk_len; i+=blk_size)
+          // Iteration bound set to discard padding elements
+          for (CeedInt j = i; j < i+CeedIntMin(blk_size, num_elem-e); j++)
+            vv[offsets[j+e*elem_size] + k*comp_stride]
+            += uu[elem_size*(k*blk_size+num_comp*e) + j - v_offset];
+  }
+  ierr = CeedVectorRestoreArrayRead(u, (const CeedScalar **)&uu);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(v, (CeedScalar **)&vv); CeedChkBackend(ierr);
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply - Common Sizes
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApply_Avx512_1(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Avx512_Core(r, 1, blk_size, comp_stride,
+         start, stop, t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Avx512_3(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Avx512_Core(r, 3, blk_size, comp_stride,
+         start, stop, t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Avx512_4(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Avx512_Core(r, 4, blk_size, comp_stride,
+         start, stop, t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Avx512_5(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Avx512_Core(r, 5, blk_size, comp_stride,
+         start, stop, t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Avx512_9(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Avx512_Core(r, 9, blk_size, comp_stride,
+         start, stop, t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Avx512(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Avx512_Core(r, num_comp, blk_size,
+         comp_stride, start, stop, t_mode, u, v, request);
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Transpose Sum of the E-vector Entries Owned by Each Node
+//   Eight nodes are reduced at a time, lanes of nodes with fewer entries are
+//   masked off; each node sums its entries in the same order as the
+//   reference backend
+//------------------------------------------------------------------------------
+static void CeedElemRestrictionTransposeSum_Avx512(const CeedInt *t_offsets,
+    const CeedInt *t_indices, const CeedScalar *u, CeedInt start, CeedInt stop,
+    bool is_assign, CeedScalar *v) {
+  const double *uu = (const double *)u;
+  double *vv = (double *)v;
+  CeedInt n = start;
+
+  for (; n + 8 <= stop; n+=8) {
+    const __m256i first = _mm256_loadu_si256((const __m256i *)&t_offsets[n]),
+                  last = _mm256_loadu_si256((const __m256i *)&t_offsets[n+1]),
+                  count = _mm256_sub_epi32(last, first);
+    CeedInt max_count = 0;
+    for (CeedInt l = 0; l < 8; l++)
+      max_count = CeedIntMax(max_count, t_offsets[n+l+1] - t_offsets[n+l]);
+    __m512d sum = _mm512_setzero_pd();
+    for (CeedInt q = 0; q < max_count; q++) {
+      const __m256i q_vec = _mm256_set1_epi32(q),
+                    mask = _mm256_cmpgt_epi32(count, q_vec),
+                    ind = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                          t_indices, _mm256_add_epi32(first, q_vec), mask, 4);
+      const __mmask8 mask_pd = _mm256_movemask_ps(_mm256_castsi256_ps(mask));
+      sum = _mm512_add_pd(sum, _mm512_mask_i32gather_pd(_mm512_setzero_pd(),
+                          mask_pd, ind, uu, 8));
+    }
+    if (is_assign)
+      _mm512_storeu_pd(&vv[n], sum);
+    else
+      _mm512_storeu_pd(&vv[n], _mm512_add_pd(_mm512_loadu_pd(&vv[n]), sum));
+  }
+  for (; n < stop; n++) {
+    double sum = 0.;
+    for (CeedInt q = t_offsets[n]; q < t_offsets[n+1]; q++)
+      sum += uu[t_indices[q]];
+    if (is_assign)
+      vv[n] = sum;
+    else
+      vv[n] += sum;
+  }
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Create
+//------------------------------------------------------------------------------
+int CeedElemRestrictionCreate_Avx512(CeedMemType mem_type,
+                                     CeedCopyMode copy_mode,
+                                     const CeedInt *offsets,
+                                     CeedElemRestriction r) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  CeedInt num_comp;
+
+  // Storage, transpose map, and strided and compressed offset kernels are
+  //   shared with the reference backend
+  ierr = CeedElemRestrictionCreate_Ref(mem_type, copy_mode, offsets, r);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
+  if (CEED_SCALAR_TYPE != CEED_SCALAR_FP64 || !impl->offsets ||
+      impl->elem_bases)
+    return CEED_ERROR_SUCCESS;
+  impl->TransposeSum = CeedElemRestrictionTransposeSum_Avx512;
+
+  // Set apply function based upon num_comp
+  ierr = CeedElemRestrictionGetNumComponents(r, &num_comp);
+  CeedChkBackend(ierr);
+  switch (num_comp) {
+  case 1:
+    impl->Apply = CeedElemRestrictionApply_Avx512_1;
+    break;
+  case 3:
+    impl->Apply = CeedElemRestrictionApply_Avx512_3;
+    break;
+  case 4:
+    impl->Apply = CeedElemRestrictionApply_Avx512_4;
+    break;
+  case 5:
+    impl->Apply = CeedElemRestrictionApply_Avx512_5;
+    break;
+  case 9:
+    impl->Apply = CeedElemRestrictionApply_Avx512_9;
+    break;
+  default:
+    impl->Apply = CeedElemRestrictionApply_Avx512;
+    break;
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,289 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include <immintrin.h>
+#include <stdbool.h>
+#include "ceed-avx512.h"
+
+// c += a * b
+#define fmadd(c,a,b) (c) = _mm512_fmadd_ps((a), (b), (c))
+
+// Lanes per register
+#define CEED_AVX512_LANES_F32 16
+
+//------------------------------------------------------------------------------
+// Mask of the first n lanes, none if n is not positive
+//------------------------------------------------------------------------------
+static inline __mmask16 CeedMask_Avx512_f32(CeedInt n) {
+  return n >= CEED_AVX512_LANES_F32 ? (__mmask16)0xFFFF :
+         (n > 0 ? (__mmask16)((1u << n) - 1) : (__mmask16)0);
+}
+
+//------------------------------------------------------------------------------
+// Load lanes of t with a given stride, gathering unless contiguous
+//------------------------------------------------------------------------------
+static inline __m512 CeedLoadStrided_Avx512_f32(const float *t,
+    CeedInt stride, __m512i idx, __mmask16 mask) {
+  if (stride == 1)
+    return _mm512_maskz_loadu_ps(mask, t);
+  return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, idx, t,
+                                  sizeof(float));
+}
+
+//------------------------------------------------------------------------------
+// Blocked Tensor Contract
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Blocked(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const float *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const float *restrict u,
+    float *restrict v, const CeedInt JJ, const CeedInt CC) {
+  const CeedInt L = CEED_AVX512_LANES_F32;
+  CeedInt t_stride_0 = B, t_stride_1 = 1;
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1; t_stride_1 = J;
+  }
+
+  for (CeedInt a=0; a<A; a++) {
+    // Blocks of JJ rows
+    for (CeedInt j=0; j<(J/JJ)*JJ; j+=JJ) {
+      for (CeedInt c=0; c<(C/CC)*CC; c+=CC) {
+        __m512 vv[JJ][CC/L]; // Output tile to be held in registers
+        for (CeedInt jj=0; jj<JJ; jj++)
+          for (CeedInt cc=0; cc<CC/L; cc++)
+            vv[jj][cc] = _mm512_loadu_ps(&v[(a*J+j+jj)*C+c+cc*L]);
+
+        for (CeedInt b=0; b<B; b++) {
+          for (CeedInt jj=0; jj<JJ; jj++) { // unroll
+            __m512 tqv = _mm512_set1_ps(t[(j+jj)*t_stride_0 + b*t_stride_1]);
+            for (CeedInt cc=0; cc<CC/L; cc++) // unroll
+              fmadd(vv[jj][cc], tqv, _mm512_loadu_ps(&u[(a*B+b)*C+c+cc*L]));
+          }
+        }
+        for (CeedInt jj=0; jj<JJ; jj++)
+          for (CeedInt cc=0; cc<CC/L; cc++)
+            _mm512_storeu_ps(&v[(a*J+j+jj)*C+c+cc*L], vv[jj][cc]);
+      }
+    }
+    // Remainder of rows
+    CeedInt j=(J/JJ)*JJ;
+    if (j < J) {
+      for (CeedInt c=0; c<(C/CC)*CC; c+=CC) {
+        __m512 vv[JJ][CC/L]; // Output tile to be held in registers
+        for (CeedInt jj=0; jj<J-j; jj++)
+          for (CeedInt cc=0; cc<CC/L; cc++)
+            vv[jj][cc] = _mm512_loadu_ps(&v[(a*J+j+jj)*C+c+cc*L]);
+
+        for (CeedInt b=0; b<B; b++) {
+          for (CeedInt jj=0; jj<J-j; jj++) { // doesn't unroll
+            __m512 tqv = _mm512_set1_ps(t[(j+jj)*t_stride_0 + b*t_stride_1]);
+            for (CeedInt cc=0; cc<CC/L; cc++) // unroll
+              fmadd(vv[jj][cc], tqv, _mm512_loadu_ps(&u[(a*B+b)*C+c+cc*L]));
+          }
+        }
+        for (CeedInt jj=0; jj<J-j; jj++)
+          for (CeedInt cc=0; cc<CC/L; cc++)
+            _mm512_storeu_ps(&v[(a*J+j+jj)*C+c+cc*L], vv[jj][cc]);
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract Remainder, Masked Loads and Stores for Columns Past
+//   the Last Full Block
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Remainder(
+  CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+  const float *restrict t, CeedTransposeMode t_mode, const CeedInt add,
+  const float *restrict u, float *restrict v, const CeedInt JJ,
+  const CeedInt CC) {
+  const CeedInt L = CEED_AVX512_LANES_F32;
+  CeedInt t_stride_0 = B, t_stride_1 = 1;
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1; t_stride_1 = J;
+  }
+
+  for (CeedInt a=0; a<A; a++) {
+    // Columns in registers of L lanes, last register masked
+    for (CeedInt c=(C/CC)*CC; c<C; c+=L) {
+      const __mmask16 mask = CeedMask_Avx512_f32(C-c);
+      // Blocks of JJ rows
+      for (CeedInt j=0; j<(J/JJ)*JJ; j+=JJ) {
+        __m512 vv[JJ]; // Output tile to be held in registers
+        for (CeedInt jj=0; jj<JJ; jj++)
+          vv[jj] = _mm512_maskz_loadu_ps(mask, &v[(a*J+j+jj)*C+c]);
+
+        for (CeedInt b=0; b<B; b++) {
+          __m512 tqu = _mm512_maskz_loadu_ps(mask, &u[(a*B+b)*C+c]);
+          for (CeedInt jj=0; jj<JJ; jj++) // unroll
+            fmadd(vv[jj], tqu, _mm512_set1_ps(t[(j+jj)*t_stride_0 + b*t_stride_1]));
+        }
+        for (CeedInt jj=0; jj<JJ; jj++)
+          _mm512_mask_storeu_ps(&v[(a*J+j+jj)*C+c], mask, vv[jj]);
+      }
+      // Remainder of rows
+      for (CeedInt j=(J/JJ)*JJ; j<J; j++) {
+        __m512 vv = _mm512_maskz_loadu_ps(mask, &v[(a*J+j)*C+c]);
+
+        for (CeedInt b=0; b<B; b++)
+          fmadd(vv, _mm512_maskz_loadu_ps(mask, &u[(a*B+b)*C+c]),
+                _mm512_set1_ps(t[j*t_stride_0 + b*t_stride_1]));
+        _mm512_mask_storeu_ps(&v[(a*J+j)*C+c], mask, vv);
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract C=1, Masked Loads and Stores for the Last Columns
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Single(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const float *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const float *restrict u,
+    float *restrict v, const CeedInt AA, const CeedInt JJ) {
+  const CeedInt L = CEED_AVX512_LANES_F32;
+  CeedInt t_stride_0 = B, t_stride_1 = 1;
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1; t_stride_1 = J;
+  }
+
+  // Offsets of the lanes of a column register in t
+  int idx_array[CEED_AVX512_LANES_F32];
+  for (CeedInt l=0; l<L; l++)
+    idx_array[l] = l*t_stride_0;
+  const __m512i idx = _mm512_loadu_si512(idx_array);
+
+  // Blocks of JJ columns
+  for (CeedInt j=0; j<J; j+=JJ) {
+    __mmask16 mask[JJ/L];
+    for (CeedInt jj=0; jj<JJ/L; jj++)
+      mask[jj] = CeedMask_Avx512_f32(J-j-jj*L);
+
+    // Blocks of AA rows
+    for (CeedInt a=0; a<(A/AA)*AA; a+=AA) {
+      __m512 vv[AA][JJ/L]; // Output tile to be held in registers
+      for (CeedInt aa=0; aa<AA; aa++)
+        for (CeedInt jj=0; jj<JJ/L; jj++)
+          vv[aa][jj] = _mm512_maskz_loadu_ps(mask[jj], &v[(a+aa)*J+j+jj*L]);
+
+      for (CeedInt b=0; b<B; b++) {
+        for (CeedInt jj=0; jj<JJ/L; jj++) { // unroll
+          __m512 tqv = CeedLoadStrided_Avx512_f32(
+                          &t[(j+jj*L)*t_stride_0 + b*t_stride_1], t_stride_0,
+                          idx, mask[jj]);
+          for (CeedInt aa=0; aa<AA; aa++) // unroll
+            fmadd(vv[aa][jj], tqv, _mm512_set1_ps(u[(a+aa)*B+b]));
+        }
+      }
+      for (CeedInt aa=0; aa<AA; aa++)
+        for (CeedInt jj=0; jj<JJ/L; jj++)
+          _mm512_mask_storeu_ps(&v[(a+aa)*J+j+jj*L], mask[jj], vv[aa][jj]);
+    }
+    // Remainder of rows
+    for (CeedInt a=(A/AA)*AA; a<A; a++) {
+      __m512 vv[JJ/L]; // Output tile to be held in registers
+      for (CeedInt jj=0; jj<JJ/L; jj++)
+        vv[jj] = _mm512_maskz_loadu_ps(mask[jj], &v[a*J+j+jj*L]);
+
+      for (CeedInt b=0; b<B; b++) {
+        for (CeedInt jj=0; jj<JJ/L; jj++) // unroll
+          fmadd(vv[jj], CeedLoadStrided_Avx512_f32(
+                  &t[(j+jj*L)*t_stride_0 + b*t_stride_1], t_stride_0, idx,
+                  mask[jj]), _mm512_set1_ps(u[a*B+b]));
+      }
+      for (CeedInt jj=0; jj<JJ/L; jj++)
+        _mm512_mask_storeu_ps(&v[a*J+j+jj*L], mask[jj], vv[jj]);
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract - Common Sizes
+//------------------------------------------------------------------------------
+static int CeedTensorContract_Avx512_Blocked_4_32(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const float *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const float *restrict u,
+    float *restrict v) {
+  return CeedTensorContract_Avx512_Blocked(contract, A, B, C, J, t, t_mode, add,
+         u, v, 4, 32);
+}
+static int CeedTensorContract_Avx512_Remainder_8_32(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const float *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const float *restrict u,
+    float *restrict v) {
+  return CeedTensorContract_Avx512_Remainder(contract, A, B, C, J, t, t_mode,
+         add, u, v, 8, 32);
+}
+static int CeedTensorContract_Avx512_Single_4_32(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const float *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const float *restrict u,
+    float *restrict v) {
+  return CeedTensorContract_Avx512_Single(contract, A, B, C, J, t, t_mode, add,
+                                          u, v, 4, 32);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Avx512(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const float *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const float *restrict u,
+    float *restrict v) {
+  const CeedInt blk_size = 32;
+
+  if (!add)
+    for (CeedInt q=0; q<A*J*C; q++)
+      v[q] = (float) 0.0;
+
+  if (C == 1) {
+    // Serial C=1 Case
+    CeedTensorContract_Avx512_Single_4_32(contract, A, B, C, J, t, t_mode, true,
+                                          u, v);
+  } else {
+    // Blocks of 32 columns
+    if (C >= blk_size)
+      CeedTensorContract_Avx512_Blocked_4_32(contract, A, B, C, J, t, t_mode,
+                                             true, u, v);
+    // Remainder of columns
+    if (C % blk_size)
+      CeedTensorContract_Avx512_Remainder_8_32(contract, A, B, C, J, t, t_mode,
+          true, u, v);
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Create
+//------------------------------------------------------------------------------
+int CeedTensorContractCreate_f32_Avx512(CeedBasis basis,
+                                        CeedTensorContract contract) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChkBackend(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                CeedTensorContractApply_Avx512);
+  CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,38 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#ifndef _ceed_avx512_h
+#define _ceed_avx512_h
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+
+// The AVX-512 backends are compiled into every x86 build of libCEED and only
+//   registered on CPUs that support AVX-512F
+static inline bool CeedCpuHasAvx512(void) {
+  return __builtin_cpu_supports("avx512f");
+}
+
+CEED_INTERN int CeedTensorContractCreate_f32_Avx512(CeedBasis basis,
+    CeedTensorContract contract);
+CEED_INTERN int CeedTensorContractCreate_f64_Avx512(CeedBasis basis,
+    CeedTensorContract contract);
+
+CEED_INTERN int CeedElemRestrictionCreate_Avx512(CeedMemType mem_type,
+    CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction r);
+
+#endif // _ceed_avx512_h
@@ -0,0 +1,77 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include <cblas.h>
+#include "ceed-blas.h"
+#include "../opt/ceed-opt.h"
+
+// Smallest GEMM, as m*n*k, applied with BLAS instead of the loop nest
+#define CEED_BLAS_MIN_GEMM_SIZE 64
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Blas(CeedTensorContract contract, CeedInt A,
+                                        CeedInt B, CeedInt C, CeedInt J,
+                                        const double *restrict t,
+                                        CeedTransposeMode t_mode,
+                                        const CeedInt add,
+                                        const double *restrict u,
+                                        double *restrict v) {
+  const double alpha = 1.0, beta = add ? 1.0 : 0.0;
+  const CeedInt ld_t = t_mode == CEED_TRANSPOSE ? J : B;
+
+  // Small GEMMs use the opt loop nest; this kernel is only registered when
+  //   double matches CeedScalar, so the casts do not change the data
+  if ((C == 1 ? A : C)*B*J < CEED_BLAS_MIN_GEMM_SIZE)
+    return CeedTensorContractApply_Opt(contract, A, B, C, J,
+                                       (const CeedScalar *)t, t_mode, add,
+                                       (const CeedScalar *)u, (CeedScalar *)v);
+
+  if (C == 1) {
+    // u and v are column-major matrices of size B x A and J x A, so the whole
+    //   contraction is the single GEMM v = op(t) u
+    cblas_dgemm(CblasColMajor,
+                t_mode == CEED_TRANSPOSE ? CblasNoTrans : CblasTrans,
+                CblasNoTrans, J, A, B, alpha, t, ld_t, u, B, beta, v, J);
+  } else {
+    // One GEMM v_a = u_a op(t) of size C x J per a
+    for (CeedInt a=0; a<A; a++)
+      cblas_dgemm(CblasColMajor, CblasNoTrans,
+                  t_mode == CEED_TRANSPOSE ? CblasTrans : CblasNoTrans,
+                  C, J, B, alpha, &u[a*B*C], C, t, ld_t, beta, &v[a*J*C], C);
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Create
+//------------------------------------------------------------------------------
+int CeedTensorContractCreate_f64_Blas(CeedBasis basis,
+                                      CeedTensorContract contract) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChkBackend(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                CeedTensorContractApply_Blas); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
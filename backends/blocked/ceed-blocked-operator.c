@@ -58,33 +58,8 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
       ierr = CeedOperatorFieldGetElemRestriction(op_fields[i], &r);
       CeedChkBackend(ierr);
       ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChkBackend(ierr);
-      CeedInt num_elem, elem_size, l_size, comp_stride;
-      ierr = CeedElemRestrictionGetNumElements(r, &num_elem); CeedChkBackend(ierr);
-      ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
-      ierr = CeedElemRestrictionGetLVectorSize(r, &l_size); CeedChkBackend(ierr);
-      ierr = CeedElemRestrictionGetNumComponents(r, &num_comp); CeedChkBackend(ierr);
-
-      bool strided;
-      ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChkBackend(ierr);
-      if (strided) {
-        CeedInt strides[3];
-        ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionCreateBlockedStrided(ceed, num_elem, elem_size,
-               blk_size, num_comp, l_size, strides, &blk_restr[i+start_e]);
-        CeedChkBackend(ierr);
-      } else {
-        const CeedInt *offsets = NULL;
-        ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
-        CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionGetCompStride(r, &comp_stride); CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size,
-                                                blk_size, num_comp, comp_stride,
-                                                l_size, CEED_MEM_HOST,
-                                                CEED_COPY_VALUES, offsets,
-                                                &blk_restr[i+start_e]);
-        CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChkBackend(ierr);
-      }
+      ierr = CeedElemRestrictionGetBlocked(r, blk_size, &blk_restr[i+start_e]);
+      CeedChkBackend(ierr);
       ierr = CeedElemRestrictionCreateVector(blk_restr[i+start_e], NULL,
                                              &e_vecs_full[i+start_e]);
       CeedChkBackend(ierr);
@@ -98,6 +73,7 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
       break;
     case CEED_EVAL_INTERP:
     case CEED_EVAL_GRAD:
+    case CEED_EVAL_DIV:
       ierr = CeedOperatorFieldGetBasis(op_fields[i], &basis); CeedChkBackend(ierr);
       ierr = CeedQFunctionFieldGetSize(qf_fields[i], &size); CeedChkBackend(ierr);
       ierr = CeedBasisGetNumNodes(basis, &P); CeedChkBackend(ierr);
@@ -115,8 +91,6 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
       CeedChkBackend(ierr);
 
       break;
-    case CEED_EVAL_DIV:
-      break; // Not implemented
     case CEED_EVAL_CURL:
       break; // Not implemented
     }
@@ -124,6 +98,47 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Find Active Input and Output Fields With the Same Restriction
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupDotFields_Blocked(CeedInt num_input_fields,
+    CeedOperatorField *op_input_fields, CeedInt num_output_fields,
+    CeedOperatorField *op_output_fields, CeedInt *dot_in_field,
+    CeedInt *dot_out_field) {
+  int ierr;
+  CeedInt num_active_out = 0;
+  CeedElemRestriction rstr_in, rstr_out;
+  CeedVector vec;
+
+  *dot_in_field = -1;
+  *dot_out_field = -1;
+  for (CeedInt i=0; i<num_output_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      num_active_out++;
+      *dot_out_field = i;
+    }
+  }
+  if (num_active_out != 1) {
+    *dot_out_field = -1;
+    return CEED_ERROR_SUCCESS;
+  }
+  ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[*dot_out_field],
+         &rstr_out); CeedChkBackend(ierr);
+  for (CeedInt i=0; i<num_input_fields && *dot_in_field < 0; i++) {
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr_in);
+    CeedChkBackend(ierr);
+    if (vec == CEED_VECTOR_ACTIVE && rstr_in == rstr_out)
+      *dot_in_field = i;
+  }
+  if (*dot_in_field < 0)
+    *dot_out_field = -1;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -199,17 +214,132 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
     }
   }
 
+  // Fields for dot products fused with the output restriction
+  ierr = CeedOperatorSetupDotFields_Blocked(num_input_fields, op_input_fields,
+         num_output_fields, op_output_fields, &impl->dot_in_field,
+         &impl->dot_out_field); CeedChkBackend(ierr);
+
   ierr = CeedOperatorSetSetupDone(op); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Restrict a Range of Element Blocks
+//------------------------------------------------------------------------------
+static int CeedOperatorRestrictRange_Blocked(CeedElemRestriction blk_restr,
+    CeedInt first_blk, CeedInt last_blk, CeedTransposeMode t_mode,
+    CeedVector l_vec, CeedVector e_vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(blk_restr, &ceed); CeedChkBackend(ierr);
+  CeedInt blk_size, elem_size, num_comp;
+  ierr = CeedElemRestrictionGetBlockSize(blk_restr, &blk_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(blk_restr, &elem_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(blk_restr, &num_comp);
+  CeedChkBackend(ierr);
+  const CeedInt blk_e_size = blk_size*elem_size*num_comp;
+  CeedVector e_vec_blk;
+  CeedScalar *e_data;
+
+  // Single block view into the Evec
+  ierr = CeedVectorCreate(ceed, blk_e_size, &e_vec_blk); CeedChkBackend(ierr);
+  if (t_mode == CEED_NOTRANSPOSE) {
+    ierr = CeedVectorGetArrayWrite(e_vec, CEED_MEM_HOST, &e_data);
+    CeedChkBackend(ierr);
+  } else {
+    ierr = CeedVectorGetArrayRead(e_vec, CEED_MEM_HOST,
+                                  (const CeedScalar **) &e_data);
+    CeedChkBackend(ierr);
+  }
+
+  for (CeedInt b=first_blk; b<last_blk; b++) {
+    ierr = CeedVectorSetArray(e_vec_blk, CEED_MEM_HOST, CEED_USE_POINTER,
+                              &e_data[b*blk_e_size]); CeedChkBackend(ierr);
+    if (t_mode == CEED_NOTRANSPOSE) {
+      ierr = CeedElemRestrictionApplyBlock(blk_restr, b, CEED_NOTRANSPOSE, l_vec,
+                                           e_vec_blk, CEED_REQUEST_IMMEDIATE);
+    } else {
+      ierr = CeedElemRestrictionApplyBlock(blk_restr, b, CEED_TRANSPOSE,
+                                           e_vec_blk, l_vec,
+                                           CEED_REQUEST_IMMEDIATE);
+    }
+    CeedChkBackend(ierr);
+  }
+
+  // Cleanup
+  if (t_mode == CEED_NOTRANSPOSE) {
+    ierr = CeedVectorRestoreArray(e_vec, &e_data); CeedChkBackend(ierr);
+  } else {
+    ierr = CeedVectorRestoreArrayRead(e_vec, (const CeedScalar **) &e_data);
+    CeedChkBackend(ierr);
+  }
+  ierr = CeedVectorDestroy(&e_vec_blk); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Zero Elements Outside of [e_start, e_end) in the Boundary Blocks of the Range
+//------------------------------------------------------------------------------
+static inline int CeedOperatorMaskRange_Blocked(CeedElemRestriction blk_restr,
+    CeedInt e_start, CeedInt e_end, CeedScalar *e_data) {
+  int ierr;
+  CeedInt blk_size, elem_size, num_comp;
+  ierr = CeedElemRestrictionGetBlockSize(blk_restr, &blk_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(blk_restr, &elem_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(blk_restr, &num_comp);
+  CeedChkBackend(ierr);
+  const CeedInt boundary_blks[2] = {e_start/blk_size, (e_end - 1)/blk_size};
+
+  for (CeedInt k=0; k<1 + (boundary_blks[1] > boundary_blks[0]); k++) {
+    const CeedInt b = boundary_blks[k];
+    CeedScalar *blk_data = &e_data[b*blk_size*elem_size*num_comp];
+    for (CeedInt i=0; i<elem_size*num_comp; i++)
+      for (CeedInt j=0; j<blk_size; j++)
+        if (b*blk_size + j < e_start || b*blk_size + j >= e_end)
+          blk_data[i*blk_size + j] = 0.0;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Add Dot Product of Elements [e_start, e_end) of One Block of Two Evecs
+//------------------------------------------------------------------------------
+static inline int CeedOperatorDotBlock_Blocked(CeedElemRestriction blk_restr,
+    CeedInt e, CeedInt e_start, CeedInt e_end, const CeedScalar *u_data,
+    const CeedScalar *v_data, CeedScalar *dot) {
+  int ierr;
+  CeedInt blk_size, elem_size, num_comp;
+  ierr = CeedElemRestrictionGetBlockSize(blk_restr, &blk_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(blk_restr, &elem_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(blk_restr, &num_comp);
+  CeedChkBackend(ierr);
+  const CeedInt lane_start = CeedIntMax(e_start - e, 0),
+                lane_end = CeedIntMin(e_end - e, blk_size);
+  const CeedScalar *u_blk = &u_data[e*elem_size*num_comp],
+                    *v_blk = &v_data[e*elem_size*num_comp];
+  CeedScalar sum = 0.0;
+
+  for (CeedInt i=0; i<elem_size*num_comp; i++)
+    for (CeedInt j=lane_start; j<lane_end; j++)
+      sum += u_blk[i*blk_size + j]*v_blk[i*blk_size + j];
+  *dot += sum;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator Inputs
 //------------------------------------------------------------------------------
 static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields,
     CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-    CeedVector in_vec, bool skip_active, CeedScalar *e_data_full[2*CEED_FIELD_MAX],
+    CeedVector in_vec, bool skip_active, CeedInt first_blk, CeedInt last_blk,
+    CeedInt num_blks, CeedScalar *e_data_full[2*CEED_FIELD_MAX],
     CeedOperator_Blocked *impl, CeedRequest *request) {
   CeedInt ierr;
   CeedEvalMode eval_mode;
@@ -234,10 +364,19 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields,
       // Restrict
       ierr = CeedVectorGetState(vec, &state); CeedChkBackend(ierr);
       if (state != impl->input_states[i] || vec == in_vec) {
-        ierr = CeedElemRestrictionApply(impl->blk_restr[i], CEED_NOTRANSPOSE,
-                                        vec, impl->e_vecs_full[i], request);
-        CeedChkBackend(ierr);
-        impl->input_states[i] = state;
+        if (first_blk == 0 && last_blk == num_blks) {
+          ierr = CeedElemRestrictionApply(impl->blk_restr[i], CEED_NOTRANSPOSE,
+                                          vec, impl->e_vecs_full[i],
+                                          CEED_REQUEST_IMMEDIATE);
+          CeedChkBackend(ierr);
+          impl->input_states[i] = state;
+        } else {
+          ierr = CeedOperatorRestrictRange_Blocked(impl->blk_restr[i], first_blk,
+                 last_blk, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i]);
+          CeedChkBackend(ierr);
+          // Only part of the Evec is current, never skip the next restriction
+          impl->input_states[i] = UINT64_MAX;
+        }
       }
       // Get evec
       ierr = CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST,
@@ -256,7 +395,7 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q,
     CeedInt num_input_fields, CeedInt blk_size, bool skip_active,
     CeedScalar *e_data_full[2*CEED_FIELD_MAX], CeedOperator_Blocked *impl) {
   CeedInt ierr;
-  CeedInt dim, elem_size, size;
+  CeedInt dim, Q_comp, elem_size, size;
   CeedElemRestriction elem_restr;
   CeedEvalMode eval_mode;
   CeedBasis basis;
@@ -290,8 +429,11 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q,
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
       CeedChkBackend(ierr);
+      ierr = CeedBasisGetNumQuadratureComponents(basis, &Q_comp);
+      CeedChkBackend(ierr);
       ierr = CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER, &e_data_full[i][e*elem_size*size]);
+                                CEED_USE_POINTER,
+                                &e_data_full[i][e*elem_size*size/Q_comp]);
       CeedChkBackend(ierr);
       ierr = CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE,
                             CEED_EVAL_INTERP, impl->e_vecs_in[i],
@@ -308,10 +450,19 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q,
                             CEED_EVAL_GRAD, impl->e_vecs_in[i],
                             impl->q_vecs_in[i]); CeedChkBackend(ierr);
       break;
+    case CEED_EVAL_DIV:
+      ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, &e_data_full[i][e*elem_size*size]);
+      CeedChkBackend(ierr);
+      ierr = CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE,
+                            CEED_EVAL_DIV, impl->e_vecs_in[i],
+                            impl->q_vecs_in[i]); CeedChkBackend(ierr);
+      break;
     case CEED_EVAL_WEIGHT:
       break;  // No action
     // LCOV_EXCL_START
-    case CEED_EVAL_DIV:
     case CEED_EVAL_CURL: {
       ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
       CeedChkBackend(ierr);
@@ -335,7 +486,7 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q,
     CeedOperator op, CeedScalar *e_data_full[2*CEED_FIELD_MAX],
     CeedOperator_Blocked *impl) {
   CeedInt ierr;
-  CeedInt dim, elem_size, size;
+  CeedInt dim, Q_comp, elem_size, size;
   CeedElemRestriction elem_restr;
   CeedEvalMode eval_mode;
   CeedBasis basis;
@@ -357,8 +508,10 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q,
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(op_output_fields[i], &basis);
       CeedChkBackend(ierr);
+      ierr = CeedBasisGetNumQuadratureComponents(basis, &Q_comp);
+      CeedChkBackend(ierr);
       ierr = CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER, &e_data_full[i + num_input_fields][e*elem_size*size]);
+                                CEED_USE_POINTER, &e_data_full[i + num_input_fields][e*elem_size*size/Q_comp]);
       CeedChkBackend(ierr);
       ierr = CeedBasisApply(basis, blk_size, CEED_TRANSPOSE,
                             CEED_EVAL_INTERP, impl->q_vecs_out[i],
@@ -375,6 +528,16 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q,
                             CEED_EVAL_GRAD, impl->q_vecs_out[i],
                             impl->e_vecs_out[i]); CeedChkBackend(ierr);
       break;
+    case CEED_EVAL_DIV:
+      ierr = CeedOperatorFieldGetBasis(op_output_fields[i], &basis);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, &e_data_full[i + num_input_fields][e*elem_size*size]);
+      CeedChkBackend(ierr);
+      ierr = CeedBasisApply(basis, blk_size, CEED_TRANSPOSE,
+                            CEED_EVAL_DIV, impl->q_vecs_out[i],
+                            impl->e_vecs_out[i]); CeedChkBackend(ierr);
+      break;
     // LCOV_EXCL_START
     case CEED_EVAL_WEIGHT: {
       Ceed ceed;
@@ -383,7 +546,6 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q,
                        "CEED_EVAL_WEIGHT cannot be an output "
                        "evaluation mode");
     }
-    case CEED_EVAL_DIV:
     case CEED_EVAL_CURL: {
       Ceed ceed;
       ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
@@ -428,11 +590,12 @@ static inline int CeedOperatorRestoreInputs_Blocked(CeedInt num_input_fields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Core code for operator apply on a range of elements, overwriting the outputs
+//   instead of summing into them if is_add is false
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
-                                        CeedVector out_vec,
-                                        CeedRequest *request) {
+static int CeedOperatorApplyAddCore_Blocked(CeedOperator op, CeedInt e_start,
+    CeedInt e_end, bool is_add, CeedVector in_vec, CeedVector out_vec,
+    CeedScalar *dot, CeedRequest *request) {
   int ierr;
   CeedOperator_Blocked *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
@@ -454,23 +617,51 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
   CeedEvalMode eval_mode;
   CeedVector vec;
   CeedScalar *e_data_full[2*CEED_FIELD_MAX] = {0};
+  const bool is_full = e_start == 0 && e_end == num_elem;
+  const CeedInt first_blk = e_start/blk_size,
+                last_blk = (e_end/blk_size) + !!(e_end%blk_size);
 
   // Setup
   ierr = CeedOperatorSetup_Blocked(op); CeedChkBackend(ierr);
 
   // Restriction only operator
   if (impl->is_identity_restr_op) {
-    ierr = CeedElemRestrictionApply(impl->blk_restr[0], CEED_NOTRANSPOSE, in_vec,
-                                    impl->e_vecs_full[0], request); CeedChkBackend(ierr);
-    ierr = CeedElemRestrictionApply(impl->blk_restr[1], CEED_TRANSPOSE,
-                                    impl->e_vecs_full[0], out_vec, request); CeedChkBackend(ierr);
+    if (is_full) {
+      ierr = CeedElemRestrictionApply(impl->blk_restr[0], CEED_NOTRANSPOSE, in_vec,
+                                      impl->e_vecs_full[0],
+                                      CEED_REQUEST_IMMEDIATE);
+      CeedChkBackend(ierr);
+      if (is_add) {
+        ierr = CeedElemRestrictionApply(impl->blk_restr[1], CEED_TRANSPOSE,
+                                        impl->e_vecs_full[0], out_vec,
+                                        CEED_REQUEST_IMMEDIATE);
+      } else {
+        ierr = CeedElemRestrictionApplyTransposeOverwrite(impl->blk_restr[1],
+               impl->e_vecs_full[0], out_vec, CEED_REQUEST_IMMEDIATE);
+      }
+      CeedChkBackend(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+    ierr = CeedOperatorRestrictRange_Blocked(impl->blk_restr[0], first_blk,
+           last_blk, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0]);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorGetArray(impl->e_vecs_full[0], CEED_MEM_HOST,
+                              &e_data_full[0]); CeedChkBackend(ierr);
+    ierr = CeedOperatorMaskRange_Blocked(impl->blk_restr[1], e_start, e_end,
+                                         e_data_full[0]); CeedChkBackend(ierr);
+    ierr = CeedVectorRestoreArray(impl->e_vecs_full[0], &e_data_full[0]);
+    CeedChkBackend(ierr);
+    ierr = CeedOperatorRestrictRange_Blocked(impl->blk_restr[1], first_blk,
+           last_blk, CEED_TRANSPOSE, out_vec, impl->e_vecs_full[0]);
+    CeedChkBackend(ierr);
     return CEED_ERROR_SUCCESS;
   }
 
   // Input Evecs and Restriction
   ierr = CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields,
-                                         op_input_fields, in_vec, false, e_data_full,
-                                         impl, request); CeedChkBackend(ierr);
+                                         op_input_fields, in_vec, false, first_blk,
+                                         last_blk, num_blks, e_data_full, impl,
+                                         request); CeedChkBackend(ierr);
 
   // Output Evecs
   for (CeedInt i=0; i<num_output_fields; i++) {
@@ -480,7 +671,7 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
   }
 
   // Loop through elements
-  for (CeedInt e=0; e<num_blks*blk_size; e+=blk_size) {
+  for (CeedInt e=first_blk*blk_size; e<last_blk*blk_size; e+=blk_size) {
     // Output pointers
     for (CeedInt i=0; i<num_output_fields; i++) {
       ierr = CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode);
@@ -510,10 +701,26 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
                                            blk_size, num_input_fields,
                                            num_output_fields, op, e_data_full, impl);
     CeedChkBackend(ierr);
+
+    // Dot product with the active input while the block is in cache
+    if (dot) {
+      ierr = CeedOperatorDotBlock_Blocked(
+               impl->blk_restr[impl->dot_out_field + num_input_fields], e, e_start,
+               e_end, e_data_full[impl->dot_in_field],
+               e_data_full[impl->dot_out_field + num_input_fields], dot);
+      CeedChkBackend(ierr);
+    }
   }
 
   // Output restriction
   for (CeedInt i=0; i<num_output_fields; i++) {
+    // Zero elements of the boundary blocks outside of the range
+    if (!is_full) {
+      ierr = CeedOperatorMaskRange_Blocked(impl->blk_restr[i+impl->num_inputs],
+                                           e_start, e_end,
+                                           e_data_full[i + num_input_fields]);
+      CeedChkBackend(ierr);
+    }
     // Restore evec
     ierr = CeedVectorRestoreArray(impl->e_vecs_full[i+impl->num_inputs],
                                   &e_data_full[i + num_input_fields]);
@@ -521,14 +728,33 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
     // Get output vector
     ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
     CeedChkBackend(ierr);
+    // Overwrite with the first field of each output vector
+    bool is_overwrite = !is_add;
+    for (CeedInt j=0; j<i && is_overwrite; j++) {
+      CeedVector vec_j;
+      ierr = CeedOperatorFieldGetVector(op_output_fields[j], &vec_j);
+      CeedChkBackend(ierr);
+      is_overwrite = vec_j != vec;
+    }
     // Active
     if (vec == CEED_VECTOR_ACTIVE)
       vec = out_vec;
     // Restrict
-    ierr = CeedElemRestrictionApply(impl->blk_restr[i+impl->num_inputs],
-                                    CEED_TRANSPOSE, impl->e_vecs_full[i+impl->num_inputs],
-                                    vec, request); CeedChkBackend(ierr);
-
+    if (is_overwrite) {
+      ierr = CeedElemRestrictionApplyTransposeOverwrite(
+               impl->blk_restr[i+impl->num_inputs],
+               impl->e_vecs_full[i+impl->num_inputs], vec,
+               CEED_REQUEST_IMMEDIATE);
+    } else if (is_full) {
+      ierr = CeedElemRestrictionApply(impl->blk_restr[i+impl->num_inputs],
+                                      CEED_TRANSPOSE, impl->e_vecs_full[i+impl->num_inputs],
+                                      vec, CEED_REQUEST_IMMEDIATE);
+    } else {
+      ierr = CeedOperatorRestrictRange_Blocked(impl->blk_restr[i+impl->num_inputs],
+             first_blk, last_blk, CEED_TRANSPOSE, vec,
+             impl->e_vecs_full[i+impl->num_inputs]);
+    }
+    CeedChkBackend(ierr);
   }
 
   // Restore input arrays
@@ -538,6 +764,68 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApply_Blocked(CeedOperator op, CeedVector in_vec,
+                                     CeedVector out_vec, CeedRequest *request) {
+  int ierr;
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+
+  return CeedOperatorApplyAddCore_Blocked(op, 0, num_elem, false, in_vec,
+                                          out_vec, NULL, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply and Add
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
+                                        CeedVector out_vec,
+                                        CeedRequest *request) {
+  int ierr;
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+
+  return CeedOperatorApplyAddCore_Blocked(op, 0, num_elem, true, in_vec, out_vec,
+                                          NULL, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on a Range of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddRange_Blocked(CeedOperator op, CeedInt e_start,
+    CeedInt e_end, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddCore_Blocked(op, e_start, e_end, true, in_vec,
+                                          out_vec, NULL, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply with Dot Product of Input and Output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyDot_Blocked(CeedOperator op, CeedVector in_vec,
+                                        CeedVector out_vec, CeedScalar *result) {
+  int ierr;
+  CeedOperator_Blocked *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+
+  // Setup
+  ierr = CeedOperatorSetup_Blocked(op); CeedChkBackend(ierr);
+
+  // Fuse the dot product if an active input has the output restriction
+  if (impl->dot_out_field < 0 || impl->is_identity_restr_op) {
+    ierr = CeedOperatorApplyAddCore_Blocked(op, 0, num_elem, false, in_vec,
+                                            out_vec, NULL, CEED_REQUEST_IMMEDIATE);
+    CeedChkBackend(ierr);
+    return CeedVectorDot(in_vec, out_vec, result);
+  }
+  *result = 0.0;
+  return CeedOperatorApplyAddCore_Blocked(op, 0, num_elem, false, in_vec,
+                                          out_vec, result, CEED_REQUEST_IMMEDIATE);
+}
+
 //------------------------------------------------------------------------------
 // Core code for assembling linear QFunction
 //------------------------------------------------------------------------------
@@ -583,8 +871,9 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(
 
   // Input Evecs and Restriction
   ierr = CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields,
-                                         op_input_fields, NULL, true, e_data_full,
-                                         impl, request); CeedChkBackend(ierr);
+                                         op_input_fields, NULL, true, 0, num_blks,
+                                         num_blks, e_data_full, impl, request);
+  CeedChkBackend(ierr);
 
   // Count number of active input fields
   if (!num_active_in) {
@@ -722,7 +1011,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(
     impl->qf_blk_rstr = blk_rstr;
   }
   ierr = CeedElemRestrictionApply(blk_rstr, CEED_TRANSPOSE, l_vec, *assembled,
-                                  request); CeedChkBackend(ierr);
+                                  CEED_REQUEST_IMMEDIATE); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
@@ -806,8 +1095,17 @@ int CeedOperatorCreate_Blocked(CeedOperator op) {
                                 "LinearAssembleQFunctionUpdate",
                                 CeedOperatorLinearAssembleQFunctionUpdate_Blocked);
   CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Setup",
+                                CeedOperatorSetup_Blocked); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Apply",
+                                CeedOperatorApply_Blocked); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Blocked); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddRange",
+                                CeedOperatorApplyAddRange_Blocked);
+  CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyDot",
+                                CeedOperatorApplyDot_Blocked); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Blocked); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
@@ -37,6 +37,8 @@ typedef struct {
   CeedVector *q_vecs_out;  /* Element block output Q-vectors */
   CeedInt    num_inputs, num_outputs;
   CeedInt    num_active_in, num_active_out;
+  CeedInt    dot_in_field, dot_out_field; /* Active fields with the same
+                                             restriction, -1 if none */
   CeedVector *qf_active_in;
   CeedVector qf_l_vec;
   CeedElemRestriction qf_blk_rstr;
@@ -7,6 +7,10 @@
 
 MACRO(CeedRegister_Avx_Blocked, 1, "/cpu/self/avx/blocked")
 MACRO(CeedRegister_Avx_Serial, 1, "/cpu/self/avx/serial")
+MACRO(CeedRegister_Avx512_Blocked, 1, "/cpu/self/avx512/blocked")
+MACRO(CeedRegister_Avx512_Serial, 1, "/cpu/self/avx512/serial")
+MACRO(CeedRegister_Blas_Blocked, 1, "/cpu/self/blas/blocked")
+MACRO(CeedRegister_Blas_Serial, 1, "/cpu/self/blas/serial")
 MACRO(CeedRegister_Cuda, 1, "/gpu/cuda/ref")
 MACRO(CeedRegister_Cuda_Gen, 1, "/gpu/cuda/gen")
 MACRO(CeedRegister_Cuda_Shared, 1, "/gpu/cuda/shared")
@@ -22,5 +26,7 @@ MACRO(CeedRegister_Opt_Blocked, 1, "/cpu/self/opt/blocked")
 MACRO(CeedRegister_Opt_Serial, 1, "/cpu/self/opt/serial")
 MACRO(CeedRegister_Ref, 1, "/cpu/self/ref/serial")
 MACRO(CeedRegister_Ref_Blocked, 1, "/cpu/self/ref/blocked")
+MACRO(CeedRegister_Simd_Blocked, 1, "/cpu/self/simd/blocked")
+MACRO(CeedRegister_Simd_Serial, 1, "/cpu/self/simd/serial")
 MACRO(CeedRegister_Xsmm_Blocked, 1, "/cpu/self/xsmm/blocked")
 MACRO(CeedRegister_Xsmm_Serial, 1, "/cpu/self/xsmm/serial")
@@ -24,8 +24,13 @@
 //------------------------------------------------------------------------------
 static int CeedInit_Memcheck(const char *resource, Ceed ceed) {
   int ierr;
-  if (strcmp(resource, "/cpu/self/memcheck")
-      && strcmp(resource, "/cpu/self/memcheck/serial"))
+  char *resource_root;
+  ierr = CeedGetResourceRoot(ceed, resource, ":", &resource_root);
+  CeedChkBackend(ierr);
+  const bool is_valid = !strcmp(resource_root, "/cpu/self/memcheck") ||
+                        !strcmp(resource_root, "/cpu/self/memcheck/serial");
+  ierr = CeedFree(&resource_root); CeedChkBackend(ierr);
+  if (!is_valid)
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_BACKEND,
                      "Valgrind Memcheck backend cannot use resource: %s",
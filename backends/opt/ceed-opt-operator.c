@@ -58,35 +58,8 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
     if (eval_mode != CEED_EVAL_WEIGHT) {
       ierr = CeedOperatorFieldGetElemRestriction(op_fields[i], &r);
       CeedChkBackend(ierr);
-      Ceed ceed;
-      ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChkBackend(ierr);
-      CeedInt num_elem, elem_size, l_size, comp_stride;
-      ierr = CeedElemRestrictionGetNumElements(r, &num_elem); CeedChkBackend(ierr);
-      ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
-      ierr = CeedElemRestrictionGetLVectorSize(r, &l_size); CeedChkBackend(ierr);
-      ierr = CeedElemRestrictionGetNumComponents(r, &num_comp); CeedChkBackend(ierr);
-
-      bool strided;
-      ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChkBackend(ierr);
-      if (strided) {
-        CeedInt strides[3];
-        ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionCreateBlockedStrided(ceed, num_elem, elem_size,
-               blk_size, num_comp, l_size, strides, &blk_restr[i+start_e]);
-        CeedChkBackend(ierr);
-      } else {
-        const CeedInt *offsets = NULL;
-        ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
-        CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionGetCompStride(r, &comp_stride); CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size,
-                                                blk_size, num_comp, comp_stride,
-                                                l_size, CEED_MEM_HOST,
-                                                CEED_COPY_VALUES, offsets,
-                                                &blk_restr[i+start_e]);
-        CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChkBackend(ierr);
-      }
+      ierr = CeedElemRestrictionGetBlocked(r, blk_size, &blk_restr[i+start_e]);
+      CeedChkBackend(ierr);
       ierr = CeedElemRestrictionCreateVector(blk_restr[i+start_e], NULL,
                                              &e_vecs_full[i+start_e]);
       CeedChkBackend(ierr);
@@ -102,6 +75,7 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
       break;
     case CEED_EVAL_INTERP:
     case CEED_EVAL_GRAD:
+    case CEED_EVAL_DIV:
       ierr = CeedOperatorFieldGetBasis(op_fields[i], &basis); CeedChkBackend(ierr);
       ierr = CeedQFunctionFieldGetSize(qf_fields[i], &size); CeedChkBackend(ierr);
       ierr = CeedBasisGetNumNodes(basis, &P); CeedChkBackend(ierr);
@@ -119,8 +93,6 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
       CeedChkBackend(ierr);
 
       break;
-    case CEED_EVAL_DIV:
-      break; // Not implemented
     case CEED_EVAL_CURL:
       break; // Not implemented
     }
@@ -132,6 +104,128 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Find Active Input and Output Fields With the Same Restriction
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupDotFields_Opt(CeedInt num_input_fields,
+    CeedOperatorField *op_input_fields, CeedInt num_output_fields,
+    CeedOperatorField *op_output_fields, CeedInt *dot_in_field,
+    CeedInt *dot_out_field) {
+  int ierr;
+  CeedInt num_active_out = 0;
+  CeedElemRestriction rstr_in, rstr_out;
+  CeedVector vec;
+
+  *dot_in_field = -1;
+  *dot_out_field = -1;
+  for (CeedInt i=0; i<num_output_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      num_active_out++;
+      *dot_out_field = i;
+    }
+  }
+  if (num_active_out != 1) {
+    *dot_out_field = -1;
+    return CEED_ERROR_SUCCESS;
+  }
+  ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[*dot_out_field],
+         &rstr_out); CeedChkBackend(ierr);
+  for (CeedInt i=0; i<num_input_fields && *dot_in_field < 0; i++) {
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr_in);
+    CeedChkBackend(ierr);
+    if (vec == CEED_VECTOR_ACTIVE && rstr_in == rstr_out)
+      *dot_in_field = i;
+  }
+  if (*dot_in_field < 0)
+    *dot_out_field = -1;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// First Touch Context
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedScalar *arrays[CEED_FIELD_MAX];
+  CeedInt blk_lengths[CEED_FIELD_MAX];
+  CeedInt num_fields, num_blks, num_tasks;
+} CeedOperatorFirstTouchCtx_Opt;
+
+//------------------------------------------------------------------------------
+// Zero One Range of Element Blocks of New Full E-Vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorFirstTouchTask_Opt(void *ctx, CeedInt t,
+    CeedInt thread) {
+  CeedOperatorFirstTouchCtx_Opt *touch_ctx = ctx;
+  const CeedInt first_blk = (touch_ctx->num_blks*t) / touch_ctx->num_tasks,
+                last_blk = (touch_ctx->num_blks*(t+1)) / touch_ctx->num_tasks;
+
+  for (CeedInt i=0; i<touch_ctx->num_fields; i++) {
+    if (!touch_ctx->arrays[i]) continue;
+    memset(&touch_ctx->arrays[i][first_blk*touch_ctx->blk_lengths[i]], 0,
+           (last_blk - first_blk)*touch_ctx->blk_lengths[i]*sizeof(CeedScalar));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// First Touch Full E-Vectors of Passive Inputs, if NUMA Aware
+//   The element block ranges match the thread tasks of an uncolored apply, so
+//   each thread reads E-vector pages on its own NUMA node
+//------------------------------------------------------------------------------
+static int CeedOperatorFirstTouchInputs_Opt(CeedOperator op,
+    CeedInt blk_size) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  bool is_numa_aware;
+  ierr = CeedIsNumaAware(ceed, &is_numa_aware); CeedChkBackend(ierr);
+  CeedInt num_elem, num_threads, num_input_fields;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+  ierr = CeedGetNumThreads(ceed, &num_threads); CeedChkBackend(ierr);
+  const CeedInt num_blks = (num_elem/blk_size) + !!(num_elem%blk_size);
+  if (!is_numa_aware || num_threads < 2 || num_blks < 2)
+    return CEED_ERROR_SUCCESS;
+  CeedOperatorField *op_input_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, NULL,
+                               NULL); CeedChkBackend(ierr);
+  CeedOperatorFirstTouchCtx_Opt touch_ctx = {.num_fields = num_input_fields,
+                                             .num_blks = num_blks
+                                            };
+  CeedVector vec;
+  CeedInt length;
+
+  touch_ctx.num_tasks = CeedIntMin(num_threads, num_blks);
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (!impl->e_vecs_full[i] || vec == CEED_VECTOR_ACTIVE) continue;
+    ierr = CeedVectorGetLength(impl->e_vecs_full[i], &length);
+    CeedChkBackend(ierr);
+    touch_ctx.blk_lengths[i] = length / num_blks;
+    ierr = CeedMalloc(length, &touch_ctx.arrays[i]); CeedChkBackend(ierr);
+  }
+  int ierr2 = CeedParallelFor(ceed, touch_ctx.num_tasks,
+                              CeedOperatorFirstTouchTask_Opt, &touch_ctx);
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    if (!touch_ctx.arrays[i]) continue;
+    if (ierr2) {
+      ierr = CeedFree(&touch_ctx.arrays[i]); CeedChkBackend(ierr);
+    } else {
+      ierr = CeedVectorSetArray(impl->e_vecs_full[i], CEED_MEM_HOST,
+                                CEED_OWN_POINTER, touch_ctx.arrays[i]);
+      CeedChkBackend(ierr);
+    }
+  }
+  CeedChkBackend(ierr2);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -209,6 +303,15 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
     }
   }
 
+  // Fields for dot products fused with the output restriction
+  ierr = CeedOperatorSetupDotFields_Opt(num_input_fields, op_input_fields,
+                                        num_output_fields, op_output_fields,
+                                        &impl->dot_in_field, &impl->dot_out_field);
+  CeedChkBackend(ierr);
+
+  // Place passive input E-vectors with the threads that read them
+  ierr = CeedOperatorFirstTouchInputs_Opt(op, blk_size); CeedChkBackend(ierr);
+
   ierr = CeedOperatorSetSetupDone(op); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
@@ -239,7 +342,8 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields,
         ierr = CeedVectorGetState(vec, &state); CeedChkBackend(ierr);
         if (state != impl->input_states[i]) {
           ierr = CeedElemRestrictionApply(impl->blk_restr[i], CEED_NOTRANSPOSE,
-                                          vec, impl->e_vecs_full[i], request);
+                                          vec, impl->e_vecs_full[i],
+                                          CEED_REQUEST_IMMEDIATE);
           CeedChkBackend(ierr);
           impl->input_states[i] = state;
         }
@@ -272,9 +376,9 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
     CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
     CeedInt num_input_fields, CeedInt blk_size, CeedVector in_vec, bool skip_active,
     CeedScalar *e_data[2*CEED_FIELD_MAX], CeedOperator_Opt *impl,
-    CeedRequest *request) {
+    CeedVector *e_vecs_in, CeedVector *q_vecs_in, CeedRequest *request) {
   CeedInt ierr;
-  CeedInt dim, elem_size, size;
+  CeedInt dim, Q_comp, elem_size, size;
   CeedElemRestriction elem_restr;
   CeedEvalMode eval_mode;
   CeedBasis basis;
@@ -303,7 +407,8 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
     if (vec == CEED_VECTOR_ACTIVE) {
       ierr = CeedElemRestrictionApplyBlock(impl->blk_restr[i], e/blk_size,
                                            CEED_NOTRANSPOSE, in_vec,
-                                           impl->e_vecs_in[i], request);
+                                           e_vecs_in[i],
+                                           CEED_REQUEST_IMMEDIATE);
       CeedChkBackend(ierr);
       active_in = 1;
     }
@@ -311,7 +416,7 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
     switch(eval_mode) {
     case CEED_EVAL_NONE:
       if (!active_in) {
-        ierr = CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST,
+        ierr = CeedVectorSetArray(q_vecs_in[i], CEED_MEM_HOST,
                                   CEED_USE_POINTER, &e_data[i][e*Q*size]);
         CeedChkBackend(ierr);
       }
@@ -320,32 +425,46 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
       ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
       CeedChkBackend(ierr);
       if (!active_in) {
-        ierr = CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST,
-                                  CEED_USE_POINTER, &e_data[i][e*elem_size*size]);
+        ierr = CeedBasisGetNumQuadratureComponents(basis, &Q_comp);
+        CeedChkBackend(ierr);
+        ierr = CeedVectorSetArray(e_vecs_in[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER,
+                                  &e_data[i][e*elem_size*size/Q_comp]);
         CeedChkBackend(ierr);
       }
       ierr = CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE,
-                            CEED_EVAL_INTERP, impl->e_vecs_in[i],
-                            impl->q_vecs_in[i]); CeedChkBackend(ierr);
+                            CEED_EVAL_INTERP, e_vecs_in[i],
+                            q_vecs_in[i]); CeedChkBackend(ierr);
       break;
     case CEED_EVAL_GRAD:
       ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
       CeedChkBackend(ierr);
       if (!active_in) {
         ierr = CeedBasisGetDimension(basis, &dim); CeedChkBackend(ierr);
-        ierr = CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST,
+        ierr = CeedVectorSetArray(e_vecs_in[i], CEED_MEM_HOST,
                                   CEED_USE_POINTER,
                                   &e_data[i][e*elem_size*size/dim]);
         CeedChkBackend(ierr);
       }
       ierr = CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE,
-                            CEED_EVAL_GRAD, impl->e_vecs_in[i],
-                            impl->q_vecs_in[i]); CeedChkBackend(ierr);
+                            CEED_EVAL_GRAD, e_vecs_in[i],
+                            q_vecs_in[i]); CeedChkBackend(ierr);
+      break;
+    case CEED_EVAL_DIV:
+      ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
+      CeedChkBackend(ierr);
+      if (!active_in) {
+        ierr = CeedVectorSetArray(e_vecs_in[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER, &e_data[i][e*elem_size*size]);
+        CeedChkBackend(ierr);
+      }
+      ierr = CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE,
+                            CEED_EVAL_DIV, e_vecs_in[i],
+                            q_vecs_in[i]); CeedChkBackend(ierr);
       break;
     case CEED_EVAL_WEIGHT:
       break;  // No action
     // LCOV_EXCL_START
-    case CEED_EVAL_DIV:
     case CEED_EVAL_CURL: {
       ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
       CeedChkBackend(ierr);
@@ -360,13 +479,89 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Zero Element Lanes of a Block Evec Outside of [lane_start, lane_end)
+//------------------------------------------------------------------------------
+static inline int CeedOperatorMaskBlock_Opt(CeedElemRestriction blk_restr,
+    CeedInt lane_start, CeedInt lane_end, CeedVector e_vec) {
+  int ierr;
+  CeedInt blk_size, elem_size, num_comp;
+  ierr = CeedElemRestrictionGetBlockSize(blk_restr, &blk_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(blk_restr, &elem_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(blk_restr, &num_comp);
+  CeedChkBackend(ierr);
+  CeedScalar *e_data;
+
+  ierr = CeedVectorGetArray(e_vec, CEED_MEM_HOST, &e_data); CeedChkBackend(ierr);
+  for (CeedInt i=0; i<elem_size*num_comp; i++)
+    for (CeedInt j=0; j<blk_size; j++)
+      if (j < lane_start || j >= lane_end)
+        e_data[i*blk_size + j] = 0.0;
+  ierr = CeedVectorRestoreArray(e_vec, &e_data); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Add Dot Product of Element Lanes [lane_start, lane_end) of Two Block Evecs
+//------------------------------------------------------------------------------
+static inline int CeedOperatorDotBlock_Opt(CeedElemRestriction blk_restr,
+    CeedInt lane_start, CeedInt lane_end, CeedVector u, CeedVector v,
+    CeedScalar *dot) {
+  int ierr;
+  CeedInt blk_size, elem_size, num_comp;
+  ierr = CeedElemRestrictionGetBlockSize(blk_restr, &blk_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(blk_restr, &elem_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(blk_restr, &num_comp);
+  CeedChkBackend(ierr);
+  const CeedScalar *u_data, *v_data;
+  CeedScalar sum = 0.0;
+
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_data); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_data); CeedChkBackend(ierr);
+  for (CeedInt i=0; i<elem_size*num_comp; i++)
+    for (CeedInt j=lane_start; j<lane_end; j++)
+      sum += u_data[i*blk_size + j]*v_data[i*blk_size + j];
+  *dot += sum;
+  ierr = CeedVectorRestoreArrayRead(u, &u_data); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArrayRead(v, &v_data); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Zero the L-vector Entries of One Segment of the First Write Lists
+//------------------------------------------------------------------------------
+static inline int CeedOperatorZeroEntries_Opt(const CeedInt *zero_offsets,
+    const CeedInt *zero_indices, CeedInt segment, bool is_write,
+    CeedVector vec) {
+  int ierr;
+  CeedScalar *array;
+
+  if (is_write) {
+    ierr = CeedVectorGetArrayWrite(vec, CEED_MEM_HOST, &array);
+    CeedChkBackend(ierr);
+  } else {
+    ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChkBackend(ierr);
+  }
+  for (CeedInt i=zero_offsets[segment]; i<zero_offsets[segment+1]; i++)
+    array[zero_indices[i]] = 0.0;
+  ierr = CeedVectorRestoreArray(vec, &array); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
 static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q,
     CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
-    CeedInt blk_size, CeedInt num_input_fields, CeedInt num_output_fields,
+    CeedInt blk_size, CeedInt lane_start, CeedInt lane_end,
+    CeedInt num_input_fields, CeedInt num_output_fields,
     CeedOperator op, CeedVector out_vec, CeedOperator_Opt *impl,
+    CeedVector *e_vecs_in, CeedVector *e_vecs_out, CeedVector *q_vecs_out,
+    CeedVector *out_vecs, bool is_overwrite, CeedScalar *dot,
     CeedRequest *request) {
   CeedInt ierr;
   CeedElemRestriction elem_restr;
@@ -388,15 +583,22 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q,
       ierr = CeedOperatorFieldGetBasis(op_output_fields[i], &basis);
       CeedChkBackend(ierr);
       ierr = CeedBasisApply(basis, blk_size, CEED_TRANSPOSE,
-                            CEED_EVAL_INTERP, impl->q_vecs_out[i],
-                            impl->e_vecs_out[i]); CeedChkBackend(ierr);
+                            CEED_EVAL_INTERP, q_vecs_out[i],
+                            e_vecs_out[i]); CeedChkBackend(ierr);
       break;
     case CEED_EVAL_GRAD:
       ierr = CeedOperatorFieldGetBasis(op_output_fields[i], &basis);
       CeedChkBackend(ierr);
       ierr = CeedBasisApply(basis, blk_size, CEED_TRANSPOSE,
-                            CEED_EVAL_GRAD, impl->q_vecs_out[i],
-                            impl->e_vecs_out[i]); CeedChkBackend(ierr);
+                            CEED_EVAL_GRAD, q_vecs_out[i],
+                            e_vecs_out[i]); CeedChkBackend(ierr);
+      break;
+    case CEED_EVAL_DIV:
+      ierr = CeedOperatorFieldGetBasis(op_output_fields[i], &basis);
+      CeedChkBackend(ierr);
+      ierr = CeedBasisApply(basis, blk_size, CEED_TRANSPOSE,
+                            CEED_EVAL_DIV, q_vecs_out[i],
+                            e_vecs_out[i]); CeedChkBackend(ierr);
       break;
     // LCOV_EXCL_START
     case CEED_EVAL_WEIGHT: {
@@ -406,7 +608,6 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q,
                        "CEED_EVAL_WEIGHT cannot be an output "
                        "evaluation mode");
     }
-    case CEED_EVAL_DIV:
     case CEED_EVAL_CURL: {
       Ceed ceed;
       ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
@@ -415,16 +616,42 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q,
       // LCOV_EXCL_STOP
     }
     }
+    // Zero elements of the block outside of the applied range
+    if (lane_start > 0 || lane_end < blk_size) {
+      ierr = CeedOperatorMaskBlock_Opt(impl->blk_restr[i+impl->num_inputs],
+                                       lane_start, lane_end, e_vecs_out[i]);
+      CeedChkBackend(ierr);
+    }
+    // Dot product with the active input while the block is in cache
+    if (dot && i == impl->dot_out_field) {
+      CeedInt num_elem;
+      ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+      ierr = CeedOperatorDotBlock_Opt(impl->blk_restr[i+impl->num_inputs],
+                                      lane_start, CeedIntMin(lane_end, num_elem - e),
+                                      e_vecs_in[impl->dot_in_field], e_vecs_out[i],
+                                      dot); CeedChkBackend(ierr);
+    }
     // Restrict output block
     // Get output vector
-    ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
-    CeedChkBackend(ierr);
-    if (vec == CEED_VECTOR_ACTIVE)
-      vec = out_vec;
+    if (out_vecs) {
+      vec = out_vecs[i];
+    } else {
+      ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
+      CeedChkBackend(ierr);
+      if (vec == CEED_VECTOR_ACTIVE)
+        vec = out_vec;
+    }
+    // Zero the output entries this block writes first
+    if (is_overwrite && impl->zero_offsets[i]) {
+      ierr = CeedOperatorZeroEntries_Opt(impl->zero_offsets[i],
+                                         impl->zero_indices[i], e/blk_size + 1,
+                                         false, vec); CeedChkBackend(ierr);
+    }
     // Restrict
     ierr = CeedElemRestrictionApplyBlock(impl->blk_restr[i+impl->num_inputs],
                                          e/blk_size, CEED_TRANSPOSE,
-                                         impl->e_vecs_out[i], vec, request);
+                                         e_vecs_out[i], vec,
+                                         CEED_REQUEST_IMMEDIATE);
     CeedChkBackend(ierr);
   }
   return CEED_ERROR_SUCCESS;
@@ -455,10 +682,750 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Destroy Thread Task Scratch
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec,
-                                    CeedVector out_vec, CeedRequest *request) {
+static int CeedOperatorDestroyTasks_Opt(CeedOperator_Opt *impl) {
+  int ierr;
+
+  for (CeedInt t=0; t<impl->num_tasks; t++) {
+    CeedOperatorThread_Opt *task = &impl->tasks[t];
+    ierr = CeedVectorDestroy(&task->in_vec); CeedChkBackend(ierr);
+    for (CeedInt i=0; i<impl->num_inputs; i++) {
+      ierr = CeedVectorDestroy(&task->e_vecs_in[i]); CeedChkBackend(ierr);
+      ierr = CeedVectorDestroy(&task->q_vecs_in[i]); CeedChkBackend(ierr);
+    }
+    for (CeedInt i=0; i<impl->num_outputs; i++) {
+      ierr = CeedVectorDestroy(&task->e_vecs_out[i]); CeedChkBackend(ierr);
+      ierr = CeedVectorDestroy(&task->q_vecs_out[i]); CeedChkBackend(ierr);
+      ierr = CeedVectorDestroy(&task->out_vecs[i]); CeedChkBackend(ierr);
+    }
+    ierr = CeedFree(&task->e_vecs_in); CeedChkBackend(ierr);
+    ierr = CeedFree(&task->e_vecs_out); CeedChkBackend(ierr);
+    ierr = CeedFree(&task->q_vecs_in); CeedChkBackend(ierr);
+    ierr = CeedFree(&task->q_vecs_out); CeedChkBackend(ierr);
+    ierr = CeedFree(&task->out_vecs); CeedChkBackend(ierr);
+  }
+  ierr = CeedFree(&impl->tasks); CeedChkBackend(ierr);
+  impl->num_tasks = 0;
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Thread Task Scratch Setup Context
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedOperator_Opt *impl;
+  CeedInt num_input_fields, num_output_fields;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedOperatorField *op_input_fields;
+  const CeedScalar *weights[CEED_FIELD_MAX];
+} CeedOperatorSetupTaskCtx_Opt;
+
+//------------------------------------------------------------------------------
+// Setup Scratch Arrays of One Task
+//   Run on the thread that later runs the task, which first touches the arrays
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupTaskArrays_Opt(void *ctx, CeedInt t,
+    CeedInt thread) {
+  int ierr;
+  CeedOperatorSetupTaskCtx_Opt *setup_ctx = ctx;
+  CeedOperatorThread_Opt *task = &setup_ctx->impl->tasks[t];
+  CeedEvalMode eval_mode;
+  CeedVector vec;
+  CeedScalar *array;
+
+  // Infields
+  for (CeedInt i=0; i<setup_ctx->num_input_fields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(setup_ctx->qf_input_fields[i],
+                                         &eval_mode); CeedChkBackend(ierr);
+    ierr = CeedOperatorFieldGetVector(setup_ctx->op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (task->e_vecs_in[i]) {
+      ierr = CeedVectorSetArray(task->e_vecs_in[i], CEED_MEM_HOST,
+                                CEED_COPY_VALUES, NULL); CeedChkBackend(ierr);
+    }
+    if (eval_mode == CEED_EVAL_WEIGHT) {
+      // Copy quadrature weights
+      ierr = CeedVectorSetArray(task->q_vecs_in[i], CEED_MEM_HOST,
+                                CEED_COPY_VALUES,
+                                (CeedScalar *)setup_ctx->weights[i]);
+      CeedChkBackend(ierr);
+    } else if (vec == CEED_VECTOR_ACTIVE && eval_mode == CEED_EVAL_NONE) {
+      // Set Qvec for CEED_EVAL_NONE
+      ierr = CeedVectorGetArray(task->e_vecs_in[i], CEED_MEM_HOST, &array);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorSetArray(task->q_vecs_in[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, array); CeedChkBackend(ierr);
+      ierr = CeedVectorRestoreArray(task->e_vecs_in[i], &array);
+      CeedChkBackend(ierr);
+    }
+  }
+
+  // Outfields
+  for (CeedInt i=0; i<setup_ctx->num_output_fields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(setup_ctx->qf_output_fields[i],
+                                         &eval_mode); CeedChkBackend(ierr);
+    // Set Qvec for CEED_EVAL_NONE
+    if (eval_mode == CEED_EVAL_NONE) {
+      ierr = CeedVectorGetArrayWrite(task->e_vecs_out[i], CEED_MEM_HOST, &array);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorSetArray(task->q_vecs_out[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, array); CeedChkBackend(ierr);
+      ierr = CeedVectorRestoreArray(task->e_vecs_out[i], &array);
+      CeedChkBackend(ierr);
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Thread Task Scratch
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupTasks_Opt(CeedOperator op, CeedInt num_tasks) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  if (impl->num_tasks == num_tasks) return CEED_ERROR_SUCCESS;
+  ierr = CeedOperatorDestroyTasks_Opt(impl); CeedChkBackend(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChkBackend(ierr);
+  CeedInt num_input_fields, num_output_fields;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields,
+                               &num_output_fields, &op_output_fields);
+  CeedChkBackend(ierr);
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL,
+                                &qf_output_fields);
+  CeedChkBackend(ierr);
+  CeedOperatorSetupTaskCtx_Opt setup_ctx = {.impl = impl,
+                                            .num_input_fields = num_input_fields,
+                                            .num_output_fields = num_output_fields,
+                                            .qf_input_fields = qf_input_fields,
+                                            .qf_output_fields = qf_output_fields,
+                                            .op_input_fields = op_input_fields
+                                           };
+  CeedEvalMode eval_mode;
+  CeedVector vec, vec_j;
+  CeedInt length;
+
+  ierr = CeedCalloc(num_tasks, &impl->tasks); CeedChkBackend(ierr);
+  impl->num_tasks = num_tasks;
+  for (CeedInt t=0; t<num_tasks; t++) {
+    CeedOperatorThread_Opt *task = &impl->tasks[t];
+    ierr = CeedCalloc(CEED_FIELD_MAX, &task->e_vecs_in); CeedChkBackend(ierr);
+    ierr = CeedCalloc(CEED_FIELD_MAX, &task->e_vecs_out); CeedChkBackend(ierr);
+    ierr = CeedCalloc(CEED_FIELD_MAX, &task->q_vecs_in); CeedChkBackend(ierr);
+    ierr = CeedCalloc(CEED_FIELD_MAX, &task->q_vecs_out); CeedChkBackend(ierr);
+    ierr = CeedCalloc(CEED_FIELD_MAX, &task->out_vecs); CeedChkBackend(ierr);
+
+    // Infields
+    for (CeedInt i=0; i<num_input_fields; i++) {
+      ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
+      CeedChkBackend(ierr);
+      ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+      CeedChkBackend(ierr);
+      if (impl->e_vecs_in[i]) {
+        ierr = CeedVectorGetLength(impl->e_vecs_in[i], &length);
+        CeedChkBackend(ierr);
+        ierr = CeedVectorCreate(ceed, length, &task->e_vecs_in[i]);
+        CeedChkBackend(ierr);
+      }
+      if (impl->q_vecs_in[i]) {
+        ierr = CeedVectorGetLength(impl->q_vecs_in[i], &length);
+        CeedChkBackend(ierr);
+        ierr = CeedVectorCreate(ceed, length, &task->q_vecs_in[i]);
+        CeedChkBackend(ierr);
+      }
+      // View of active input
+      if (eval_mode != CEED_EVAL_WEIGHT && vec == CEED_VECTOR_ACTIVE &&
+          !task->in_vec) {
+        ierr = CeedElemRestrictionGetLVectorSize(impl->blk_restr[i], &length);
+        CeedChkBackend(ierr);
+        ierr = CeedVectorCreate(ceed, length, &task->in_vec);
+        CeedChkBackend(ierr);
+      }
+    }
+
+    // Identity QFunctions
+    if (impl->is_identity_qf) {
+      task->q_vecs_out[0] = task->q_vecs_in[0];
+      ierr = CeedVectorAddReference(task->q_vecs_in[0]); CeedChkBackend(ierr);
+    }
+
+    // Outfields
+    for (CeedInt i=0; i<num_output_fields; i++) {
+      ierr = CeedVectorGetLength(impl->e_vecs_out[i], &length);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorCreate(ceed, length, &task->e_vecs_out[i]);
+      CeedChkBackend(ierr);
+      if (!task->q_vecs_out[i]) {
+        ierr = CeedVectorGetLength(impl->q_vecs_out[i], &length);
+        CeedChkBackend(ierr);
+        ierr = CeedVectorCreate(ceed, length, &task->q_vecs_out[i]);
+        CeedChkBackend(ierr);
+      }
+      // Private accumulator, shared by fields with the same output vector
+      ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
+      CeedChkBackend(ierr);
+      for (CeedInt j=0; j<i && !task->out_vecs[i]; j++) {
+        ierr = CeedOperatorFieldGetVector(op_output_fields[j], &vec_j);
+        CeedChkBackend(ierr);
+        if (vec_j == vec) {
+          task->out_vecs[i] = task->out_vecs[j];
+          ierr = CeedVectorAddReference(task->out_vecs[j]); CeedChkBackend(ierr);
+        }
+      }
+      if (!task->out_vecs[i]) {
+        ierr = CeedElemRestrictionGetLVectorSize(
+                 impl->blk_restr[num_input_fields + i], &length);
+        CeedChkBackend(ierr);
+        ierr = CeedVectorCreate(ceed, length, &task->out_vecs[i]);
+        CeedChkBackend(ierr);
+      }
+    }
+  }
+
+  // Scratch arrays, set by each task with the thread split of the apply, so
+  //   NUMA aware threads first touch their own scratch; private accumulators
+  //   are first touched when the apply zeros them
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
+    CeedChkBackend(ierr);
+    if (eval_mode == CEED_EVAL_WEIGHT) {
+      ierr = CeedVectorGetArrayRead(impl->q_vecs_in[i], CEED_MEM_HOST,
+                                    &setup_ctx.weights[i]); CeedChkBackend(ierr);
+    }
+  }
+  ierr = CeedParallelFor(ceed, num_tasks, CeedOperatorSetupTaskArrays_Opt,
+                         &setup_ctx); CeedChkBackend(ierr);
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    if (setup_ctx.weights[i]) {
+      ierr = CeedVectorRestoreArrayRead(impl->q_vecs_in[i], &setup_ctx.weights[i]);
+      CeedChkBackend(ierr);
+    }
+  }
+
+  // Color element blocks if all output restrictions with offsets are the same,
+  //   otherwise sum private accumulators
+  CeedElemRestriction rstr, offsets_rstr = NULL;
+  CeedInt color_field = 0;
+  bool is_strided, use_coloring = true;
+  for (CeedInt i=0; i<num_output_fields; i++) {
+    ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[i], &rstr);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionIsStrided(rstr, &is_strided); CeedChkBackend(ierr);
+    if (is_strided) continue;
+    if (!offsets_rstr) {
+      offsets_rstr = rstr;
+      color_field = i;
+    } else if (rstr != offsets_rstr) {
+      use_coloring = false;
+    }
+  }
+  impl->color_offsets = NULL;
+  if (use_coloring) {
+    ierr = CeedElemRestrictionGetColoring(
+             impl->blk_restr[num_input_fields + color_field], &impl->num_colors,
+             &impl->color_offsets, &impl->color_blocks);
+    CeedChkBackend(ierr);
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Destroy First Write Lists
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyFirstWrites_Opt(CeedOperator_Opt *impl) {
+  int ierr;
+
+  if (!impl->zero_offsets) return CEED_ERROR_SUCCESS;
+  for (CeedInt i=0; i<impl->num_outputs; i++) {
+    ierr = CeedFree(&impl->zero_offsets[i]); CeedChkBackend(ierr);
+    ierr = CeedFree(&impl->zero_indices[i]); CeedChkBackend(ierr);
+  }
+  ierr = CeedFree(&impl->zero_offsets); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->zero_indices); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup First Write Lists
+//   For each output field with its own output vector, list the L-vector
+//   entries written by no element block, then the entries first written by
+//   each block when blocks are applied in natural or color order. Zeroing
+//   these entries just before the block scatter replaces zeroing the output.
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFirstWrites_Opt(CeedOperator op, bool is_colored) {
+  int ierr;
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  if (impl->zero_offsets && impl->is_zero_colored == is_colored)
+    return CEED_ERROR_SUCCESS;
+  ierr = CeedOperatorDestroyFirstWrites_Opt(impl); CeedChkBackend(ierr);
+  CeedInt num_input_fields, num_output_fields;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields,
+                               &num_output_fields, &op_output_fields);
+  CeedChkBackend(ierr);
+  CeedVector vec, vec_j;
+
+  ierr = CeedCalloc(num_output_fields, &impl->zero_offsets); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_output_fields, &impl->zero_indices); CeedChkBackend(ierr);
+  impl->is_zero_colored = is_colored;
+  for (CeedInt i=0; i<num_output_fields; i++) {
+    // Skip fields sharing an output vector
+    bool is_shared = false;
+    ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
+    CeedChkBackend(ierr);
+    for (CeedInt j=0; j<num_output_fields; j++) {
+      ierr = CeedOperatorFieldGetVector(op_output_fields[j], &vec_j);
+      CeedChkBackend(ierr);
+      is_shared = is_shared || (j != i && vec_j == vec);
+    }
+    if (is_shared) continue;
+
+    CeedElemRestriction blk_restr = impl->blk_restr[num_input_fields + i];
+    CeedInt num_elem, elem_size, blk_size, num_blk, num_comp, comp_stride,
+            l_size, strides[3];
+    ierr = CeedElemRestrictionGetNumElements(blk_restr, &num_elem);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetElementSize(blk_restr, &elem_size);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetBlockSize(blk_restr, &blk_size);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetNumBlocks(blk_restr, &num_blk);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(blk_restr, &num_comp);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetCompStride(blk_restr, &comp_stride);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetLVectorSize(blk_restr, &l_size);
+    CeedChkBackend(ierr);
+    bool is_strided, has_backend_strides = false;
+    const CeedInt *offsets = NULL;
+    ierr = CeedElemRestrictionIsStrided(blk_restr, &is_strided);
+    CeedChkBackend(ierr);
+    if (is_strided) {
+      ierr = CeedElemRestrictionHasBackendStrides(blk_restr, &has_backend_strides);
+      CeedChkBackend(ierr);
+      if (has_backend_strides) {
+        strides[0] = 1;
+        strides[1] = elem_size;
+        strides[2] = elem_size*num_comp;
+      } else {
+        ierr = CeedElemRestrictionGetStrides(blk_restr, &strides);
+        CeedChkBackend(ierr);
+      }
+    } else {
+      ierr = CeedElemRestrictionGetOffsets(blk_restr, CEED_MEM_HOST, &offsets);
+      CeedChkBackend(ierr);
+    }
+
+    // Block of the first write of each entry, -1 if none
+    CeedInt *first_blk, *next;
+    ierr = CeedMalloc(l_size, &first_blk); CeedChkBackend(ierr);
+    for (CeedInt l=0; l<l_size; l++)
+      first_blk[l] = -1;
+    for (CeedInt p=0; p<num_blk; p++) {
+      const CeedInt b = is_colored ? impl->color_blocks[p] : p;
+      for (CeedInt j=0; j<CeedIntMin(blk_size, num_elem - b*blk_size); j++)
+        for (CeedInt k=0; k<num_comp; k++)
+          for (CeedInt n=0; n<elem_size; n++) {
+            const CeedInt e = b*blk_size + j,
+                          l = is_strided ?
+                              n*strides[0] + k*strides[1] + e*strides[2] :
+                              offsets[(b*elem_size + n)*blk_size + j] +
+                              k*comp_stride;
+            if (first_blk[l] < 0) first_blk[l] = b;
+          }
+    }
+    if (offsets) {
+      ierr = CeedElemRestrictionRestoreOffsets(blk_restr, &offsets);
+      CeedChkBackend(ierr);
+    }
+
+    // Entries by segment, unwritten entries first
+    ierr = CeedCalloc(num_blk + 2, &impl->zero_offsets[i]); CeedChkBackend(ierr);
+    ierr = CeedMalloc(l_size, &impl->zero_indices[i]); CeedChkBackend(ierr);
+    for (CeedInt l=0; l<l_size; l++)
+      impl->zero_offsets[i][first_blk[l] + 2]++;
+    for (CeedInt s=0; s<num_blk; s++)
+      impl->zero_offsets[i][s + 2] += impl->zero_offsets[i][s + 1];
+    ierr = CeedMalloc(num_blk + 1, &next); CeedChkBackend(ierr);
+    memcpy(next, impl->zero_offsets[i], (num_blk + 1) * sizeof(next[0]));
+    for (CeedInt l=0; l<l_size; l++)
+      impl->zero_indices[i][next[first_blk[l] + 1]++] = l;
+    ierr = CeedFree(&next); CeedChkBackend(ierr);
+    ierr = CeedFree(&first_blk); CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Prepare Output Vectors to be Overwritten
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupOverwrite_Opt(CeedOperator op, bool is_colored,
+    CeedVector out_vec) {
+  int ierr;
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedInt num_input_fields, num_output_fields;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields,
+                               &num_output_fields, &op_output_fields);
+  CeedChkBackend(ierr);
+  CeedVector vec, vec_j;
+
+  ierr = CeedOperatorSetupFirstWrites_Opt(op, is_colored); CeedChkBackend(ierr);
+  for (CeedInt i=0; i<num_output_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (impl->zero_offsets[i]) {
+      // Zero entries no block writes
+      ierr = CeedOperatorZeroEntries_Opt(impl->zero_offsets[i],
+                                         impl->zero_indices[i], 0, true,
+                                         vec == CEED_VECTOR_ACTIVE ? out_vec : vec);
+      CeedChkBackend(ierr);
+    } else {
+      // Zero shared output vectors once
+      bool is_first = true;
+      for (CeedInt j=0; j<i; j++) {
+        ierr = CeedOperatorFieldGetVector(op_output_fields[j], &vec_j);
+        CeedChkBackend(ierr);
+        is_first = is_first && vec_j != vec;
+      }
+      if (is_first) {
+        ierr = CeedVectorSetValue(vec == CEED_VECTOR_ACTIVE ? out_vec : vec, 0.0);
+        CeedChkBackend(ierr);
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Ahead of Apply
+//   Completes the setup an apply would do lazily, including the thread tasks
+//   and first write lists, so a queued apply only reads shared restrictions
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupApply_Opt(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  Ceed_Opt *ceed_impl;
+  ierr = CeedGetData(ceed, &ceed_impl); CeedChkBackend(ierr);
+  const CeedInt blk_size = ceed_impl->blk_size;
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedInt num_elem, num_threads;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+  ierr = CeedGetNumThreads(ceed, &num_threads); CeedChkBackend(ierr);
+  const CeedInt num_blks = (num_elem/blk_size) + !!(num_elem%blk_size);
+
+  ierr = CeedOperatorSetup_Opt(op); CeedChkBackend(ierr);
+  if (impl->is_identity_restr_op) return CEED_ERROR_SUCCESS;
+  if (num_threads > 1 && num_blks > 1) {
+    ierr = CeedOperatorSetupTasks_Opt(op, CeedIntMin(num_threads, num_blks));
+    CeedChkBackend(ierr);
+    if (impl->color_offsets) {
+      ierr = CeedOperatorSetupFirstWrites_Opt(op, true); CeedChkBackend(ierr);
+    }
+  } else {
+    ierr = CeedOperatorSetupFirstWrites_Opt(op, false); CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Thread Task Context
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedOperator op;
+  CeedOperator_Opt *impl;
+  CeedQFunction qf;
+  CeedInt Q, blk_size, num_blks, num_tasks;
+  const CeedInt *blocks;
+  CeedInt num_input_fields, num_output_fields;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  CeedScalar **e_data;
+  CeedScalar *dots;
+  bool is_overwrite;
+} CeedOperatorTaskCtx_Opt;
+
+//------------------------------------------------------------------------------
+// Apply Operator on One Range of Element Blocks
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyTask_Opt(void *ctx, CeedInt t, CeedInt thread) {
+  int ierr;
+  CeedOperatorTaskCtx_Opt *task_ctx = ctx;
+  CeedOperator_Opt *impl = task_ctx->impl;
+  CeedOperatorThread_Opt *task = &impl->tasks[t];
+  const CeedInt Q = task_ctx->Q, blk_size = task_ctx->blk_size;
+  const CeedInt num_input_fields = task_ctx->num_input_fields,
+                num_output_fields = task_ctx->num_output_fields;
+  const CeedInt first_blk = (task_ctx->num_blks*t) / task_ctx->num_tasks,
+                last_blk = (task_ctx->num_blks*(t+1)) / task_ctx->num_tasks;
+
+  // Zero private accumulators
+  if (!task_ctx->blocks) {
+    for (CeedInt i=0; i<num_output_fields; i++) {
+      ierr = CeedVectorSetValue(task->out_vecs[i], 0.0); CeedChkBackend(ierr);
+    }
+  }
+
+  // Loop through element blocks
+  for (CeedInt b=first_blk; b<last_blk; b++) {
+    const CeedInt e = (task_ctx->blocks ? task_ctx->blocks[b] : b)*blk_size;
+
+    // Input basis apply
+    ierr = CeedOperatorInputBasis_Opt(e, Q, task_ctx->qf_input_fields,
+                                      task_ctx->op_input_fields,
+                                      num_input_fields, blk_size, task->in_vec,
+                                      false, task_ctx->e_data, impl,
+                                      task->e_vecs_in, task->q_vecs_in,
+                                      CEED_REQUEST_IMMEDIATE);
+    CeedChkBackend(ierr);
+
+    // Q function
+    if (!impl->is_identity_qf) {
+      ierr = CeedQFunctionApply(task_ctx->qf, Q*blk_size, task->q_vecs_in,
+                                task->q_vecs_out); CeedChkBackend(ierr);
+    }
+
+    // Output basis apply and restrict
+    ierr = CeedOperatorOutputBasis_Opt(e, Q, task_ctx->qf_output_fields,
+                                       task_ctx->op_output_fields, blk_size,
+                                       0, blk_size, num_input_fields,
+                                       num_output_fields,
+                                       task_ctx->op, NULL, impl,
+                                       task->e_vecs_in, task->e_vecs_out,
+                                       task->q_vecs_out, task->out_vecs,
+                                       task_ctx->is_overwrite,
+                                       task_ctx->dots ? &task_ctx->dots[t] : NULL,
+                                       CEED_REQUEST_IMMEDIATE);
+    CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Accumulator Reduction Context
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedScalar *out;
+  const CeedScalar **acc;
+  CeedInt num_acc, length, chunk;
+  bool is_overwrite;
+} CeedOperatorReduceCtx_Opt;
+
+//------------------------------------------------------------------------------
+// Sum Private Accumulators on One Chunk of the Output
+//------------------------------------------------------------------------------
+static int CeedOperatorReduceTask_Opt(void *ctx, CeedInt t, CeedInt thread) {
+  CeedOperatorReduceCtx_Opt *reduce = ctx;
+  const CeedInt start = t*reduce->chunk,
+                stop = CeedIntMin(start + reduce->chunk, reduce->length);
+
+  // Overwrite with the first accumulator
+  if (reduce->is_overwrite) {
+    const CeedScalar *acc = reduce->acc[0];
+    CeedPragmaSIMD
+    for (CeedInt j=start; j<stop; j++)
+      reduce->out[j] = acc[j];
+  }
+
+  // Fixed task order keeps the sum deterministic
+  for (CeedInt a=reduce->is_overwrite ? 1 : 0; a<reduce->num_acc; a++) {
+    const CeedScalar *acc = reduce->acc[a];
+    CeedPragmaSIMD
+    for (CeedInt j=start; j<stop; j++)
+      reduce->out[j] += acc[j];
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get Output Vector of a Field, NULL if an Earlier Field Has the Same Vector
+//------------------------------------------------------------------------------
+static inline int CeedOperatorGetUniqueOutput_Opt(CeedOperator_Opt *impl,
+    CeedOperatorField *op_output_fields, CeedInt i, CeedVector out_vec,
+    CeedVector *vec) {
+  int ierr;
+
+  *vec = NULL;
+  for (CeedInt j=0; j<i; j++)
+    if (impl->tasks[0].out_vecs[j] == impl->tasks[0].out_vecs[i])
+      return CEED_ERROR_SUCCESS;
+  ierr = CeedOperatorFieldGetVector(op_output_fields[i], vec);
+  CeedChkBackend(ierr);
+  if (*vec == CEED_VECTOR_ACTIVE)
+    *vec = out_vec;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on Host Threads
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddTasks_Opt(CeedOperator op, CeedInt num_tasks,
+    bool is_add, CeedVector in_vec, CeedVector out_vec,
+    CeedScalar *e_data[2*CEED_FIELD_MAX], CeedScalar *dot, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  Ceed_Opt *ceed_impl;
+  ierr = CeedGetData(ceed, &ceed_impl); CeedChkBackend(ierr);
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChkBackend(ierr);
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+  CeedOperatorTaskCtx_Opt task_ctx = {.op = op, .impl = impl, .qf = qf,
+                                      .blk_size = ceed_impl->blk_size,
+                                      .num_tasks = num_tasks, .e_data = e_data
+                                     };
+  task_ctx.num_blks = (num_elem/task_ctx.blk_size) +
+                      !!(num_elem%task_ctx.blk_size);
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &task_ctx.Q);
+  CeedChkBackend(ierr);
+  ierr = CeedOperatorGetFields(op, &task_ctx.num_input_fields,
+                               &task_ctx.op_input_fields,
+                               &task_ctx.num_output_fields,
+                               &task_ctx.op_output_fields);
+  CeedChkBackend(ierr);
+  ierr = CeedQFunctionGetFields(qf, NULL, &task_ctx.qf_input_fields, NULL,
+                                &task_ctx.qf_output_fields);
+  CeedChkBackend(ierr);
+  const CeedScalar *in_array = NULL;
+  CeedScalar *out_arrays[CEED_FIELD_MAX];
+  CeedVector vec;
+
+  // Per task scratch
+  ierr = CeedOperatorSetupTasks_Opt(op, num_tasks); CeedChkBackend(ierr);
+  if (dot) {
+    ierr = CeedCalloc(num_tasks, &task_ctx.dots); CeedChkBackend(ierr);
+  }
+
+  // Colored blocks write directly into the outputs, zeroing entries on first
+  //   write, while accumulators overwrite the outputs in the reduction
+  if (!is_add && impl->color_offsets) {
+    ierr = CeedOperatorSetupOverwrite_Opt(op, true, out_vec); CeedChkBackend(ierr);
+    task_ctx.is_overwrite = true;
+  }
+
+  // Share active input array with task views
+  if (impl->tasks[0].in_vec) {
+    ierr = CeedVectorGetArrayRead(in_vec, CEED_MEM_HOST, &in_array);
+    CeedChkBackend(ierr);
+    for (CeedInt t=0; t<num_tasks; t++) {
+      ierr = CeedVectorSetArray(impl->tasks[t].in_vec, CEED_MEM_HOST,
+                                CEED_USE_POINTER, (CeedScalar *)in_array);
+      CeedChkBackend(ierr);
+    }
+  }
+
+  // Hold the context data, the QFunction applies of the tasks share the access
+  void *ctx_data;
+  ierr = CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data);
+  CeedChkBackend(ierr);
+  if (impl->color_offsets) {
+    // Share output arrays with task views
+    for (CeedInt i=0; i<task_ctx.num_output_fields; i++) {
+      ierr = CeedOperatorGetUniqueOutput_Opt(impl, task_ctx.op_output_fields, i,
+                                             out_vec, &vec); CeedChkBackend(ierr);
+      if (!vec) continue;
+      ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &out_arrays[i]);
+      CeedChkBackend(ierr);
+      for (CeedInt t=0; t<num_tasks; t++) {
+        ierr = CeedVectorSetArray(impl->tasks[t].out_vecs[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER, out_arrays[i]);
+        CeedChkBackend(ierr);
+      }
+    }
+
+    // Apply on element blocks of each color, which share no output nodes
+    for (CeedInt c=0; c<impl->num_colors; c++) {
+      task_ctx.blocks = &impl->color_blocks[impl->color_offsets[c]];
+      task_ctx.num_blks = impl->color_offsets[c+1] - impl->color_offsets[c];
+      task_ctx.num_tasks = CeedIntMin(num_tasks, task_ctx.num_blks);
+      ierr = CeedParallelFor(ceed, task_ctx.num_tasks, CeedOperatorApplyTask_Opt,
+                             &task_ctx); CeedChkBackend(ierr);
+    }
+
+    // Restore output arrays
+    for (CeedInt i=0; i<task_ctx.num_output_fields; i++) {
+      ierr = CeedOperatorGetUniqueOutput_Opt(impl, task_ctx.op_output_fields, i,
+                                             out_vec, &vec); CeedChkBackend(ierr);
+      if (!vec) continue;
+      ierr = CeedVectorRestoreArray(vec, &out_arrays[i]); CeedChkBackend(ierr);
+    }
+  } else {
+    // Apply on element block ranges
+    ierr = CeedParallelFor(ceed, num_tasks, CeedOperatorApplyTask_Opt,
+                           &task_ctx); CeedChkBackend(ierr);
+  }
+  ierr = CeedQFunctionRestoreContextData(qf, &ctx_data);
+  CeedChkBackend(ierr);
+  if (in_array) {
+    ierr = CeedVectorRestoreArrayRead(in_vec, &in_array); CeedChkBackend(ierr);
+  }
+  if (dot) {
+    // Fixed task order keeps the sum deterministic
+    for (CeedInt t=0; t<num_tasks; t++)
+      *dot += task_ctx.dots[t];
+    ierr = CeedFree(&task_ctx.dots); CeedChkBackend(ierr);
+  }
+  if (impl->color_offsets) return CEED_ERROR_SUCCESS;
+
+  // Sum private accumulators into output vectors
+  CeedOperatorReduceCtx_Opt reduce = {.num_acc = num_tasks,
+                                      .is_overwrite = !is_add
+                                     };
+  ierr = CeedCalloc(num_tasks, &reduce.acc); CeedChkBackend(ierr);
+  for (CeedInt i=0; i<task_ctx.num_output_fields; i++) {
+    ierr = CeedOperatorGetUniqueOutput_Opt(impl, task_ctx.op_output_fields, i,
+                                           out_vec, &vec); CeedChkBackend(ierr);
+    if (!vec) continue;
+    ierr = CeedVectorGetLength(vec, &reduce.length); CeedChkBackend(ierr);
+    reduce.chunk = (reduce.length + num_tasks - 1) / num_tasks;
+    if (is_add) {
+      ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &reduce.out);
+    } else {
+      ierr = CeedVectorGetArrayWrite(vec, CEED_MEM_HOST, &reduce.out);
+    }
+    CeedChkBackend(ierr);
+    for (CeedInt t=0; t<num_tasks; t++) {
+      ierr = CeedVectorGetArrayRead(impl->tasks[t].out_vecs[i], CEED_MEM_HOST,
+                                    &reduce.acc[t]); CeedChkBackend(ierr);
+    }
+    ierr = CeedParallelFor(ceed, (reduce.length + reduce.chunk - 1) / reduce.chunk,
+                           CeedOperatorReduceTask_Opt, &reduce);
+    CeedChkBackend(ierr);
+    for (CeedInt t=0; t<num_tasks; t++) {
+      ierr = CeedVectorRestoreArrayRead(impl->tasks[t].out_vecs[i],
+                                        &reduce.acc[t]); CeedChkBackend(ierr);
+    }
+    ierr = CeedVectorRestoreArray(vec, &reduce.out); CeedChkBackend(ierr);
+  }
+  ierr = CeedFree(&reduce.acc); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for operator apply on a range of elements, overwriting the outputs
+//   instead of summing into them if is_add is false
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddCore_Opt(CeedOperator op, CeedInt e_start,
+                                        CeedInt e_end, bool is_add,
+                                        CeedVector in_vec, CeedVector out_vec,
+                                        CeedScalar *dot, CeedRequest *request) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
@@ -483,17 +1450,33 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec,
   CeedChkBackend(ierr);
   CeedEvalMode eval_mode;
   CeedScalar *e_data[2*CEED_FIELD_MAX] = {0};
+  const bool is_full = e_start == 0 && e_end == num_elem;
+  const CeedInt first_blk = e_start/blk_size,
+                last_blk = (e_end/blk_size) + !!(e_end%blk_size);
 
   // Setup
   ierr = CeedOperatorSetup_Opt(op); CeedChkBackend(ierr);
 
   // Restriction only operator
   if (impl->is_identity_restr_op) {
-    for (CeedInt b=0; b<num_blks; b++) {
+    if (!is_add) {
+      ierr = CeedVectorSetValue(out_vec, 0.0); CeedChkBackend(ierr);
+    }
+    for (CeedInt b=first_blk; b<last_blk; b++) {
+      const CeedInt lane_start = CeedIntMax(e_start - b*blk_size, 0),
+                    lane_end = CeedIntMin(e_end - b*blk_size, blk_size);
       ierr = CeedElemRestrictionApplyBlock(impl->blk_restr[0], b, CEED_NOTRANSPOSE,
-                                           in_vec, impl->e_vecs_in[0], request); CeedChkBackend(ierr);
+                                           in_vec, impl->e_vecs_in[0],
+                                           CEED_REQUEST_IMMEDIATE);
+      CeedChkBackend(ierr);
+      if (!is_full && (lane_start > 0 || lane_end < blk_size)) {
+        ierr = CeedOperatorMaskBlock_Opt(impl->blk_restr[1], lane_start, lane_end,
+                                         impl->e_vecs_in[0]); CeedChkBackend(ierr);
+      }
       ierr = CeedElemRestrictionApplyBlock(impl->blk_restr[1], b, CEED_TRANSPOSE,
-                                           impl->e_vecs_in[0], out_vec, request); CeedChkBackend(ierr);
+                                           impl->e_vecs_in[0], out_vec,
+                                           CEED_REQUEST_IMMEDIATE);
+      CeedChkBackend(ierr);
     }
     return CEED_ERROR_SUCCESS;
   }
@@ -503,6 +1486,25 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec,
                                      op_input_fields, in_vec, e_data,
                                      impl, request); CeedChkBackend(ierr);
 
+  // Split element blocks across host threads
+  CeedInt num_threads;
+  ierr = CeedGetNumThreads(ceed, &num_threads); CeedChkBackend(ierr);
+  if (is_full && num_threads > 1 && num_blks > 1) {
+    ierr = CeedOperatorApplyAddTasks_Opt(op, CeedIntMin(num_threads, num_blks),
+                                         is_add, in_vec, out_vec, e_data, dot,
+                                         request);
+    CeedChkBackend(ierr);
+    ierr = CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields,
+                                         op_input_fields, e_data, impl);
+    CeedChkBackend(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Zero output entries no block writes, the others on first write
+  if (!is_add) {
+    ierr = CeedOperatorSetupOverwrite_Opt(op, false, out_vec); CeedChkBackend(ierr);
+  }
+
   // Output Lvecs, Evecs, and Qvecs
   for (CeedInt i=0; i<num_output_fields; i++) {
     // Set Qvec if needed
@@ -523,11 +1525,16 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec,
   }
 
   // Loop through elements
-  for (CeedInt e=0; e<num_blks*blk_size; e+=blk_size) {
+  for (CeedInt e=first_blk*blk_size; e<last_blk*blk_size; e+=blk_size) {
+    const CeedInt lane_start = is_full ? 0 : CeedIntMax(e_start - e, 0),
+                  lane_end = is_full ? blk_size : CeedIntMin(e_end - e, blk_size);
+
     // Input basis apply
     ierr = CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields,
                                       num_input_fields, blk_size, in_vec, false,
-                                      e_data, impl, request); CeedChkBackend(ierr);
+                                      e_data, impl, impl->e_vecs_in,
+                                      impl->q_vecs_in, request);
+    CeedChkBackend(ierr);
 
     // Q function
     if (!impl->is_identity_qf) {
@@ -537,8 +1544,11 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec,
 
     // Output basis apply and restrict
     ierr = CeedOperatorOutputBasis_Opt(e, Q, qf_output_fields, op_output_fields,
-                                       blk_size, num_input_fields, num_output_fields,
-                                       op, out_vec, impl, request);
+                                       blk_size, lane_start, lane_end,
+                                       num_input_fields, num_output_fields,
+                                       op, out_vec, impl, impl->e_vecs_in,
+                                       impl->e_vecs_out, impl->q_vecs_out, NULL,
+                                       !is_add, dot, request);
     CeedChkBackend(ierr);
   }
 
@@ -550,6 +1560,67 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApply_Opt(CeedOperator op, CeedVector in_vec,
+                                 CeedVector out_vec, CeedRequest *request) {
+  int ierr;
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+
+  return CeedOperatorApplyAddCore_Opt(op, 0, num_elem, false, in_vec, out_vec,
+                                      NULL, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply and Add
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec,
+                                    CeedVector out_vec, CeedRequest *request) {
+  int ierr;
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+
+  return CeedOperatorApplyAddCore_Opt(op, 0, num_elem, true, in_vec, out_vec,
+                                      NULL, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on a Range of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddRange_Opt(CeedOperator op, CeedInt e_start,
+    CeedInt e_end, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddCore_Opt(op, e_start, e_end, true, in_vec, out_vec,
+                                      NULL, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply with Dot Product of Input and Output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyDot_Opt(CeedOperator op, CeedVector in_vec,
+                                    CeedVector out_vec, CeedScalar *result) {
+  int ierr;
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+
+  // Setup
+  ierr = CeedOperatorSetup_Opt(op); CeedChkBackend(ierr);
+
+  // Fuse the dot product if an active input has the output restriction
+  if (impl->dot_out_field < 0 || impl->is_identity_restr_op) {
+    ierr = CeedOperatorApplyAddCore_Opt(op, 0, num_elem, false, in_vec, out_vec,
+                                        NULL, CEED_REQUEST_IMMEDIATE);
+    CeedChkBackend(ierr);
+    return CeedVectorDot(in_vec, out_vec, result);
+  }
+  *result = 0.0;
+  return CeedOperatorApplyAddCore_Opt(op, 0, num_elem, false, in_vec, out_vec,
+                                      result, CEED_REQUEST_IMMEDIATE);
+}
+
 //------------------------------------------------------------------------------
 // Core code for linear QFunction assembly
 //------------------------------------------------------------------------------
@@ -680,7 +1751,9 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op,
     // Input basis apply
     ierr = CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields,
                                       num_input_fields, blk_size, NULL, true,
-                                      e_data, impl, request); CeedChkBackend(ierr);
+                                      e_data, impl, impl->e_vecs_in,
+                                      impl->q_vecs_in, request);
+    CeedChkBackend(ierr);
 
     // Assemble QFunction
     for (CeedInt in=0; in<num_active_in; in++) {
@@ -738,7 +1811,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op,
     impl->qf_blk_rstr = blk_rstr;
   }
   ierr = CeedElemRestrictionApply(blk_rstr, CEED_TRANSPOSE, l_vec, *assembled,
-                                  request); CeedChkBackend(ierr);
+                                  CEED_REQUEST_IMMEDIATE); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
@@ -799,6 +1872,10 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   ierr = CeedVectorDestroy(&impl->qf_l_vec); CeedChkBackend(ierr);
   ierr = CeedElemRestrictionDestroy(&impl->qf_blk_rstr); CeedChkBackend(ierr);
 
+  // Thread task scratch
+  ierr = CeedOperatorDestroyTasks_Opt(impl); CeedChkBackend(ierr);
+  ierr = CeedOperatorDestroyFirstWrites_Opt(impl); CeedChkBackend(ierr);
+
   ierr = CeedFree(&impl); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
 }
@@ -831,8 +1908,16 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
                                 "LinearAssembleQFunctionUpdate",
                                 CeedOperatorLinearAssembleQFunctionUpdate_Opt);
   CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Setup",
+                                CeedOperatorSetupApply_Opt); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Apply",
+                                CeedOperatorApply_Opt); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Opt); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddRange",
+                                CeedOperatorApplyAddRange_Opt); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyDot",
+                                CeedOperatorApplyDot_Opt); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Opt); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
@@ -16,7 +16,9 @@
 
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
+#include <stdbool.h>
 #include "ceed-opt.h"
+#include "../ref/ceed-ref.h"
 
 //------------------------------------------------------------------------------
 // Tensor Contract Core loop
@@ -44,12 +46,12 @@ static inline int CeedTensorContractApply_Core_Opt(CeedTensorContract contract,
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
-static int CeedTensorContractApply_Opt(CeedTensorContract contract, CeedInt A,
-                                       CeedInt B, CeedInt C, CeedInt J,
-                                       const CeedScalar *restrict t,
-                                       CeedTransposeMode t_mode, const CeedInt add,
-                                       const CeedScalar *restrict u,
-                                       CeedScalar *restrict v) {
+int CeedTensorContractApply_Opt(CeedTensorContract contract, CeedInt A,
+                                CeedInt B, CeedInt C, CeedInt J,
+                                const CeedScalar *restrict t,
+                                CeedTransposeMode t_mode, const CeedInt add,
+                                const CeedScalar *restrict u,
+                                CeedScalar *restrict v) {
   if (!add)
     for (CeedInt q=0; q<A*J*C; q++)
       v[q] = (CeedScalar) 0.0;
@@ -64,6 +66,201 @@ static int CeedTensorContractApply_Opt(CeedTensorContract contract, CeedInt A,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Non-Tensor Contract Core loop
+//   GEMM v_a += t u_a for each component a with the columns, elements, of u_a
+//   innermost, so each row of v is read and written once for every four rows
+//   of u instead of for every row
+//------------------------------------------------------------------------------
+static inline int CeedTensorContractApplyNonTensor_Core_Opt(
+  CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+  const CeedScalar *restrict t, CeedTransposeMode t_mode,
+  const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt B_break = (B/4)*4;
+  CeedInt t_stride_0 = B, t_stride_1 = 1;
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1; t_stride_1 = J;
+  }
+
+  for (CeedInt a=0; a<A; a++) {
+    const CeedScalar *u_a = &u[a*B*C];
+    for (CeedInt j=0; j<J; j++) {
+      const CeedScalar *t_j = &t[j*t_stride_0];
+      CeedScalar *v_j = &v[(a*J+j)*C];
+      // Blocks of 4 rows of u
+      for (CeedInt b=0; b<B_break; b+=4) {
+        const CeedScalar t_0 = t_j[(b+0)*t_stride_1],
+                         t_1 = t_j[(b+1)*t_stride_1],
+                         t_2 = t_j[(b+2)*t_stride_1],
+                         t_3 = t_j[(b+3)*t_stride_1];
+        const CeedScalar *u_0 = &u_a[(b+0)*C], *u_1 = &u_a[(b+1)*C],
+                          *u_2 = &u_a[(b+2)*C], *u_3 = &u_a[(b+3)*C];
+        CeedPragmaSIMD
+        for (CeedInt c=0; c<C; c++)
+          v_j[c] += t_0*u_0[c] + t_1*u_1[c] + t_2*u_2[c] + t_3*u_3[c];
+      }
+      // Remainder of rows of u
+      for (CeedInt b=B_break; b<B; b++) {
+        const CeedScalar tq = t_j[b*t_stride_1];
+        const CeedScalar *u_b = &u_a[b*C];
+        CeedPragmaSIMD
+        for (CeedInt c=0; c<C; c++)
+          v_j[c] += tq*u_b[c];
+      }
+    }
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Non-Tensor Contract Apply
+//   Non-tensor bases apply a single contraction with A = num_comp, B and J the
+//   number of nodes and quadrature points, and C the number of elements;
+//   tensor H(div) bases, which are not tensor H^1 bases, apply one per direction
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyNonTensor_Opt(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  if (!add)
+    for (CeedInt q=0; q<A*J*C; q++)
+      v[q] = (CeedScalar) 0.0;
+
+  // Single elements gain nothing from blocking rows of u
+  if (C == 1)
+    return CeedTensorContractApply_Core_Opt(contract, A, B, 1, J, t, t_mode,
+                                            add, u, v);
+  else
+    return CeedTensorContractApplyNonTensor_Core_Opt(contract, A, B, C, J, t,
+           t_mode, u, v);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Even-Odd Core loop
+//   u is folded into its even and odd parts u_e, u_o, then each half row j of
+//   the folded matrix gives v_e = t_e u_e and v_o = t_o u_o, accumulated in
+//   registers for CC columns, and two rows v_j = v_e + v_o and
+//   v_{J-1-j} = sign*(v_e - v_o)
+//------------------------------------------------------------------------------
+static inline int CeedTensorContractApplyEvenOdd_Core_Opt(
+  CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+  const CeedScalar *restrict t, CeedInt parity, CeedTransposeMode t_mode,
+  const CeedScalar *restrict u, CeedScalar *restrict v,
+  CeedScalar *restrict u_even, CeedScalar *restrict u_odd, const CeedInt CC) {
+  const bool is_transpose = t_mode == CEED_TRANSPOSE;
+  // For the transpose, the middle entry of u with odd B has even and odd parts
+  //   and the middle entry of v with odd J only an even part
+  const CeedInt B_lo = B/2, J_lo = J/2, B_even = (B+1)/2, J_even = (J+1)/2,
+                B_odd = is_transpose ? B_even : B_lo,
+                J_odd = is_transpose ? J_lo : J_even;
+  const CeedScalar sign_u = is_transpose ? parity : 1,
+                   sign_v = is_transpose ? 1 : parity;
+  const CeedScalar *t_even = t, *t_odd = t + B_even*J_even;
+  CeedInt t_even_stride_0 = B_even, t_even_stride_1 = 1,
+          t_odd_stride_0 = B_odd, t_odd_stride_1 = 1;
+  if (is_transpose) {
+    t_even_stride_0 = 1; t_even_stride_1 = J_even;
+    t_odd_stride_0 = 1; t_odd_stride_1 = J_odd;
+  }
+
+  for (CeedInt a=0; a<A; a++) {
+    // Fold u
+    for (CeedInt b=0; b<B_even; b++) {
+      const CeedScalar *u_l = &u[(a*B+b)*C], *u_r = &u[(a*B+B-1-b)*C];
+      const CeedScalar s = b < B_lo ? sign_u : 0;
+      CeedPragmaSIMD
+      for (CeedInt c=0; c<C; c++) {
+        u_even[b*C+c] = u_l[c] + s*u_r[c];
+        u_odd[b*C+c] = u_l[c] - s*u_r[c];
+      }
+    }
+
+    for (CeedInt j=0; j<J_even; j++) {
+      CeedScalar *v_l = &v[(a*J+j)*C], *v_r = &v[(a*J+J-1-j)*C];
+      const CeedInt B_odd_j = j < J_odd ? B_odd : 0;
+      const CeedScalar sign_r = j < J_lo ? sign_v : 0;
+      for (CeedInt c=0; c<C; c+=CC) {
+        const CeedInt num_c = C-c < CC ? C-c : CC;
+        CeedScalar v_even[CC], v_odd[CC];
+        for (CeedInt cc=0; cc<CC; cc++) {
+          v_even[cc] = 0.0;
+          v_odd[cc] = 0.0;
+        }
+        if (num_c == CC) {
+          for (CeedInt b=0; b<B_even; b++) {
+            const CeedScalar tq = t_even[j*t_even_stride_0 + b*t_even_stride_1];
+            for (CeedInt cc=0; cc<CC; cc++) // unroll
+              v_even[cc] += tq * u_even[b*C+c+cc];
+          }
+          for (CeedInt b=0; b<B_odd_j; b++) {
+            const CeedScalar tq = t_odd[j*t_odd_stride_0 + b*t_odd_stride_1];
+            for (CeedInt cc=0; cc<CC; cc++) // unroll
+              v_odd[cc] += tq * u_odd[b*C+c+cc];
+          }
+        } else {
+          for (CeedInt b=0; b<B_even; b++) {
+            const CeedScalar tq = t_even[j*t_even_stride_0 + b*t_even_stride_1];
+            for (CeedInt cc=0; cc<num_c; cc++)
+              v_even[cc] += tq * u_even[b*C+c+cc];
+          }
+          for (CeedInt b=0; b<B_odd_j; b++) {
+            const CeedScalar tq = t_odd[j*t_odd_stride_0 + b*t_odd_stride_1];
+            for (CeedInt cc=0; cc<num_c; cc++)
+              v_odd[cc] += tq * u_odd[b*C+c+cc];
+          }
+        }
+        // Unfold v, the middle row of odd J is written once
+        for (CeedInt cc=0; cc<num_c; cc++)
+          v_r[c+cc] += sign_r*(v_even[cc] - v_odd[cc]);
+        for (CeedInt cc=0; cc<num_c; cc++)
+          v_l[c+cc] += v_even[cc] + v_odd[cc];
+      }
+    }
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Even-Odd
+//------------------------------------------------------------------------------
+int CeedTensorContractApplyEvenOdd_Opt(CeedTensorContract contract, CeedInt A,
+                                       CeedInt B, CeedInt C, CeedInt J,
+                                       const CeedScalar *restrict t,
+                                       const CeedScalar *restrict t_even_odd,
+                                       CeedInt parity, CeedTransposeMode t_mode,
+                                       const CeedInt add,
+                                       const CeedScalar *restrict u,
+                                       CeedScalar *restrict v) {
+  // Single columns gain little from folding
+  if (C == 1)
+    return CeedTensorContractApply(contract, A, B, C, J, t, t_mode, add, u, v);
+
+  int ierr, ierr2;
+  Ceed ceed;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChkBackend(ierr);
+  CeedScalar *u_even = NULL, *u_odd = NULL;
+  ierr = CeedGetWorkArray(ceed, ((B+1)/2)*C, &u_even);
+  if (ierr) { goto cleanup; } CeedChkBackend(ierr);
+  ierr = CeedGetWorkArray(ceed, ((B+1)/2)*C, &u_odd);
+  if (ierr) { goto cleanup; } CeedChkBackend(ierr);
+
+  if (!add)
+    for (CeedInt q=0; q<A*J*C; q++)
+      v[q] = (CeedScalar) 0.0;
+
+  ierr = CeedTensorContractApplyEvenOdd_Core_Opt(contract, A, B, C, J,
+         t_even_odd, parity, t_mode, u, v, u_even, u_odd, 4);
+  if (ierr) { goto cleanup; } CeedChkBackend(ierr);
+
+cleanup:
+  ierr2 = CeedRestoreWorkArray(ceed, &u_odd); CeedChkBackend(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &u_even); CeedChkBackend(ierr2);
+  CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
@@ -71,9 +268,22 @@ int CeedTensorContractCreate_Opt(CeedBasis basis, CeedTensorContract contract) {
   int ierr;
   Ceed ceed;
   ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChkBackend(ierr);
+  bool is_tensor;
+  ierr = CeedBasisIsTensor(basis, &is_tensor); CeedChkBackend(ierr);
+
+  if (!is_tensor) {
+    ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                  CeedTensorContractApplyNonTensor_Opt);
+    CeedChkBackend(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
 
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
                                 CeedTensorContractApply_Opt); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract,
+                                "ApplyEvenOdd", CeedTensorContractApplyEvenOdd_Opt);
+  CeedChkBackend(ierr);
+  ierr = CeedTensorContractSetFusable_Ref(contract); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
@@ -30,6 +30,16 @@ typedef struct {
   CeedScalar *colo_grad_1d;
 } CeedBasis_Opt;
 
+typedef struct {
+  CeedVector in_vec;       /* View of the active input L-vector */
+  CeedVector *e_vecs_in;   /* Element block input E-vectors  */
+  CeedVector *e_vecs_out;  /* Element block output E-vectors */
+  CeedVector *q_vecs_in;   /* Element block input Q-vectors  */
+  CeedVector *q_vecs_out;  /* Element block output Q-vectors */
+  CeedVector *out_vecs;    /* Views of output L-vectors or private
+                              accumulators */
+} CeedOperatorThread_Opt;
+
 typedef struct {
   bool is_identity_qf, is_identity_restr_op;
   CeedElemRestriction *blk_restr; /* Blocked versions of restrictions */
@@ -41,13 +51,33 @@ typedef struct {
   CeedVector *q_vecs_out;  /* Element block output Q-vectors */
   CeedInt    num_inputs,num_outputs;
   CeedInt    num_active_in, num_active_out;
+  CeedInt    dot_in_field, dot_out_field; /* Active fields with the same
+                                             restriction, -1 if none */
   CeedVector *qf_active_in;
   CeedVector qf_l_vec;
   CeedElemRestriction qf_blk_rstr;
+  CeedInt    num_tasks;    /* Number of thread tasks with scratch below */
+  CeedOperatorThread_Opt *tasks;
+  CeedInt    num_colors;   /* Coloring of element blocks, if any */
+  const CeedInt *color_offsets, *color_blocks;
+  CeedInt    **zero_offsets; /* Per output field, CSR offsets of the L-vector
+                                entries no element block writes, followed by
+                                the entries each block writes first */
+  CeedInt    **zero_indices;
+  bool       is_zero_colored; /* Block order of the first writes */
 } CeedOperator_Opt;
 
 CEED_INTERN int CeedTensorContractCreate_Opt(CeedBasis basis,
     CeedTensorContract contract);
+CEED_INTERN int CeedTensorContractApply_Opt(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add,
+    const CeedScalar *restrict u, CeedScalar *restrict v);
+CEED_INTERN int CeedTensorContractApplyEvenOdd_Opt(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    const CeedScalar *restrict t_even_odd, CeedInt parity,
+    CeedTransposeMode t_mode, const CeedInt add,
+    const CeedScalar *restrict u, CeedScalar *restrict v);
 CEED_INTERN int CeedOperatorCreate_Opt(CeedOperator op);
 
 #endif // _ceed_opt_h
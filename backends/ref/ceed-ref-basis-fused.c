@@ -0,0 +1,275 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include "ceed-ref.h"
+
+// Kernel bodies are inlined into each fixed size kernel, so loop bounds are
+//   compile time constants
+#if defined(__GNUC__) || defined(__clang__)
+#  define CEED_FUSED_INLINE_REF inline __attribute__((always_inline))
+#else
+#  define CEED_FUSED_INLINE_REF inline
+#endif
+
+//------------------------------------------------------------------------------
+// Small Integer Power, Folded at Compile Time for Fixed Sizes
+//------------------------------------------------------------------------------
+static CEED_FUSED_INLINE_REF CeedInt CeedBasisFusedPow_Ref(const CeedInt base,
+    const CeedInt power) {
+  return power == 0 ? 1 : (power == 1 ? base : (power == 2 ? base*base :
+                           base*base*base));
+}
+
+//------------------------------------------------------------------------------
+// Contract One Direction
+//   v[a, j, x] (+)= sum_b t[j, b] u[a, b, x]
+//------------------------------------------------------------------------------
+static CEED_FUSED_INLINE_REF void CeedBasisFusedContract_Ref(const CeedInt A,
+    const CeedInt B, const CeedInt X, const CeedInt J,
+    const CeedScalar *restrict t, const bool transpose, const bool add,
+    const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt t_stride_0 = transpose ? 1 : B, t_stride_1 = transpose ? J : 1;
+
+  for (CeedInt a=0; a<A; a++)
+    for (CeedInt j=0; j<J; j++) {
+      CeedScalar *restrict vv = &v[(a*J+j)*X];
+      if (!add)
+        for (CeedInt x=0; x<X; x++)
+          vv[x] = 0.0;
+      for (CeedInt b=0; b<B; b++) {
+        const CeedScalar tq = t[j*t_stride_0 + b*t_stride_1];
+        const CeedScalar *restrict uu = &u[(a*B+b)*X];
+        CeedPragmaSIMD
+        for (CeedInt x=0; x<X; x++)
+          vv[x] += tq*uu[x];
+      }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Interpolate All Directions of One Component, from B^dim to J^dim points
+//------------------------------------------------------------------------------
+static CEED_FUSED_INLINE_REF void CeedBasisFusedInterpComp_Ref(const CeedInt B,
+    const CeedInt J, const CeedInt dim, const CeedScalar *restrict interp_1d,
+    const bool transpose, const CeedScalar *restrict u, CeedScalar *restrict v,
+    CeedScalar *restrict tmp_0, CeedScalar *restrict tmp_1) {
+  // Directions are written out, so each contraction has fixed bounds
+  switch (dim) {
+  case 1:
+    CeedBasisFusedContract_Ref(1, B, 1, J, interp_1d, transpose, false, u, v);
+    break;
+  case 2:
+    CeedBasisFusedContract_Ref(B, B, 1, J, interp_1d, transpose, false, u,
+                               tmp_0);
+    CeedBasisFusedContract_Ref(1, B, J, J, interp_1d, transpose, false, tmp_0,
+                               v);
+    break;
+  case 3:
+    CeedBasisFusedContract_Ref(B*B, B, 1, J, interp_1d, transpose, false, u,
+                               tmp_0);
+    CeedBasisFusedContract_Ref(B, B, J, J, interp_1d, transpose, false, tmp_0,
+                               tmp_1);
+    CeedBasisFusedContract_Ref(1, B, J*J, J, interp_1d, transpose, false, tmp_1,
+                               v);
+    break;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Differentiate One Component in Direction d with the Collocated Gradient
+//------------------------------------------------------------------------------
+static CEED_FUSED_INLINE_REF void CeedBasisFusedGradDir_Ref(const CeedInt Q,
+    const CeedInt dim, const CeedInt d, const CeedScalar *restrict grad_1d,
+    const bool transpose, const bool add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  CeedBasisFusedContract_Ref(CeedBasisFusedPow_Ref(Q, dim-1-d), Q,
+                             CeedBasisFusedPow_Ref(Q, d), Q, grad_1d, transpose,
+                             add, u, v);
+}
+
+//------------------------------------------------------------------------------
+// Fused Interpolation of a Single Element
+//   u has shape [num_comp, P^dim] and v [num_comp, Q^dim] in CEED_NOTRANSPOSE
+//   mode, the shapes are switched in CEED_TRANSPOSE mode
+//------------------------------------------------------------------------------
+static CEED_FUSED_INLINE_REF int CeedBasisFusedInterp_Ref(const CeedInt P,
+    const CeedInt Q, const CeedInt dim, const bool transpose,
+    const CeedInt num_comp, const CeedScalar *restrict interp_1d,
+    const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt B = transpose ? Q : P, J = transpose ? P : Q;
+  const CeedInt num_u = CeedBasisFusedPow_Ref(B, dim),
+                num_v = CeedBasisFusedPow_Ref(J, dim),
+                max_pts = CeedBasisFusedPow_Ref(P > Q ? P : Q, dim);
+  CeedScalar tmp[2][max_pts];
+
+  for (CeedInt c=0; c<num_comp; c++)
+    CeedBasisFusedInterpComp_Ref(B, J, dim, interp_1d, transpose, &u[c*num_u],
+                                 &v[c*num_v], tmp[0], tmp[1]);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Fused Gradient of a Single Element, Interpolating to Quadrature Points then
+//   Differentiating in Each Direction with the Collocated Gradient
+//   u has shape [num_comp, P^dim] and v [dim, num_comp, Q^dim] in
+//   CEED_NOTRANSPOSE mode, the shapes are switched in CEED_TRANSPOSE mode;
+//   interp_1d is NULL if nodes and quadrature points are collocated
+//------------------------------------------------------------------------------
+static CEED_FUSED_INLINE_REF int CeedBasisFusedGrad_Ref(const CeedInt P,
+    const CeedInt Q, const CeedInt dim, const bool transpose,
+    const CeedInt num_comp, const CeedScalar *restrict interp_1d,
+    const CeedScalar *restrict grad_1d, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  const CeedInt num_nodes = CeedBasisFusedPow_Ref(P, dim),
+                num_qpts = CeedBasisFusedPow_Ref(Q, dim),
+                max_pts = CeedBasisFusedPow_Ref(P > Q ? P : Q, dim);
+  const CeedInt dim_stride = num_comp*num_qpts;
+  CeedScalar interp[num_qpts], tmp[2][max_pts];
+
+  for (CeedInt c=0; c<num_comp; c++) {
+    // Directions are written out, so each contraction has fixed bounds
+    if (!transpose) {
+      const CeedScalar *u_q = &u[c*num_qpts];
+      // Interpolate to quadrature points
+      if (interp_1d) {
+        CeedBasisFusedInterpComp_Ref(P, Q, dim, interp_1d, false,
+                                     &u[c*num_nodes], interp, tmp[0], tmp[1]);
+        u_q = interp;
+      }
+      // Differentiate in each direction
+      CeedBasisFusedGradDir_Ref(Q, dim, 0, grad_1d, false, false, u_q,
+                                &v[c*num_qpts]);
+      if (dim > 1)
+        CeedBasisFusedGradDir_Ref(Q, dim, 1, grad_1d, false, false, u_q,
+                                  &v[dim_stride + c*num_qpts]);
+      if (dim > 2)
+        CeedBasisFusedGradDir_Ref(Q, dim, 2, grad_1d, false, false, u_q,
+                                  &v[2*dim_stride + c*num_qpts]);
+    } else {
+      CeedScalar *v_q = interp_1d ? interp : &v[c*num_qpts];
+      // Sum derivatives in each direction
+      CeedBasisFusedGradDir_Ref(Q, dim, 0, grad_1d, true, false, &u[c*num_qpts],
+                                v_q);
+      if (dim > 1)
+        CeedBasisFusedGradDir_Ref(Q, dim, 1, grad_1d, true, true,
+                                  &u[dim_stride + c*num_qpts], v_q);
+      if (dim > 2)
+        CeedBasisFusedGradDir_Ref(Q, dim, 2, grad_1d, true, true,
+                                  &u[2*dim_stride + c*num_qpts], v_q);
+      // Interpolate to nodes
+      if (interp_1d)
+        CeedBasisFusedInterpComp_Ref(Q, P, dim, interp_1d, true, interp,
+                                     &v[c*num_nodes], tmp[0], tmp[1]);
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Kernels for Fixed Sizes
+//------------------------------------------------------------------------------
+#define CEED_FUSED_KERNELS_REF(P, Q, dim)                                      \
+  static int CeedBasisInterp_##P##_##Q##_##dim##_Ref(CeedInt num_comp,         \
+      const CeedScalar *interp_1d, const CeedScalar *grad_1d,                  \
+      const CeedScalar *u, CeedScalar *v) {                                    \
+    return CeedBasisFusedInterp_Ref(P, Q, dim, false, num_comp, interp_1d, u,  \
+                                    v);                                        \
+  }                                                                            \
+  static int CeedBasisInterpTranspose_##P##_##Q##_##dim##_Ref(                 \
+      CeedInt num_comp, const CeedScalar *interp_1d,                           \
+      const CeedScalar *grad_1d, const CeedScalar *u, CeedScalar *v) {         \
+    return CeedBasisFusedInterp_Ref(P, Q, dim, true, num_comp, interp_1d, u,   \
+                                    v);                                        \
+  }                                                                            \
+  static int CeedBasisGrad_##P##_##Q##_##dim##_Ref(CeedInt num_comp,           \
+      const CeedScalar *interp_1d, const CeedScalar *grad_1d,                  \
+      const CeedScalar *u, CeedScalar *v) {                                    \
+    return CeedBasisFusedGrad_Ref(P, Q, dim, false, num_comp, interp_1d,       \
+                                  grad_1d, u, v);                              \
+  }                                                                            \
+  static int CeedBasisGradTranspose_##P##_##Q##_##dim##_Ref(CeedInt num_comp,  \
+      const CeedScalar *interp_1d, const CeedScalar *grad_1d,                  \
+      const CeedScalar *u, CeedScalar *v) {                                    \
+    return CeedBasisFusedGrad_Ref(P, Q, dim, true, num_comp, interp_1d,        \
+                                  grad_1d, u, v);                              \
+  }
+
+#define CEED_FUSED_KERNELS_DIM_REF(P, Q) \
+  CEED_FUSED_KERNELS_REF(P, Q, 1)        \
+  CEED_FUSED_KERNELS_REF(P, Q, 2)        \
+  CEED_FUSED_KERNELS_REF(P, Q, 3)
+
+// Sizes with kernels, 2 <= P <= Q <= 8
+#define CEED_FUSED_SIZES_REF(X)                                   \
+  X(2, 2) X(2, 3) X(2, 4) X(2, 5) X(2, 6) X(2, 7) X(2, 8)         \
+  X(3, 3) X(3, 4) X(3, 5) X(3, 6) X(3, 7) X(3, 8)                 \
+  X(4, 4) X(4, 5) X(4, 6) X(4, 7) X(4, 8)                         \
+  X(5, 5) X(5, 6) X(5, 7) X(5, 8)                                 \
+  X(6, 6) X(6, 7) X(6, 8)                                         \
+  X(7, 7) X(7, 8)                                                 \
+  X(8, 8)
+
+CEED_FUSED_SIZES_REF(CEED_FUSED_KERNELS_DIM_REF)
+
+//------------------------------------------------------------------------------
+// Kernel Table
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedInt P_1d, Q_1d, dim;
+  CeedBasisFused_Ref interp[2], grad[2]; // Indexed by CeedTransposeMode
+} CeedBasisFusedEntry_Ref;
+
+#define CEED_FUSED_ENTRY_REF(P, Q, dim)                                        \
+  {P, Q, dim,                                                                  \
+   {CeedBasisInterp_##P##_##Q##_##dim##_Ref,                                   \
+    CeedBasisInterpTranspose_##P##_##Q##_##dim##_Ref},                         \
+   {CeedBasisGrad_##P##_##Q##_##dim##_Ref,                                     \
+    CeedBasisGradTranspose_##P##_##Q##_##dim##_Ref}},
+#define CEED_FUSED_ENTRY_DIM_REF(P, Q) \
+  CEED_FUSED_ENTRY_REF(P, Q, 1)        \
+  CEED_FUSED_ENTRY_REF(P, Q, 2)        \
+  CEED_FUSED_ENTRY_REF(P, Q, 3)
+
+static const CeedBasisFusedEntry_Ref ceed_basis_fused_table_ref[] = {
+  CEED_FUSED_SIZES_REF(CEED_FUSED_ENTRY_DIM_REF)
+};
+
+//------------------------------------------------------------------------------
+// Get Fused Kernel for a Tensor Basis, NULL if None for its Size
+//------------------------------------------------------------------------------
+int CeedBasisGetFusedKernel_Ref(CeedInt P_1d, CeedInt Q_1d, CeedInt dim,
+                                CeedEvalMode eval_mode, CeedTransposeMode t_mode,
+                                CeedBasisFused_Ref *kernel) {
+  const CeedInt num_entries = sizeof(ceed_basis_fused_table_ref) /
+                              sizeof(ceed_basis_fused_table_ref[0]);
+
+  *kernel = NULL;
+  for (CeedInt i=0; i<num_entries; i++) {
+    const CeedBasisFusedEntry_Ref *entry = &ceed_basis_fused_table_ref[i];
+    if (entry->P_1d != P_1d || entry->Q_1d != Q_1d || entry->dim != dim)
+      continue;
+    if (eval_mode == CEED_EVAL_INTERP)
+      *kernel = entry->interp[t_mode];
+    else if (eval_mode == CEED_EVAL_GRAD)
+      *kernel = entry->grad[t_mode];
+    break;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
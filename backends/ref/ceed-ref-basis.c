@@ -21,13 +21,30 @@
 #include <string.h>
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// Tensor contraction with a 1D matrix, even-odd if the matrix was folded
+//------------------------------------------------------------------------------
+static inline int CeedBasisContract_Ref(CeedTensorContract contract, CeedInt A,
+                                        CeedInt B, CeedInt C, CeedInt J,
+                                        const CeedScalar *t,
+                                        const CeedScalar *t_even_odd,
+                                        CeedInt parity,
+                                        CeedTransposeMode t_mode,
+                                        const CeedInt add, const CeedScalar *u,
+                                        CeedScalar *v) {
+  if (t_even_odd)
+    return CeedTensorContractApplyEvenOdd(contract, A, B, C, J, t, t_even_odd,
+                                          parity, t_mode, add, u, v);
+  return CeedTensorContractApply(contract, A, B, C, J, t, t_mode, add, u, v);
+}
+
 //------------------------------------------------------------------------------
 // Basis Apply
 //------------------------------------------------------------------------------
 static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem,
                               CeedTransposeMode t_mode, CeedEvalMode eval_mode,
                               CeedVector U, CeedVector V) {
-  int ierr;
+  int ierr, ierr2;
   Ceed ceed;
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChkBackend(ierr);
   CeedInt dim, num_comp, num_nodes, num_qpts, Q_comp;
@@ -51,6 +68,33 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem,
     // LCOV_EXCL_STOP
   }
   ierr = CeedVectorGetArrayWrite(V, CEED_MEM_HOST, &v); CeedChkBackend(ierr);
+  bool tensor_basis;
+  ierr = CeedBasisIsTensor(basis, &tensor_basis); CeedChkBackend(ierr);
+
+  // Fixed size kernels applying all directions at once, overwriting v; blocks
+  //   of elements use the tensor contraction, which vectorizes across them
+  if (tensor_basis && num_elem == 1 && (eval_mode == CEED_EVAL_INTERP ||
+                                        eval_mode == CEED_EVAL_GRAD)) {
+    CeedBasis_Ref *impl;
+    ierr = CeedBasisGetData(basis, &impl); CeedChkBackend(ierr);
+    CeedBasisFused_Ref kernel = eval_mode == CEED_EVAL_INTERP ?
+                                impl->fused_interp[t_mode] :
+                                impl->fused_grad[t_mode];
+    if (kernel) {
+      const CeedScalar *interp_1d, *grad_1d;
+      ierr = CeedBasisGetInterp1D(basis, &interp_1d); CeedChkBackend(ierr);
+      ierr = CeedBasisGetGrad1D(basis, &grad_1d); CeedChkBackend(ierr);
+      if (impl->has_collo_interp)
+        interp_1d = NULL;
+      else if (impl->collo_grad_1d)
+        grad_1d = impl->collo_grad_1d;
+      ierr = kernel(num_comp, interp_1d, grad_1d, u, v);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorRestoreArrayRead(U, &u); CeedChkBackend(ierr);
+      ierr = CeedVectorRestoreArray(V, &v); CeedChkBackend(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+  }
 
   // Clear v if operating in transpose
   if (t_mode == CEED_TRANSPOSE) {
@@ -58,8 +102,6 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem,
     for (CeedInt i = 0; i < v_size; i++)
       v[i] = (CeedScalar) 0.0;
   }
-  bool tensor_basis;
-  ierr = CeedBasisIsTensor(basis, &tensor_basis); CeedChkBackend(ierr);
   // Tensor basis
   if (tensor_basis) {
     CeedInt P_1d, Q_1d;
@@ -78,18 +120,28 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem,
           P = Q_1d; Q = P_1d;
         }
         CeedInt pre = num_comp*CeedIntPow(P, dim-1), post = num_elem;
-        CeedScalar tmp[2][num_elem*num_comp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
+        const size_t tmp_len = num_elem*num_comp*Q*CeedIntPow(P>Q?P:Q, dim-1);
+        CeedScalar *tmp[2] = {NULL, NULL};
+        ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[0]);
+        if (ierr) { goto interp_cleanup; } CeedChkBackend(ierr);
+        ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[1]);
+        if (ierr) { goto interp_cleanup; } CeedChkBackend(ierr);
         const CeedScalar *interp_1d;
-        ierr = CeedBasisGetInterp1D(basis, &interp_1d); CeedChkBackend(ierr);
+        ierr = CeedBasisGetInterp1D(basis, &interp_1d);
+        if (ierr) { goto interp_cleanup; } CeedChkBackend(ierr);
         for (CeedInt d=0; d<dim; d++) {
-          ierr = CeedTensorContractApply(contract, pre, P, post, Q,
-                                         interp_1d, t_mode, add&&(d==dim-1),
-                                         d==0?u:tmp[d%2],
-                                         d==dim-1?v:tmp[(d+1)%2]);
-          CeedChkBackend(ierr);
+          ierr = CeedBasisContract_Ref(contract, pre, P, post, Q, interp_1d,
+                                       impl->interp_1d_even_odd, 1, t_mode,
+                                       add&&(d==dim-1), d==0?u:tmp[d%2],
+                                       d==dim-1?v:tmp[(d+1)%2]);
+          if (ierr) { goto interp_cleanup; } CeedChkBackend(ierr);
           pre /= P;
           post *= Q;
         }
+interp_cleanup:
+        ierr2 = CeedRestoreWorkArray(ceed, &tmp[1]); CeedChkBackend(ierr2);
+        ierr2 = CeedRestoreWorkArray(ceed, &tmp[0]); CeedChkBackend(ierr2);
+        CeedChkBackend(ierr);
       }
     } break;
     // Evaluate the gradient to/from quadrature points
@@ -108,23 +160,33 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem,
       const CeedScalar *interp_1d;
       ierr = CeedBasisGetInterp1D(basis, &interp_1d); CeedChkBackend(ierr);
       if (impl->collo_grad_1d) {
-        CeedScalar tmp[2][num_elem*num_comp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
-        CeedScalar interp[num_elem*num_comp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
+        const size_t tmp_len = num_elem*num_comp*Q*CeedIntPow(P>Q?P:Q, dim-1);
+        CeedScalar *tmp[2] = {NULL, NULL}, *interp = NULL;
+        ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[0]);
+        if (ierr) { goto collo_grad_cleanup; } CeedChkBackend(ierr);
+        ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[1]);
+        if (ierr) { goto collo_grad_cleanup; } CeedChkBackend(ierr);
+        ierr = CeedGetWorkArray(ceed, tmp_len, &interp);
+        if (ierr) { goto collo_grad_cleanup; } CeedChkBackend(ierr);
         // Interpolate to quadrature points (NoTranspose)
         //  or Grad to quadrature points (Transpose)
         for (CeedInt d=0; d<dim; d++) {
-          ierr = CeedTensorContractApply(contract, pre, P, post, Q,
-                                         (t_mode == CEED_NOTRANSPOSE
-                                          ? interp_1d
-                                          : impl->collo_grad_1d),
-                                         t_mode, add&&(d>0),
-                                         (t_mode == CEED_NOTRANSPOSE
-                                          ? (d==0?u:tmp[d%2])
-                                          : u + d*num_qpts*num_comp*num_elem),
-                                         (t_mode == CEED_NOTRANSPOSE
-                                          ? (d==dim-1?interp:tmp[(d+1)%2])
-                                          : interp));
-          CeedChkBackend(ierr);
+          ierr = CeedBasisContract_Ref(contract, pre, P, post, Q,
+                                       (t_mode == CEED_NOTRANSPOSE
+                                        ? interp_1d
+                                        : impl->collo_grad_1d),
+                                       (t_mode == CEED_NOTRANSPOSE
+                                        ? impl->interp_1d_even_odd
+                                        : impl->collo_grad_1d_even_odd),
+                                       t_mode == CEED_NOTRANSPOSE ? 1 : -1,
+                                       t_mode, add&&(d>0),
+                                       (t_mode == CEED_NOTRANSPOSE
+                                        ? (d==0?u:tmp[d%2])
+                                        : u + d*num_qpts*num_comp*num_elem),
+                                       (t_mode == CEED_NOTRANSPOSE
+                                        ? (d==dim-1?interp:tmp[(d+1)%2])
+                                        : interp));
+          if (ierr) { goto collo_grad_cleanup; } CeedChkBackend(ierr);
           pre /= P;
           post *= Q;
         }
@@ -136,21 +198,30 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem,
         }
         pre = num_comp*CeedIntPow(P, dim-1), post = num_elem;
         for (CeedInt d=0; d<dim; d++) {
-          ierr = CeedTensorContractApply(contract, pre, P, post, Q,
-                                         (t_mode == CEED_NOTRANSPOSE
-                                          ? impl->collo_grad_1d
-                                          : interp_1d),
-                                         t_mode, add&&(d==dim-1),
-                                         (t_mode == CEED_NOTRANSPOSE
-                                          ? interp
-                                          : (d==0?interp:tmp[d%2])),
-                                         (t_mode == CEED_NOTRANSPOSE
-                                          ? v + d*num_qpts*num_comp*num_elem
-                                          : (d==dim-1?v:tmp[(d+1)%2])));
-          CeedChkBackend(ierr);
+          ierr = CeedBasisContract_Ref(contract, pre, P, post, Q,
+                                       (t_mode == CEED_NOTRANSPOSE
+                                        ? impl->collo_grad_1d
+                                        : interp_1d),
+                                       (t_mode == CEED_NOTRANSPOSE
+                                        ? impl->collo_grad_1d_even_odd
+                                        : impl->interp_1d_even_odd),
+                                       t_mode == CEED_NOTRANSPOSE ? -1 : 1,
+                                       t_mode, add&&(d==dim-1),
+                                       (t_mode == CEED_NOTRANSPOSE
+                                        ? interp
+                                        : (d==0?interp:tmp[d%2])),
+                                       (t_mode == CEED_NOTRANSPOSE
+                                        ? v + d*num_qpts*num_comp*num_elem
+                                        : (d==dim-1?v:tmp[(d+1)%2])));
+          if (ierr) { goto collo_grad_cleanup; } CeedChkBackend(ierr);
           pre /= P;
           post *= Q;
         }
+collo_grad_cleanup:
+        ierr2 = CeedRestoreWorkArray(ceed, &interp); CeedChkBackend(ierr2);
+        ierr2 = CeedRestoreWorkArray(ceed, &tmp[1]); CeedChkBackend(ierr2);
+        ierr2 = CeedRestoreWorkArray(ceed, &tmp[0]); CeedChkBackend(ierr2);
+        CeedChkBackend(ierr);
       } else if (impl->has_collo_interp) { // Qpts collocated with nodes
         const CeedScalar *grad_1d;
         ierr = CeedBasisGetGrad1D(basis, &grad_1d); CeedChkBackend(ierr);
@@ -158,12 +229,13 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem,
         // Dim contractions, identity in other directions
         CeedInt pre = num_comp*CeedIntPow(P, dim-1), post = num_elem;
         for (CeedInt d=0; d<dim; d++) {
-          ierr = CeedTensorContractApply(contract, pre, P, post, Q,
-                                         grad_1d, t_mode, add&&(d>0),
-                                         t_mode == CEED_NOTRANSPOSE
-                                         ? u : u+d*num_comp*num_qpts*num_elem,
-                                         t_mode == CEED_TRANSPOSE
-                                         ? v : v+d*num_comp*num_qpts*num_elem);
+          ierr = CeedBasisContract_Ref(contract, pre, P, post, Q, grad_1d,
+                                       impl->grad_1d_even_odd, -1, t_mode,
+                                       add&&(d>0),
+                                       t_mode == CEED_NOTRANSPOSE
+                                       ? u : u+d*num_comp*num_qpts*num_elem,
+                                       t_mode == CEED_TRANSPOSE
+                                       ? v : v+d*num_comp*num_qpts*num_elem);
           CeedChkBackend(ierr);
           pre /= P;
           post *= Q;
@@ -175,28 +247,40 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem,
         if (t_mode == CEED_TRANSPOSE) {
           P = Q_1d, Q = P_1d;
         }
-        CeedScalar tmp[2][num_elem*num_comp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
+        const size_t tmp_len = num_elem*num_comp*Q*CeedIntPow(P>Q?P:Q, dim-1);
+        CeedScalar *tmp[2] = {NULL, NULL};
+        ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[0]);
+        if (ierr) { goto grad_cleanup; } CeedChkBackend(ierr);
+        ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[1]);
+        if (ierr) { goto grad_cleanup; } CeedChkBackend(ierr);
 
         // Dim**2 contractions, apply grad when pass == dim
         for (CeedInt p=0; p<dim; p++) {
           CeedInt pre = num_comp*CeedIntPow(P, dim-1), post = num_elem;
           for (CeedInt d=0; d<dim; d++) {
-            ierr = CeedTensorContractApply(contract, pre, P, post, Q,
-                                           (p==d)? grad_1d : interp_1d,
-                                           t_mode, add&&(d==dim-1),
-                                           (d == 0
-                                            ? (t_mode == CEED_NOTRANSPOSE
-                                               ? u : u+p*num_comp*num_qpts*num_elem)
-                                            : tmp[d%2]),
-                                           (d == dim-1
-                                            ? (t_mode == CEED_TRANSPOSE
-                                               ? v : v+p*num_comp*num_qpts*num_elem)
-                                            : tmp[(d+1)%2]));
-            CeedChkBackend(ierr);
+            ierr = CeedBasisContract_Ref(contract, pre, P, post, Q,
+                                         (p==d)? grad_1d : interp_1d,
+                                         (p==d)? impl->grad_1d_even_odd
+                                         : impl->interp_1d_even_odd,
+                                         (p==d)? -1 : 1,
+                                         t_mode, add&&(d==dim-1),
+                                         (d == 0
+                                          ? (t_mode == CEED_NOTRANSPOSE
+                                             ? u : u+p*num_comp*num_qpts*num_elem)
+                                          : tmp[d%2]),
+                                         (d == dim-1
+                                          ? (t_mode == CEED_TRANSPOSE
+                                             ? v : v+p*num_comp*num_qpts*num_elem)
+                                          : tmp[(d+1)%2]));
+            if (ierr) { goto grad_cleanup; } CeedChkBackend(ierr);
             pre /= P;
             post *= Q;
           }
         }
+grad_cleanup:
+        ierr2 = CeedRestoreWorkArray(ceed, &tmp[1]); CeedChkBackend(ierr2);
+        ierr2 = CeedRestoreWorkArray(ceed, &tmp[0]); CeedChkBackend(ierr2);
+        CeedChkBackend(ierr);
       }
     } break;
     // Retrieve interpolation weights
@@ -368,6 +452,505 @@ int CeedBasisCreateHdiv_Ref(CeedElemTopology topo, CeedInt dim,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor H(div) Block Contractions
+//   Applies the 1D matrices of the block of vector component d, the closed
+//   matrix t_closed in direction d and t_open in the others, to all elements
+//------------------------------------------------------------------------------
+static int CeedBasisContractHdiv_Ref(CeedTensorContract contract, CeedInt dim,
+                                     CeedInt d, CeedInt P_1d, CeedInt Q_1d,
+                                     CeedInt num_elem,
+                                     const CeedScalar *t_closed,
+                                     const CeedScalar *t_open,
+                                     CeedTransposeMode t_mode, CeedInt add,
+                                     const CeedScalar *u, CeedScalar *v,
+                                     CeedScalar *tmp[2]) {
+  int ierr;
+  CeedInt n[3], pre = 1, post = num_elem;
+  for (CeedInt e=0; e<dim; e++) {
+    n[e] = e == d ? P_1d : P_1d-1;
+    if (e > 0)
+      pre *= t_mode == CEED_TRANSPOSE ? Q_1d : n[e];
+  }
+  for (CeedInt e=0; e<dim; e++) {
+    CeedInt P = n[e], Q = Q_1d;
+    if (t_mode == CEED_TRANSPOSE) {
+      P = Q_1d; Q = n[e];
+    }
+    ierr = CeedTensorContractApply(contract, pre, P, post, Q,
+                                   e == d ? t_closed : t_open, t_mode,
+                                   add&&(e==dim-1), e==0?u:tmp[e%2],
+                                   e==dim-1?v:tmp[(e+1)%2]);
+    CeedChkBackend(ierr);
+    if (e < dim-1)
+      pre /= t_mode == CEED_TRANSPOSE ? Q_1d : n[e+1];
+    post *= Q;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Tensor H(div)
+//   Each vector component block of nodes is a tensor product, so interp and
+//   div cost O(P^(dim+1)) per element instead of the O(P^(2 dim)) of the dense
+//   matrices
+//------------------------------------------------------------------------------
+static int CeedBasisApplyTensorHdiv_Ref(CeedBasis basis, CeedInt num_elem,
+                                        CeedTransposeMode t_mode,
+                                        CeedEvalMode eval_mode,
+                                        CeedVector U, CeedVector V) {
+  int ierr, ierr2;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChkBackend(ierr);
+  CeedInt dim, num_comp, num_nodes, num_qpts;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &num_nodes); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &num_qpts); CeedChkBackend(ierr);
+  CeedTensorContract contract;
+  ierr = CeedBasisGetTensorContract(basis, &contract); CeedChkBackend(ierr);
+  CeedBasis_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChkBackend(ierr);
+  const CeedInt add = (t_mode == CEED_TRANSPOSE);
+  const CeedScalar *u;
+  CeedScalar *v;
+  if (U != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u); CeedChkBackend(ierr);
+  } else if (eval_mode != CEED_EVAL_WEIGHT) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND,
+                     "An input vector is required for this CeedEvalMode");
+    // LCOV_EXCL_STOP
+  }
+  ierr = CeedVectorGetArrayWrite(V, CEED_MEM_HOST, &v); CeedChkBackend(ierr);
+
+  // Clear v if operating in transpose
+  if (t_mode == CEED_TRANSPOSE) {
+    const CeedInt v_size = num_elem*num_comp*num_nodes;
+    for (CeedInt i = 0; i < v_size; i++)
+      v[i] = (CeedScalar) 0.0;
+  }
+  switch (eval_mode) {
+  // Interpolate to/from quadrature points, or evaluate the divergence
+  case CEED_EVAL_INTERP:
+  case CEED_EVAL_DIV: {
+    const bool is_div = eval_mode == CEED_EVAL_DIV;
+    const CeedInt P_1d = impl->P_1d, Q_1d = impl->Q_1d,
+                  num_block_nodes = num_nodes/dim, Q_comp = is_div ? 1 : dim;
+    const size_t tmp_len = num_elem*CeedIntPow(P_1d>Q_1d?P_1d:Q_1d, dim);
+    CeedScalar *tmp[2] = {NULL, NULL};
+    ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[0]);
+    if (ierr) { goto hdiv_cleanup; } CeedChkBackend(ierr);
+    ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[1]);
+    if (ierr) { goto hdiv_cleanup; } CeedChkBackend(ierr);
+    for (CeedInt c=0; c<num_comp; c++)
+      for (CeedInt d=0; d<dim; d++) {
+        // The divergence sums the contributions of all vector components
+        const CeedInt nodes = (c*num_nodes + d*num_block_nodes)*num_elem,
+                      qpts = (c*Q_comp + (is_div ? 0 : d))*num_qpts*num_elem;
+        const CeedScalar *t_closed = is_div ? impl->grad_1d : impl->interp_1d;
+        if (t_mode == CEED_TRANSPOSE) {
+          ierr = CeedBasisContractHdiv_Ref(contract, dim, d, P_1d, Q_1d,
+                                           num_elem, t_closed,
+                                           impl->interp_1d_open, t_mode, add,
+                                           &u[qpts], &v[nodes], tmp);
+        } else {
+          ierr = CeedBasisContractHdiv_Ref(contract, dim, d, P_1d, Q_1d,
+                                           num_elem, t_closed,
+                                           impl->interp_1d_open, t_mode,
+                                           is_div && d > 0, &u[nodes],
+                                           &v[qpts], tmp);
+        }
+        if (ierr) { goto hdiv_cleanup; } CeedChkBackend(ierr);
+      }
+hdiv_cleanup:
+    ierr2 = CeedRestoreWorkArray(ceed, &tmp[1]); CeedChkBackend(ierr2);
+    ierr2 = CeedRestoreWorkArray(ceed, &tmp[0]); CeedChkBackend(ierr2);
+    CeedChkBackend(ierr);
+  } break;
+  // Retrieve interpolation weights
+  case CEED_EVAL_WEIGHT: {
+    if (t_mode == CEED_TRANSPOSE)
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_BACKEND,
+                       "CEED_EVAL_WEIGHT incompatible with CEED_TRANSPOSE");
+    // LCOV_EXCL_STOP
+    const CeedScalar *q_weight;
+    ierr = CeedBasisGetQWeights(basis, &q_weight); CeedChkBackend(ierr);
+    for (CeedInt i=0; i<num_qpts; i++)
+      for (CeedInt e=0; e<num_elem; e++)
+        v[i*num_elem + e] = q_weight[i];
+  } break;
+  // LCOV_EXCL_START
+  // Evaluate the gradient or curl to/from the quadrature points
+  case CEED_EVAL_GRAD:
+    return CeedError(ceed, CEED_ERROR_BACKEND,
+                     "CEED_EVAL_GRAD not supported for H(div) bases");
+  case CEED_EVAL_CURL:
+    return CeedError(ceed, CEED_ERROR_BACKEND, "CEED_EVAL_CURL not supported");
+  // Take no action, BasisApply should not have been called
+  case CEED_EVAL_NONE:
+    return CeedError(ceed, CEED_ERROR_BACKEND,
+                     "CEED_EVAL_NONE does not make sense in this context");
+    // LCOV_EXCL_STOP
+  }
+  if (U != CEED_VECTOR_NONE) {
+    ierr = CeedVectorRestoreArrayRead(U, &u); CeedChkBackend(ierr);
+  }
+  ierr = CeedVectorRestoreArray(V, &v); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Destroy Tensor H(div)
+//------------------------------------------------------------------------------
+static int CeedBasisDestroyTensorHdiv_Ref(CeedBasis basis) {
+  int ierr;
+
+  CeedBasis_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->interp_1d); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->grad_1d); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->interp_1d_open); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Create Tensor H(div)
+//------------------------------------------------------------------------------
+int CeedBasisCreateTensorHdiv_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d,
+                                  const CeedScalar *interp_1d,
+                                  const CeedScalar *grad_1d,
+                                  const CeedScalar *interp_1d_open,
+                                  const CeedScalar *q_ref_1d,
+                                  const CeedScalar *q_weight_1d,
+                                  CeedBasis basis) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChkBackend(ierr);
+  CeedBasis_Ref *impl;
+  ierr = CeedCalloc(1, &impl); CeedChkBackend(ierr);
+  impl->P_1d = P_1d;
+  impl->Q_1d = Q_1d;
+  ierr = CeedMalloc(Q_1d*P_1d, &impl->interp_1d); CeedChkBackend(ierr);
+  ierr = CeedMalloc(Q_1d*P_1d, &impl->grad_1d); CeedChkBackend(ierr);
+  ierr = CeedMalloc(Q_1d*(P_1d-1), &impl->interp_1d_open); CeedChkBackend(ierr);
+  memcpy(impl->interp_1d, interp_1d, Q_1d*P_1d*sizeof(interp_1d[0]));
+  memcpy(impl->grad_1d, grad_1d, Q_1d*P_1d*sizeof(grad_1d[0]));
+  memcpy(impl->interp_1d_open, interp_1d_open,
+         Q_1d*(P_1d-1)*sizeof(interp_1d_open[0]));
+  ierr = CeedBasisSetData(basis, impl); CeedChkBackend(ierr);
+
+  Ceed parent;
+  ierr = CeedGetParent(ceed, &parent); CeedChkBackend(ierr);
+  CeedTensorContract contract;
+  ierr = CeedTensorContractCreate(parent, basis, &contract); CeedChkBackend(ierr);
+  ierr = CeedBasisSetTensorContract(basis, contract); CeedChkBackend(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
+                                CeedBasisApplyTensorHdiv_Ref);
+  CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
+                                CeedBasisDestroyTensorHdiv_Ref);
+  CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Collapsed Basis Level Contraction
+//   Applies the (Q_1d * n) matrix f of the 1D functions of one level, function
+//   k multiplying function parent[k] of the level above.  In NOTRANSPOSE, u is
+//   (n * T * num_elem) and is added into v, (num_parent * T * Q_1d * num_elem);
+//   in TRANSPOSE, u and v are swapped and v is overwritten.
+//------------------------------------------------------------------------------
+static void CeedBasisContractCollapsed_Ref(CeedInt n, const CeedInt *parent,
+    CeedInt T, CeedInt Q_1d, CeedInt num_elem, const CeedScalar *f,
+    CeedTransposeMode t_mode, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  for (CeedInt k=0; k<n; k++) {
+    const CeedInt p = parent ? parent[k] : 0;
+    for (CeedInt t=0; t<T; t++) {
+      const CeedInt nodes = (k*T + t)*num_elem;
+      if (t_mode == CEED_TRANSPOSE) {
+        for (CeedInt e=0; e<num_elem; e++)
+          v[nodes + e] = 0.0;
+        for (CeedInt q=0; q<Q_1d; q++) {
+          const CeedInt qpts = ((p*T + t)*Q_1d + q)*num_elem;
+          const CeedScalar f_qk = f[q*n + k];
+          CeedPragmaSIMD
+          for (CeedInt e=0; e<num_elem; e++)
+            v[nodes + e] += f_qk*u[qpts + e];
+        }
+      } else {
+        for (CeedInt q=0; q<Q_1d; q++) {
+          const CeedInt qpts = ((p*T + t)*Q_1d + q)*num_elem;
+          const CeedScalar f_qk = f[q*n + k];
+          CeedPragmaSIMD
+          for (CeedInt e=0; e<num_elem; e++)
+            v[qpts + e] += f_qk*u[nodes + e];
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Collapsed Basis Contractions
+//   Applies all levels to one component, with the derivative in collapsed
+//   coordinate d_grad, or none if d_grad < 0; v is overwritten
+//------------------------------------------------------------------------------
+static void CeedBasisContractAllCollapsed_Ref(CeedBasis_Ref *impl,
+    CeedInt dim, CeedInt num_elem, CeedInt d_grad, CeedTransposeMode t_mode,
+    const CeedScalar *u, CeedScalar *v, CeedScalar *tmp[2]) {
+  const CeedInt Q_1d = impl->Q_1d, *num_funcs = impl->num_funcs;
+  CeedInt offsets[3], T = 1;
+  for (CeedInt l=0, offset=0; l<dim; l++) {
+    offsets[l] = offset;
+    offset += num_funcs[l];
+  }
+  if (t_mode == CEED_TRANSPOSE)
+    T = CeedIntPow(Q_1d, dim-1);
+  for (CeedInt s=0; s<dim; s++) {
+    const CeedInt l = t_mode == CEED_TRANSPOSE ? s : dim-1-s;
+    const CeedScalar *f = (l == d_grad ? impl->grad_1d : impl->interp_1d) +
+                          Q_1d*offsets[l];
+    const CeedInt *parent = l > 0 ? &impl->parents[offsets[l]-num_funcs[0]] :
+                            NULL;
+    CeedScalar *out = s == dim-1 ? v : tmp[s%2];
+    if (t_mode != CEED_TRANSPOSE) {
+      const CeedInt out_len = (l > 0 ? num_funcs[l-1] : 1)*T*Q_1d*num_elem;
+      for (CeedInt i=0; i<out_len; i++)
+        out[i] = 0.0;
+    }
+    CeedBasisContractCollapsed_Ref(num_funcs[l], parent, T, Q_1d, num_elem, f,
+                                   t_mode, s == 0 ? u : tmp[(s+1)%2], out);
+    if (t_mode == CEED_TRANSPOSE) T /= Q_1d;
+    else T *= Q_1d;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Collapsed
+//   Interpolation and derivatives in the collapsed coordinates are sums of
+//   products of 1D functions, applied one coordinate at a time; the gradient
+//   follows from the derivatives of the collapsed coordinates at each point
+//------------------------------------------------------------------------------
+static int CeedBasisApplyCollapsed_Ref(CeedBasis basis, CeedInt num_elem,
+                                       CeedTransposeMode t_mode,
+                                       CeedEvalMode eval_mode,
+                                       CeedVector U, CeedVector V) {
+  int ierr, ierr2;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChkBackend(ierr);
+  CeedInt dim, num_comp, num_nodes, num_qpts;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &num_nodes); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &num_qpts); CeedChkBackend(ierr);
+  CeedBasis_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChkBackend(ierr);
+  const CeedScalar *u;
+  CeedScalar *v;
+  if (U != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u); CeedChkBackend(ierr);
+  } else if (eval_mode != CEED_EVAL_WEIGHT) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND,
+                     "An input vector is required for this CeedEvalMode");
+    // LCOV_EXCL_STOP
+  }
+  ierr = CeedVectorGetArrayWrite(V, CEED_MEM_HOST, &v); CeedChkBackend(ierr);
+
+  // Intermediate arrays hold the partial sums between two levels
+  const CeedInt Q_1d = impl->Q_1d;
+  size_t tmp_len = 0;
+  for (CeedInt l=1; l<dim; l++) {
+    const size_t len = impl->num_funcs[l-1]*CeedIntPow(Q_1d, dim-l);
+    if (len > tmp_len) tmp_len = len;
+  }
+  tmp_len *= num_elem;
+  switch (eval_mode) {
+  // Interpolate to/from quadrature points
+  case CEED_EVAL_INTERP: {
+    CeedScalar *tmp[2] = {NULL, NULL};
+    ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[0]);
+    if (ierr) { goto collapsed_interp_cleanup; } CeedChkBackend(ierr);
+    ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[1]);
+    if (ierr) { goto collapsed_interp_cleanup; } CeedChkBackend(ierr);
+    for (CeedInt c=0; c<num_comp; c++) {
+      const CeedInt nodes = c*num_nodes*num_elem, qpts = c*num_qpts*num_elem;
+      if (t_mode == CEED_TRANSPOSE)
+        CeedBasisContractAllCollapsed_Ref(impl, dim, num_elem, -1, t_mode,
+                                          &u[qpts], &v[nodes], tmp);
+      else
+        CeedBasisContractAllCollapsed_Ref(impl, dim, num_elem, -1, t_mode,
+                                          &u[nodes], &v[qpts], tmp);
+    }
+collapsed_interp_cleanup:
+    ierr2 = CeedRestoreWorkArray(ceed, &tmp[1]); CeedChkBackend(ierr2);
+    ierr2 = CeedRestoreWorkArray(ceed, &tmp[0]); CeedChkBackend(ierr2);
+    CeedChkBackend(ierr);
+  } break;
+  // Evaluate the gradient to/from quadrature points
+  case CEED_EVAL_GRAD: {
+    const CeedInt qpts_len = num_qpts*num_elem, nodes_len = num_nodes*num_elem;
+    const CeedScalar *d_eta = impl->d_eta;
+    CeedScalar *tmp[2] = {NULL, NULL}, *d_u = NULL;
+    ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[0]);
+    if (ierr) { goto collapsed_grad_cleanup; } CeedChkBackend(ierr);
+    ierr = CeedGetWorkArray(ceed, tmp_len, &tmp[1]);
+    if (ierr) { goto collapsed_grad_cleanup; } CeedChkBackend(ierr);
+    ierr = CeedGetWorkArray(ceed, dim*qpts_len + nodes_len, &d_u);
+    if (ierr) { goto collapsed_grad_cleanup; } CeedChkBackend(ierr);
+    for (CeedInt c=0; c<num_comp; c++) {
+      if (t_mode == CEED_TRANSPOSE) {
+        // Chain rule to the collapsed coordinates, then each derivative
+        CeedScalar *v_c = &v[c*nodes_len], *v_e = &d_u[dim*qpts_len];
+        for (CeedInt e=0; e<dim; e++)
+          for (CeedInt q=0; q<num_qpts; q++) {
+            CeedScalar *d_u_q = &d_u[e*qpts_len + q*num_elem];
+            for (CeedInt i=0; i<num_elem; i++)
+              d_u_q[i] = 0.0;
+            for (CeedInt d=0; d<dim; d++) {
+              const CeedScalar j_de = d_eta[(d*dim + e)*num_qpts + q],
+                               *u_q = &u[((d*num_comp + c)*num_qpts + q)*num_elem];
+              if (j_de == 0.0) continue;
+              CeedPragmaSIMD
+              for (CeedInt i=0; i<num_elem; i++)
+                d_u_q[i] += j_de*u_q[i];
+            }
+          }
+        for (CeedInt i=0; i<nodes_len; i++)
+          v_c[i] = 0.0;
+        for (CeedInt e=0; e<dim; e++) {
+          CeedBasisContractAllCollapsed_Ref(impl, dim, num_elem, e, t_mode,
+                                            &d_u[e*qpts_len], v_e, tmp);
+          CeedPragmaSIMD
+          for (CeedInt i=0; i<nodes_len; i++)
+            v_c[i] += v_e[i];
+        }
+      } else {
+        // Each derivative in the collapsed coordinates, then chain rule
+        for (CeedInt e=0; e<dim; e++)
+          CeedBasisContractAllCollapsed_Ref(impl, dim, num_elem, e, t_mode,
+                                            &u[c*nodes_len], &d_u[e*qpts_len],
+                                            tmp);
+        for (CeedInt d=0; d<dim; d++)
+          for (CeedInt q=0; q<num_qpts; q++) {
+            CeedScalar *v_q = &v[((d*num_comp + c)*num_qpts + q)*num_elem];
+            for (CeedInt i=0; i<num_elem; i++)
+              v_q[i] = 0.0;
+            for (CeedInt e=0; e<dim; e++) {
+              const CeedScalar j_de = d_eta[(d*dim + e)*num_qpts + q],
+                               *d_u_q = &d_u[e*qpts_len + q*num_elem];
+              if (j_de == 0.0) continue;
+              CeedPragmaSIMD
+              for (CeedInt i=0; i<num_elem; i++)
+                v_q[i] += j_de*d_u_q[i];
+            }
+          }
+      }
+    }
+collapsed_grad_cleanup:
+    ierr2 = CeedRestoreWorkArray(ceed, &d_u); CeedChkBackend(ierr2);
+    ierr2 = CeedRestoreWorkArray(ceed, &tmp[1]); CeedChkBackend(ierr2);
+    ierr2 = CeedRestoreWorkArray(ceed, &tmp[0]); CeedChkBackend(ierr2);
+    CeedChkBackend(ierr);
+  } break;
+  // Retrieve interpolation weights
+  case CEED_EVAL_WEIGHT: {
+    if (t_mode == CEED_TRANSPOSE)
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_BACKEND,
+                       "CEED_EVAL_WEIGHT incompatible with CEED_TRANSPOSE");
+    // LCOV_EXCL_STOP
+    const CeedScalar *q_weight;
+    ierr = CeedBasisGetQWeights(basis, &q_weight); CeedChkBackend(ierr);
+    for (CeedInt i=0; i<num_qpts; i++)
+      for (CeedInt e=0; e<num_elem; e++)
+        v[i*num_elem + e] = q_weight[i];
+  } break;
+  // LCOV_EXCL_START
+  // Evaluate the divergence or curl to/from the quadrature points
+  case CEED_EVAL_DIV:
+    return CeedError(ceed, CEED_ERROR_BACKEND,
+                     "CEED_EVAL_DIV not supported for H^1 bases");
+  case CEED_EVAL_CURL:
+    return CeedError(ceed, CEED_ERROR_BACKEND, "CEED_EVAL_CURL not supported");
+  // Take no action, BasisApply should not have been called
+  case CEED_EVAL_NONE:
+    return CeedError(ceed, CEED_ERROR_BACKEND,
+                     "CEED_EVAL_NONE does not make sense in this context");
+    // LCOV_EXCL_STOP
+  }
+  if (U != CEED_VECTOR_NONE) {
+    ierr = CeedVectorRestoreArrayRead(U, &u); CeedChkBackend(ierr);
+  }
+  ierr = CeedVectorRestoreArray(V, &v); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Destroy Collapsed
+//------------------------------------------------------------------------------
+static int CeedBasisDestroyCollapsed_Ref(CeedBasis basis) {
+  int ierr;
+
+  CeedBasis_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->interp_1d); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->grad_1d); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->parents); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->d_eta); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Create Collapsed
+//------------------------------------------------------------------------------
+int CeedBasisCreateH1Collapsed_Ref(CeedElemTopology topo, CeedInt dim,
+                                   CeedInt Q_1d, const CeedInt *num_funcs,
+                                   const CeedInt *parents,
+                                   const CeedScalar *interp_1d,
+                                   const CeedScalar *grad_1d,
+                                   const CeedScalar *d_eta, CeedBasis basis) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChkBackend(ierr);
+  CeedInt num_total = 0;
+  for (CeedInt l=0; l<dim; l++)
+    num_total += num_funcs[l];
+  const CeedInt num_qpts = CeedIntPow(Q_1d, dim);
+  CeedBasis_Ref *impl;
+  ierr = CeedCalloc(1, &impl); CeedChkBackend(ierr);
+  impl->Q_1d = Q_1d;
+  for (CeedInt l=0; l<dim; l++)
+    impl->num_funcs[l] = num_funcs[l];
+  ierr = CeedMalloc(Q_1d*num_total, &impl->interp_1d); CeedChkBackend(ierr);
+  ierr = CeedMalloc(Q_1d*num_total, &impl->grad_1d); CeedChkBackend(ierr);
+  ierr = CeedMalloc(num_total - num_funcs[0], &impl->parents);
+  CeedChkBackend(ierr);
+  ierr = CeedMalloc(dim*dim*num_qpts, &impl->d_eta); CeedChkBackend(ierr);
+  memcpy(impl->interp_1d, interp_1d, Q_1d*num_total*sizeof(interp_1d[0]));
+  memcpy(impl->grad_1d, grad_1d, Q_1d*num_total*sizeof(grad_1d[0]));
+  memcpy(impl->parents, parents,
+         (num_total - num_funcs[0])*sizeof(parents[0]));
+  memcpy(impl->d_eta, d_eta, dim*dim*num_qpts*sizeof(d_eta[0]));
+  ierr = CeedBasisSetData(basis, impl); CeedChkBackend(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
+                                CeedBasisApplyCollapsed_Ref);
+  CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
+                                CeedBasisDestroyCollapsed_Ref);
+  CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Basis Destroy Tensor
 //------------------------------------------------------------------------------
@@ -377,6 +960,9 @@ static int CeedBasisDestroyTensor_Ref(CeedBasis basis) {
   CeedBasis_Ref *impl;
   ierr = CeedBasisGetData(basis, &impl); CeedChkBackend(ierr);
   ierr = CeedFree(&impl->collo_grad_1d); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->interp_1d_even_odd); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->grad_1d_even_odd); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->collo_grad_1d_even_odd); CeedChkBackend(ierr);
   ierr = CeedFree(&impl); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
@@ -421,6 +1007,40 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d,
   ierr = CeedTensorContractCreate(parent, basis, &contract); CeedChkBackend(ierr);
   ierr = CeedBasisSetTensorContract(basis, contract); CeedChkBackend(ierr);
 
+  // Fixed size kernels, only in place of loop nest contractions; interpolation
+  //   with collocated nodes is a copy
+  bool is_fusable;
+  ierr = CeedTensorContractIsFusable_Ref(contract, &is_fusable);
+  CeedChkBackend(ierr);
+  for (CeedInt t=0; t<2 && is_fusable; t++) {
+    if (!impl->has_collo_interp) {
+      ierr = CeedBasisGetFusedKernel_Ref(P_1d, Q_1d, dim, CEED_EVAL_INTERP,
+                                         (CeedTransposeMode)t,
+                                         &impl->fused_interp[t]);
+      CeedChkBackend(ierr);
+    }
+    ierr = CeedBasisGetFusedKernel_Ref(P_1d, Q_1d, dim, CEED_EVAL_GRAD,
+                                       (CeedTransposeMode)t, &impl->fused_grad[t]);
+    CeedChkBackend(ierr);
+  }
+
+  // Even-odd folding for symmetric nodes and quadrature points
+  if (!impl->has_collo_interp) {
+    ierr = CeedTensorContractFoldEvenOdd(contract, Q_1d, P_1d, interp_1d, 1,
+                                         &impl->interp_1d_even_odd);
+    CeedChkBackend(ierr);
+  }
+  if (impl->collo_grad_1d) {
+    ierr = CeedTensorContractFoldEvenOdd(contract, Q_1d, Q_1d,
+                                         impl->collo_grad_1d, -1,
+                                         &impl->collo_grad_1d_even_odd);
+    CeedChkBackend(ierr);
+  } else {
+    ierr = CeedTensorContractFoldEvenOdd(contract, Q_1d, P_1d, grad_1d, -1,
+                                         &impl->grad_1d_even_odd);
+    CeedChkBackend(ierr);
+  }
+
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
                                 CeedBasisApply_Ref); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
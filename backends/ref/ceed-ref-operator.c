@@ -70,6 +70,7 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
       break;
     case CEED_EVAL_INTERP:
     case CEED_EVAL_GRAD:
+    case CEED_EVAL_DIV:
       ierr = CeedOperatorFieldGetBasis(op_fields[i], &basis); CeedChkBackend(ierr);
       ierr = CeedQFunctionFieldGetSize(qf_fields[i], &size); CeedChkBackend(ierr);
       ierr = CeedBasisGetNumNodes(basis, &P); CeedChkBackend(ierr);
@@ -83,8 +84,6 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
       ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
                             CEED_VECTOR_NONE, q_vecs[i]); CeedChkBackend(ierr);
       break;
-    case CEED_EVAL_DIV:
-      break; // Not implemented
     case CEED_EVAL_CURL:
       break; // Not implemented
     }
@@ -121,6 +120,8 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   // Allocate
   ierr = CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full);
   CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_blk);
+  CeedChkBackend(ierr);
 
   ierr = CeedCalloc(CEED_FIELD_MAX, &impl->input_states); CeedChkBackend(ierr);
   ierr = CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_in); CeedChkBackend(ierr);
@@ -168,13 +169,73 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Restrict a Range of Elements, One Restriction Block at a Time
+//------------------------------------------------------------------------------
+static int CeedOperatorRestrictRange_Ref(CeedElemRestriction elem_restr,
+    CeedInt e_start, CeedInt e_end, CeedTransposeMode t_mode, CeedVector l_vec,
+    CeedVector e_vec, CeedVector *e_vec_blk) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(elem_restr, &ceed); CeedChkBackend(ierr);
+  CeedInt blk_size, elem_size, num_comp;
+  ierr = CeedElemRestrictionGetBlockSize(elem_restr, &blk_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(elem_restr, &elem_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(elem_restr, &num_comp);
+  CeedChkBackend(ierr);
+  const CeedInt blk_len = blk_size*elem_size*num_comp,
+                first_blk = e_start/blk_size,
+                last_blk = (e_end/blk_size) + !!(e_end%blk_size);
+  CeedScalar *e_data;
+
+  // Single block view into the Evec, kept for later ranges
+  if (!*e_vec_blk) {
+    ierr = CeedVectorCreate(ceed, blk_len, e_vec_blk); CeedChkBackend(ierr);
+  }
+  if (t_mode == CEED_NOTRANSPOSE) {
+    ierr = CeedVectorGetArrayWrite(e_vec, CEED_MEM_HOST, &e_data);
+    CeedChkBackend(ierr);
+  } else {
+    ierr = CeedVectorGetArrayRead(e_vec, CEED_MEM_HOST,
+                                  (const CeedScalar **) &e_data);
+    CeedChkBackend(ierr);
+  }
+
+  // Restrict whole blocks covering the range
+  for (CeedInt b=first_blk; b<last_blk; b++) {
+    ierr = CeedVectorSetArray(*e_vec_blk, CEED_MEM_HOST, CEED_USE_POINTER,
+                              &e_data[b*blk_len]);
+    CeedChkBackend(ierr);
+    if (t_mode == CEED_NOTRANSPOSE) {
+      ierr = CeedElemRestrictionApplyBlock(elem_restr, b, CEED_NOTRANSPOSE, l_vec,
+                                           *e_vec_blk, CEED_REQUEST_IMMEDIATE);
+    } else {
+      ierr = CeedElemRestrictionApplyBlock(elem_restr, b, CEED_TRANSPOSE,
+                                           *e_vec_blk, l_vec,
+                                           CEED_REQUEST_IMMEDIATE);
+    }
+    CeedChkBackend(ierr);
+  }
+
+  // Cleanup
+  if (t_mode == CEED_NOTRANSPOSE) {
+    ierr = CeedVectorRestoreArray(e_vec, &e_data); CeedChkBackend(ierr);
+  } else {
+    ierr = CeedVectorRestoreArrayRead(e_vec, (const CeedScalar **) &e_data);
+    CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator Inputs
 //------------------------------------------------------------------------------
 static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields,
     CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-    CeedVector in_vec, const bool skip_active,
-    CeedScalar *e_data_full[2*CEED_FIELD_MAX],
+    CeedVector in_vec, const bool skip_active, CeedInt e_start, CeedInt e_end,
+    CeedInt num_elem, CeedScalar *e_data_full[2*CEED_FIELD_MAX],
     CeedOperator_Ref *impl, CeedRequest *request) {
   CeedInt ierr;
   CeedEvalMode eval_mode;
@@ -204,10 +265,21 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields,
       if (state != impl->input_states[i] || vec == in_vec) {
         ierr = CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_restr);
         CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, vec,
-                                        impl->e_vecs_full[i], request);
-        CeedChkBackend(ierr);
-        impl->input_states[i] = state;
+        if (e_start == 0 && e_end == num_elem) {
+          ierr = CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, vec,
+                                          impl->e_vecs_full[i],
+                                          CEED_REQUEST_IMMEDIATE);
+          CeedChkBackend(ierr);
+          impl->input_states[i] = state;
+        } else {
+          ierr = CeedOperatorRestrictRange_Ref(elem_restr, e_start, e_end,
+                                               CEED_NOTRANSPOSE, vec,
+                                               impl->e_vecs_full[i],
+                                               &impl->e_vecs_blk[i]);
+          CeedChkBackend(ierr);
+          // Only part of the Evec is current, never skip the next restriction
+          impl->input_states[i] = UINT64_MAX;
+        }
       }
       // Get evec
       ierr = CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST,
@@ -226,7 +298,7 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
     CeedInt num_input_fields, const bool skip_active,
     CeedScalar *e_data_full[2*CEED_FIELD_MAX], CeedOperator_Ref *impl) {
   CeedInt ierr;
-  CeedInt dim, elem_size, size;
+  CeedInt dim, Q_comp, elem_size, size;
   CeedElemRestriction elem_restr;
   CeedEvalMode eval_mode;
   CeedBasis basis;
@@ -259,8 +331,11 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
       CeedChkBackend(ierr);
+      ierr = CeedBasisGetNumQuadratureComponents(basis, &Q_comp);
+      CeedChkBackend(ierr);
       ierr = CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER, &e_data_full[i][e*elem_size*size]);
+                                CEED_USE_POINTER,
+                                &e_data_full[i][e*elem_size*size/Q_comp]);
       CeedChkBackend(ierr);
       ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP,
                             impl->e_vecs_in[i], impl->q_vecs_in[i]); CeedChkBackend(ierr);
@@ -276,10 +351,18 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
                             CEED_EVAL_GRAD, impl->e_vecs_in[i],
                             impl->q_vecs_in[i]); CeedChkBackend(ierr);
       break;
+    case CEED_EVAL_DIV:
+      ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, &e_data_full[i][e*elem_size*size]);
+      CeedChkBackend(ierr);
+      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_DIV,
+                            impl->e_vecs_in[i], impl->q_vecs_in[i]); CeedChkBackend(ierr);
+      break;
     case CEED_EVAL_WEIGHT:
       break;  // No action
     // LCOV_EXCL_START
-    case CEED_EVAL_DIV:
     case CEED_EVAL_CURL: {
       ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
       CeedChkBackend(ierr);
@@ -302,7 +385,7 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
     CeedInt num_input_fields, CeedInt num_output_fields, CeedOperator op,
     CeedScalar *e_data_full[2*CEED_FIELD_MAX], CeedOperator_Ref *impl) {
   CeedInt ierr;
-  CeedInt dim, elem_size, size;
+  CeedInt dim, Q_comp, elem_size, size;
   CeedElemRestriction elem_restr;
   CeedEvalMode eval_mode;
   CeedBasis basis;
@@ -324,9 +407,11 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(op_output_fields[i], &basis);
       CeedChkBackend(ierr);
+      ierr = CeedBasisGetNumQuadratureComponents(basis, &Q_comp);
+      CeedChkBackend(ierr);
       ierr = CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST,
                                 CEED_USE_POINTER,
-                                &e_data_full[i + num_input_fields][e*elem_size*size]);
+                                &e_data_full[i + num_input_fields][e*elem_size*size/Q_comp]);
       CeedChkBackend(ierr);
       ierr = CeedBasisApply(basis, 1, CEED_TRANSPOSE,
                             CEED_EVAL_INTERP, impl->q_vecs_out[i],
@@ -344,6 +429,17 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
                             CEED_EVAL_GRAD, impl->q_vecs_out[i],
                             impl->e_vecs_out[i]); CeedChkBackend(ierr);
       break;
+    case CEED_EVAL_DIV:
+      ierr = CeedOperatorFieldGetBasis(op_output_fields[i], &basis);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER,
+                                &e_data_full[i + num_input_fields][e*elem_size*size]);
+      CeedChkBackend(ierr);
+      ierr = CeedBasisApply(basis, 1, CEED_TRANSPOSE,
+                            CEED_EVAL_DIV, impl->q_vecs_out[i],
+                            impl->e_vecs_out[i]); CeedChkBackend(ierr);
+      break;
     // LCOV_EXCL_START
     case CEED_EVAL_WEIGHT: {
       Ceed ceed;
@@ -352,7 +448,6 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
                        "CEED_EVAL_WEIGHT cannot be an output "
                        "evaluation mode");
     }
-    case CEED_EVAL_DIV:
     case CEED_EVAL_CURL: {
       Ceed ceed;
       ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
@@ -398,10 +493,13 @@ static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Core code for operator apply on a range of elements, overwriting the outputs
+//   instead of summing into them if is_add is false
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
-                                    CeedVector out_vec, CeedRequest *request) {
+static int CeedOperatorApplyAddCore_Ref(CeedOperator op, CeedInt e_start,
+                                        CeedInt e_end, bool is_add,
+                                        CeedVector in_vec, CeedVector out_vec,
+                                        CeedRequest *request) {
   int ierr;
   CeedOperator_Ref *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
@@ -422,6 +520,7 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
   CeedVector vec;
   CeedElemRestriction elem_restr;
   CeedScalar *e_data_full[2*CEED_FIELD_MAX] = {0};
+  const bool is_full = e_start == 0 && e_end == num_elem;
 
   // Setup
   ierr = CeedOperatorSetup_Ref(op); CeedChkBackend(ierr);
@@ -430,21 +529,41 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
   if (impl->is_identity_restr_op) {
     ierr = CeedOperatorFieldGetElemRestriction(op_input_fields[0], &elem_restr);
     CeedChkBackend(ierr);
-    ierr = CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, in_vec,
-                                    impl->e_vecs_full[0], request);
+    if (is_full) {
+      ierr = CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, in_vec,
+                                      impl->e_vecs_full[0],
+                                      CEED_REQUEST_IMMEDIATE);
+    } else {
+      ierr = CeedOperatorRestrictRange_Ref(elem_restr, e_start, e_end,
+                                           CEED_NOTRANSPOSE, in_vec,
+                                           impl->e_vecs_full[0],
+                                           &impl->e_vecs_blk[0]);
+    }
     CeedChkBackend(ierr);
     ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[0], &elem_restr);
     CeedChkBackend(ierr);
-    ierr = CeedElemRestrictionApply(elem_restr, CEED_TRANSPOSE,
-                                    impl->e_vecs_full[0],
-                                    out_vec, request); CeedChkBackend(ierr);
+    if (!is_add) {
+      ierr = CeedElemRestrictionApplyTransposeOverwrite(elem_restr,
+             impl->e_vecs_full[0], out_vec, CEED_REQUEST_IMMEDIATE);
+    } else if (is_full) {
+      ierr = CeedElemRestrictionApply(elem_restr, CEED_TRANSPOSE,
+                                      impl->e_vecs_full[0], out_vec,
+                                      CEED_REQUEST_IMMEDIATE);
+    } else {
+      ierr = CeedOperatorRestrictRange_Ref(elem_restr, e_start, e_end,
+                                           CEED_TRANSPOSE, out_vec,
+                                           impl->e_vecs_full[0],
+                                           &impl->e_vecs_blk[impl->num_inputs]);
+    }
+    CeedChkBackend(ierr);
     return CEED_ERROR_SUCCESS;
   }
 
   // Input Evecs and Restriction
   ierr = CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields,
-                                     op_input_fields, in_vec, false, e_data_full, impl,
-                                     request); CeedChkBackend(ierr);
+                                     op_input_fields, in_vec, false, e_start,
+                                     e_end, num_elem, e_data_full, impl, request);
+  CeedChkBackend(ierr);
 
   // Output Evecs
   for (CeedInt i=0; i<num_output_fields; i++) {
@@ -454,7 +573,7 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
   }
 
   // Loop through elements
-  for (CeedInt e=0; e<num_elem; e++) {
+  for (CeedInt e=e_start; e<e_end; e++) {
     // Output pointers
     for (CeedInt i=0; i<num_output_fields; i++) {
       ierr = CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode);
@@ -495,15 +614,35 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
     // Get output vector
     ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
     CeedChkBackend(ierr);
+    // Overwrite with the first field of each output vector
+    bool is_overwrite = !is_add;
+    for (CeedInt j=0; j<i && is_overwrite; j++) {
+      CeedVector vec_j;
+      ierr = CeedOperatorFieldGetVector(op_output_fields[j], &vec_j);
+      CeedChkBackend(ierr);
+      is_overwrite = vec_j != vec;
+    }
     // Active
     if (vec == CEED_VECTOR_ACTIVE)
       vec = out_vec;
     // Restrict
     ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_restr);
     CeedChkBackend(ierr);
-    ierr = CeedElemRestrictionApply(elem_restr, CEED_TRANSPOSE,
-                                    impl->e_vecs_full[i+impl->num_inputs],
-                                    vec, request); CeedChkBackend(ierr);
+    if (is_overwrite) {
+      ierr = CeedElemRestrictionApplyTransposeOverwrite(elem_restr,
+             impl->e_vecs_full[i+impl->num_inputs], vec,
+             CEED_REQUEST_IMMEDIATE);
+    } else if (is_full) {
+      ierr = CeedElemRestrictionApply(elem_restr, CEED_TRANSPOSE,
+                                      impl->e_vecs_full[i+impl->num_inputs],
+                                      vec, CEED_REQUEST_IMMEDIATE);
+    } else {
+      ierr = CeedOperatorRestrictRange_Ref(elem_restr, e_start, e_end,
+                                           CEED_TRANSPOSE, vec,
+                                           impl->e_vecs_full[i+impl->num_inputs],
+                                           &impl->e_vecs_blk[i+impl->num_inputs]);
+    }
+    CeedChkBackend(ierr);
   }
 
   // Restore input arrays
@@ -514,6 +653,41 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApply_Ref(CeedOperator op, CeedVector in_vec,
+                                 CeedVector out_vec, CeedRequest *request) {
+  int ierr;
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+
+  return CeedOperatorApplyAddCore_Ref(op, 0, num_elem, false, in_vec, out_vec,
+                                      request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply and Add
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
+                                    CeedVector out_vec, CeedRequest *request) {
+  int ierr;
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+
+  return CeedOperatorApplyAddCore_Ref(op, 0, num_elem, true, in_vec, out_vec,
+                                      request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on a Range of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddRange_Ref(CeedOperator op, CeedInt e_start,
+    CeedInt e_end, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddCore_Ref(op, e_start, e_end, true, in_vec, out_vec,
+                                      request);
+}
+
 //------------------------------------------------------------------------------
 // Core code for assembling linear QFunction
 //------------------------------------------------------------------------------
@@ -560,8 +734,9 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op,
 
   // Input Evecs and Restriction
   ierr = CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields,
-                                     op_input_fields, NULL, true, e_data_full,
-                                     impl, request); CeedChkBackend(ierr);
+                                     op_input_fields, NULL, true, 0, num_elem,
+                                     num_elem, e_data_full, impl, request);
+  CeedChkBackend(ierr);
 
   // Count number of active input fields
   if (!num_active_in) {
@@ -718,8 +893,10 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
 
   for (CeedInt i=0; i<impl->num_inputs+impl->num_outputs; i++) {
     ierr = CeedVectorDestroy(&impl->e_vecs_full[i]); CeedChkBackend(ierr);
+    ierr = CeedVectorDestroy(&impl->e_vecs_blk[i]); CeedChkBackend(ierr);
   }
   ierr = CeedFree(&impl->e_vecs_full); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->e_vecs_blk); CeedChkBackend(ierr);
   ierr = CeedFree(&impl->input_states); CeedChkBackend(ierr);
 
   for (CeedInt i=0; i<impl->num_inputs; i++) {
@@ -746,6 +923,395 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Check if Two Sub-Operators Share Mutable State
+//------------------------------------------------------------------------------
+static int CeedOperatorCompositeConflict_Ref(CeedOperator op_a,
+    CeedOperator op_b, bool *conflict) {
+  int ierr;
+  CeedQFunction qf_a, qf_b;
+  CeedQFunctionContext ctx_a, ctx_b;
+  CeedOperatorField *fields_a[2], *fields_b[2];
+  CeedInt num_a[2], num_b[2];
+  CeedVector vec_a, vec_b;
+  CeedElemRestriction rstr_a, rstr_b;
+
+  // QFunctions and their contexts hold scratch and access locks
+  ierr = CeedOperatorGetQFunction(op_a, &qf_a); CeedChkBackend(ierr);
+  ierr = CeedOperatorGetQFunction(op_b, &qf_b); CeedChkBackend(ierr);
+  ierr = CeedQFunctionGetContext(qf_a, &ctx_a); CeedChkBackend(ierr);
+  ierr = CeedQFunctionGetContext(qf_b, &ctx_b); CeedChkBackend(ierr);
+  *conflict = qf_a == qf_b || (ctx_a && ctx_a == ctx_b);
+  if (*conflict) return CEED_ERROR_SUCCESS;
+
+  // Passive vectors hold access locks and restrictions build data on first
+  //   use, active vectors are replaced by views and accumulators
+  ierr = CeedOperatorGetFields(op_a, &num_a[0], &fields_a[0], &num_a[1],
+                               &fields_a[1]); CeedChkBackend(ierr);
+  ierr = CeedOperatorGetFields(op_b, &num_b[0], &fields_b[0], &num_b[1],
+                               &fields_b[1]); CeedChkBackend(ierr);
+  for (CeedInt s=0; s<2; s++)
+    for (CeedInt i=0; i<num_a[s]; i++) {
+      ierr = CeedOperatorFieldGetVector(fields_a[s][i], &vec_a);
+      CeedChkBackend(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(fields_a[s][i], &rstr_a);
+      CeedChkBackend(ierr);
+      for (CeedInt t=0; t<2; t++)
+        for (CeedInt j=0; j<num_b[t]; j++) {
+          ierr = CeedOperatorFieldGetVector(fields_b[t][j], &vec_b);
+          CeedChkBackend(ierr);
+          ierr = CeedOperatorFieldGetElemRestriction(fields_b[t][j], &rstr_b);
+          CeedChkBackend(ierr);
+          if ((vec_a == vec_b && vec_a != CEED_VECTOR_ACTIVE &&
+               vec_a != CEED_VECTOR_NONE) ||
+              (rstr_a == rstr_b && rstr_a != CEED_ELEMRESTRICTION_NONE)) {
+            *conflict = true;
+            return CEED_ERROR_SUCCESS;
+          }
+        }
+    }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Free Composite Operator Schedule
+//------------------------------------------------------------------------------
+static int CeedOperatorCompositeFreeSchedule_Ref(CeedOperatorComposite_Ref
+    *impl) {
+  int ierr;
+
+  for (CeedInt i=0; i<impl->num_sub; i++) {
+    ierr = CeedVectorDestroy(&impl->in_vecs[i]); CeedChkBackend(ierr);
+    ierr = CeedVectorDestroy(&impl->acc_vecs[i]); CeedChkBackend(ierr);
+  }
+  ierr = CeedFree(&impl->in_vecs); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->acc_vecs); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->serial_subs); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->wave_offsets); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->wave_subs); CeedChkBackend(ierr);
+  impl->num_sub = 0;
+  impl->is_setup = false;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Composite Operator Schedule
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupComposite_Ref(CeedOperator op,
+    CeedInt num_threads) {
+  int ierr;
+  CeedOperatorComposite_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedInt num_sub;
+  ierr = CeedOperatorGetNumSub(op, &num_sub); CeedChkBackend(ierr);
+  CeedOperator *sub_ops;
+  ierr = CeedOperatorGetSubList(op, &sub_ops); CeedChkBackend(ierr);
+  CeedInt num_elem[num_sub], wave[num_sub], total_elem = 0, num_concurrent = 0;
+
+  for (CeedInt i=0; i<num_sub; i++) {
+    ierr = CeedOperatorGetNumElements(sub_ops[i], &num_elem[i]);
+    CeedChkBackend(ierr);
+    total_elem += num_elem[i];
+  }
+
+  // Sub-operators large enough to fill the threads on their own run one after
+  //   another; the rest run concurrently
+  for (CeedInt i=0; i<num_sub; i++) {
+    wave[i] = num_elem[i]*num_threads >= total_elem ? -1 : 0;
+    num_concurrent += wave[i] == 0;
+  }
+  if (num_concurrent < 2)
+    for (CeedInt i=0; i<num_sub; i++) wave[i] = -1;
+
+  // Sub-operators sharing a QFunction or passive vector go in different waves
+  impl->num_waves = 0;
+  for (CeedInt i=0; i<num_sub; i++) {
+    if (wave[i] < 0) continue;
+    for (CeedInt j=0; j<i; j++) {
+      if (wave[j] != wave[i]) continue;
+      bool conflict;
+      ierr = CeedOperatorCompositeConflict_Ref(sub_ops[i], sub_ops[j], &conflict);
+      CeedChkBackend(ierr);
+      if (conflict) {
+        wave[i]++;
+        j = -1;
+      }
+    }
+    impl->num_waves = CeedIntMax(impl->num_waves, wave[i] + 1);
+  }
+
+  // Waves in CSR format, largest sub-operators first within each wave
+  ierr = CeedCalloc(num_sub, &impl->serial_subs); CeedChkBackend(ierr);
+  ierr = CeedCalloc(impl->num_waves + 1, &impl->wave_offsets);
+  CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_sub, &impl->wave_subs); CeedChkBackend(ierr);
+  impl->num_serial = 0;
+  for (CeedInt i=0; i<num_sub; i++)
+    if (wave[i] < 0) impl->serial_subs[impl->num_serial++] = i;
+  for (CeedInt w=0, k=0; w<impl->num_waves; w++) {
+    for (CeedInt i=0; i<num_sub; i++) {
+      if (wave[i] != w) continue;
+      CeedInt j = k++;
+      for (; j>impl->wave_offsets[w] &&
+           num_elem[impl->wave_subs[j-1]] < num_elem[i]; j--)
+        impl->wave_subs[j] = impl->wave_subs[j-1];
+      impl->wave_subs[j] = i;
+    }
+    impl->wave_offsets[w+1] = k;
+  }
+  ierr = CeedCalloc(num_sub, &impl->in_vecs); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_sub, &impl->acc_vecs); CeedChkBackend(ierr);
+
+  impl->num_sub = num_sub;
+  impl->is_setup = true;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Setup Ahead of Apply
+//   The sub-operators are already set up, so the schedule is planned without
+//   the serial first apply
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupApplyComposite_Ref(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  CeedOperatorComposite_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedInt num_sub, num_threads;
+  ierr = CeedOperatorGetNumSub(op, &num_sub); CeedChkBackend(ierr);
+  ierr = CeedGetNumThreads(ceed, &num_threads); CeedChkBackend(ierr);
+
+  if (impl->is_setup && impl->num_sub != num_sub) {
+    ierr = CeedOperatorCompositeFreeSchedule_Ref(impl); CeedChkBackend(ierr);
+  }
+  if (!impl->is_setup && num_threads > 1) {
+    ierr = CeedOperatorSetupComposite_Ref(op, num_threads); CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get Scratch Vector of a Given Length
+//------------------------------------------------------------------------------
+static inline int CeedOperatorCompositeGetVector_Ref(Ceed ceed, CeedInt length,
+    CeedVector *vec) {
+  int ierr;
+
+  if (*vec) {
+    CeedInt vec_length;
+    ierr = CeedVectorGetLength(*vec, &vec_length); CeedChkBackend(ierr);
+    if (vec_length == length) return CEED_ERROR_SUCCESS;
+    ierr = CeedVectorDestroy(vec); CeedChkBackend(ierr);
+  }
+  ierr = CeedVectorCreate(ceed, length, vec); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Task Context
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedOperator *sub_ops;
+  CeedOperatorComposite_Ref *impl;
+  const CeedInt *subs;
+  CeedVector in_vec, out_vec;
+} CeedOperatorCompositeCtx_Ref;
+
+//------------------------------------------------------------------------------
+// Apply One Sub-Operator Into its Private Accumulator
+//------------------------------------------------------------------------------
+static int CeedOperatorCompositeTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  int ierr;
+  CeedOperatorCompositeCtx_Ref *comp = ctx;
+  const CeedInt i = comp->subs[t];
+  CeedOperator sub_op = comp->sub_ops[i];
+  CeedVector in_vec = comp->impl->in_vecs[i] ? comp->impl->in_vecs[i] :
+                      comp->in_vec;
+
+  if (!comp->impl->acc_vecs[i]) {
+    ierr = CeedOperatorApplyAdd(sub_op, in_vec, comp->out_vec,
+                                CEED_REQUEST_IMMEDIATE); CeedChkBackend(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // The sub-operator's own apply overwrites the accumulator, unless passive
+  //   outputs need to be summed into
+  bool has_passive_out = false;
+  CeedInt num_output_fields;
+  CeedOperatorField *op_output_fields;
+  CeedVector vec;
+  ierr = CeedOperatorGetFields(sub_op, NULL, NULL, &num_output_fields,
+                               &op_output_fields); CeedChkBackend(ierr);
+  for (CeedInt j=0; j<num_output_fields; j++) {
+    ierr = CeedOperatorFieldGetVector(op_output_fields[j], &vec);
+    CeedChkBackend(ierr);
+    has_passive_out |= vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE;
+  }
+  if (has_passive_out) {
+    ierr = CeedVectorSetValue(comp->impl->acc_vecs[i], 0.0); CeedChkBackend(ierr);
+    ierr = CeedOperatorApplyAdd(sub_op, in_vec, comp->impl->acc_vecs[i],
+                                CEED_REQUEST_IMMEDIATE); CeedChkBackend(ierr);
+  } else {
+    ierr = CeedOperatorApply(sub_op, in_vec, comp->impl->acc_vecs[i],
+                             CEED_REQUEST_IMMEDIATE); CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Accumulator Reduction Context
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedScalar *out;
+  const CeedScalar **acc;
+  CeedInt num_acc, length, chunk;
+} CeedOperatorCompositeReduceCtx_Ref;
+
+//------------------------------------------------------------------------------
+// Sum Private Accumulators on One Chunk of the Output
+//------------------------------------------------------------------------------
+static int CeedOperatorCompositeReduceTask_Ref(void *ctx, CeedInt t,
+    CeedInt thread) {
+  CeedOperatorCompositeReduceCtx_Ref *reduce = ctx;
+  const CeedInt start = t*reduce->chunk,
+                stop = CeedIntMin(start + reduce->chunk, reduce->length);
+
+  // Fixed sub-operator order keeps the sum deterministic
+  for (CeedInt a=0; a<reduce->num_acc; a++) {
+    const CeedScalar *acc = reduce->acc[a];
+    CeedPragmaSIMD
+    for (CeedInt j=start; j<stop; j++)
+      reduce->out[j] += acc[j];
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Ref(CeedOperator op,
+    CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  CeedOperatorComposite_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedInt num_sub, num_threads;
+  ierr = CeedOperatorGetNumSub(op, &num_sub); CeedChkBackend(ierr);
+  CeedOperator *sub_ops;
+  ierr = CeedOperatorGetSubList(op, &sub_ops); CeedChkBackend(ierr);
+  ierr = CeedGetNumThreads(ceed, &num_threads); CeedChkBackend(ierr);
+  const bool has_in = in_vec && in_vec != CEED_VECTOR_NONE,
+             has_out = out_vec && out_vec != CEED_VECTOR_NONE;
+  CeedOperatorCompositeCtx_Ref comp = {.sub_ops = sub_ops, .impl = impl,
+                                       .in_vec = in_vec, .out_vec = out_vec
+                                      };
+  const CeedScalar *in_array = NULL;
+
+  // Sub-operators added since the last apply invalidate the schedule
+  if (impl->is_setup && impl->num_sub != num_sub) {
+    ierr = CeedOperatorCompositeFreeSchedule_Ref(impl); CeedChkBackend(ierr);
+  }
+
+  // The first apply runs serially, so sub-operators finish their lazy setup
+  if (!impl->is_setup || num_threads == 1) {
+    for (CeedInt i=0; i<num_sub; i++) {
+      ierr = CeedOperatorApplyAdd(sub_ops[i], in_vec, out_vec,
+                                  CEED_REQUEST_IMMEDIATE);
+      CeedChkBackend(ierr);
+    }
+    if (!impl->is_setup && num_threads > 1) {
+      ierr = CeedOperatorSetupComposite_Ref(op, num_threads);
+      CeedChkBackend(ierr);
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Large sub-operators thread over their own elements
+  for (CeedInt s=0; s<impl->num_serial; s++) {
+    ierr = CeedOperatorApplyAdd(sub_ops[impl->serial_subs[s]], in_vec, out_vec,
+                                CEED_REQUEST_IMMEDIATE); CeedChkBackend(ierr);
+  }
+  if (!impl->num_waves) return CEED_ERROR_SUCCESS;
+
+  // Share active input array with views, give each task its own accumulator
+  if (has_in) {
+    ierr = CeedVectorGetArrayRead(in_vec, CEED_MEM_HOST, &in_array);
+    CeedChkBackend(ierr);
+  }
+  for (CeedInt w=0; w<impl->num_waves; w++) {
+    if (impl->wave_offsets[w+1] - impl->wave_offsets[w] < 2) continue;
+    for (CeedInt k=impl->wave_offsets[w]; k<impl->wave_offsets[w+1]; k++) {
+      const CeedInt i = impl->wave_subs[k];
+      CeedInt length;
+      if (has_in) {
+        ierr = CeedVectorGetLength(in_vec, &length); CeedChkBackend(ierr);
+        ierr = CeedOperatorCompositeGetVector_Ref(ceed, length, &impl->in_vecs[i]);
+        CeedChkBackend(ierr);
+        ierr = CeedVectorSetArray(impl->in_vecs[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                  (CeedScalar *)in_array); CeedChkBackend(ierr);
+      }
+      if (has_out) {
+        ierr = CeedVectorGetLength(out_vec, &length); CeedChkBackend(ierr);
+        ierr = CeedOperatorCompositeGetVector_Ref(ceed, length, &impl->acc_vecs[i]);
+        CeedChkBackend(ierr);
+      }
+    }
+  }
+
+  // Apply sub-operators of each wave concurrently
+  for (CeedInt w=0; w<impl->num_waves; w++) {
+    comp.subs = &impl->wave_subs[impl->wave_offsets[w]];
+    ierr = CeedParallelFor(ceed, impl->wave_offsets[w+1] - impl->wave_offsets[w],
+                           CeedOperatorCompositeTask_Ref, &comp);
+    CeedChkBackend(ierr);
+  }
+  if (has_in) {
+    ierr = CeedVectorRestoreArrayRead(in_vec, &in_array); CeedChkBackend(ierr);
+  }
+  if (!has_out) return CEED_ERROR_SUCCESS;
+
+  // Sum private accumulators into the output vector
+  CeedOperatorCompositeReduceCtx_Ref reduce = {.num_acc = 0};
+  ierr = CeedCalloc(num_sub, &reduce.acc); CeedChkBackend(ierr);
+  ierr = CeedVectorGetLength(out_vec, &reduce.length); CeedChkBackend(ierr);
+  reduce.chunk = (reduce.length + num_threads - 1) / num_threads;
+  ierr = CeedVectorGetArray(out_vec, CEED_MEM_HOST, &reduce.out);
+  CeedChkBackend(ierr);
+  for (CeedInt i=0; i<num_sub; i++) {
+    if (!impl->acc_vecs[i]) continue;
+    ierr = CeedVectorGetArrayRead(impl->acc_vecs[i], CEED_MEM_HOST,
+                                  &reduce.acc[reduce.num_acc++]);
+    CeedChkBackend(ierr);
+  }
+  ierr = CeedParallelFor(ceed, (reduce.length + reduce.chunk - 1) / reduce.chunk,
+                         CeedOperatorCompositeReduceTask_Ref, &reduce);
+  CeedChkBackend(ierr);
+  for (CeedInt i=0, a=0; i<num_sub; i++) {
+    if (!impl->acc_vecs[i]) continue;
+    ierr = CeedVectorRestoreArrayRead(impl->acc_vecs[i], &reduce.acc[a++]);
+    CeedChkBackend(ierr);
+  }
+  ierr = CeedVectorRestoreArray(out_vec, &reduce.out); CeedChkBackend(ierr);
+  ierr = CeedFree(&reduce.acc); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyComposite_Ref(CeedOperator op) {
+  int ierr;
+  CeedOperatorComposite_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+
+  ierr = CeedOperatorCompositeFreeSchedule_Ref(impl); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Create
 //------------------------------------------------------------------------------
@@ -765,9 +1331,39 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
                                 "LinearAssembleQFunctionUpdate",
                                 CeedOperatorLinearAssembleQFunctionUpdate_Ref);
   CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Setup",
+                                CeedOperatorSetup_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Apply",
+                                CeedOperatorApply_Ref); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddRange",
+                                CeedOperatorApplyAddRange_Ref); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Ref); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
 }
+
+//------------------------------------------------------------------------------
+// Composite Operator Create
+//------------------------------------------------------------------------------
+int CeedCompositeOperatorCreate_Ref(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  CeedOperatorComposite_Ref *impl;
+
+  ierr = CeedCalloc(1, &impl); CeedChkBackend(ierr);
+  ierr = CeedOperatorSetData(op, impl); CeedChkBackend(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Setup",
+                                CeedOperatorSetupApplyComposite_Ref);
+  CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite",
+                                CeedOperatorApplyAddComposite_Ref);
+  CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedOperatorDestroyComposite_Ref);
+  CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
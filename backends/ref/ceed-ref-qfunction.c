@@ -25,8 +25,10 @@
 static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q,
                                   CeedVector *U, CeedVector *V) {
   int ierr;
-  CeedQFunction_Ref *impl;
-  ierr = CeedQFunctionGetData(qf, &impl); CeedChkBackend(ierr);
+  // Array pointers are kept on the stack, host threads may apply a QFunction
+  //   concurrently
+  const CeedScalar *inputs[CEED_FIELD_MAX];
+  CeedScalar *outputs[CEED_FIELD_MAX];
 
   void *ctx_data = NULL;
   ierr = CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data);
@@ -39,42 +41,27 @@ static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q,
   ierr = CeedQFunctionGetNumArgs(qf, &num_in, &num_out); CeedChkBackend(ierr);
 
   for (int i = 0; i<num_in; i++) {
-    ierr = CeedVectorGetArrayRead(U[i], CEED_MEM_HOST, &impl->inputs[i]);
+    ierr = CeedVectorGetArrayRead(U[i], CEED_MEM_HOST, &inputs[i]);
     CeedChkBackend(ierr);
   }
   for (int i = 0; i<num_out; i++) {
-    ierr = CeedVectorGetArrayWrite(V[i], CEED_MEM_HOST, &impl->outputs[i]);
+    ierr = CeedVectorGetArrayWrite(V[i], CEED_MEM_HOST, &outputs[i]);
     CeedChkBackend(ierr);
   }
 
-  ierr = f(ctx_data, Q, impl->inputs, impl->outputs); CeedChkBackend(ierr);
+  ierr = f(ctx_data, Q, inputs, outputs); CeedChkBackend(ierr);
 
   for (int i = 0; i<num_in; i++) {
-    ierr = CeedVectorRestoreArrayRead(U[i], &impl->inputs[i]); CeedChkBackend(ierr);
+    ierr = CeedVectorRestoreArrayRead(U[i], &inputs[i]); CeedChkBackend(ierr);
   }
   for (int i = 0; i<num_out; i++) {
-    ierr = CeedVectorRestoreArray(V[i], &impl->outputs[i]); CeedChkBackend(ierr);
+    ierr = CeedVectorRestoreArray(V[i], &outputs[i]); CeedChkBackend(ierr);
   }
   ierr = CeedQFunctionRestoreContextData(qf, &ctx_data); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
 
-//------------------------------------------------------------------------------
-// QFunction Destroy
-//------------------------------------------------------------------------------
-static int CeedQFunctionDestroy_Ref(CeedQFunction qf) {
-  int ierr;
-  CeedQFunction_Ref *impl;
-  ierr = CeedQFunctionGetData(qf, &impl); CeedChkBackend(ierr);
-
-  ierr = CeedFree(&impl->inputs); CeedChkBackend(ierr);
-  ierr = CeedFree(&impl->outputs); CeedChkBackend(ierr);
-  ierr = CeedFree(&impl); CeedChkBackend(ierr);
-
-  return CEED_ERROR_SUCCESS;
-}
-
 //------------------------------------------------------------------------------
 // QFunction Create
 //------------------------------------------------------------------------------
@@ -83,16 +70,8 @@ int CeedQFunctionCreate_Ref(CeedQFunction qf) {
   Ceed ceed;
   ierr = CeedQFunctionGetCeed(qf, &ceed); CeedChkBackend(ierr);
 
-  CeedQFunction_Ref *impl;
-  ierr = CeedCalloc(1, &impl); CeedChkBackend(ierr);
-  ierr = CeedCalloc(CEED_FIELD_MAX, &impl->inputs); CeedChkBackend(ierr);
-  ierr = CeedCalloc(CEED_FIELD_MAX, &impl->outputs); CeedChkBackend(ierr);
-  ierr = CeedQFunctionSetData(qf, impl); CeedChkBackend(ierr);
-
   ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Apply",
                                 CeedQFunctionApply_Ref); CeedChkBackend(ierr);
-  ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Destroy",
-                                CeedQFunctionDestroy_Ref); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
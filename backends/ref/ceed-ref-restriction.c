@@ -16,6 +16,7 @@
 
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <string.h>
 #include "ceed-ref.h"
@@ -50,8 +51,26 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
   // Restriction from L-vector to E-vector
   // Perform: v = r * u
   if (t_mode == CEED_NOTRANSPOSE) {
-    // No offsets provided, Identity Restriction
-    if (!impl->offsets) {
+    if (impl->elem_bases) {
+      // Compressed offsets, decoded for each element of the block
+      // vv has shape [elem_size, num_comp, num_elem], row-major
+      // uu has shape [nnodes, num_comp]
+      for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+        for (CeedInt j = 0; j < blk_size; j++) {
+          const CeedInt *pattern = impl->patterns +
+                                   (impl->elem_patterns ? impl->elem_patterns[e+j] : 0);
+          const bool *orient = is_oriented ? &impl->orient[e*elem_size + j] : NULL;
+          for (CeedInt k = 0; k < num_comp; k++) {
+            const CeedScalar *uu_k = &uu[impl->elem_bases[e+j] + k*comp_stride];
+            CeedScalar *vv_k = &vv[elem_size*(k*blk_size+num_comp*e) + j - v_offset];
+            CeedPragmaSIMD
+            for (CeedInt n = 0; n < elem_size; n++)
+              vv_k[n*blk_size] = uu_k[pattern[n]] *
+                                 (orient && orient[n*blk_size] ? -1. : 1.);
+          }
+        }
+    } else if (!impl->offsets) {
+      // No offsets provided, Identity Restriction
       bool has_backend_strides;
       ierr = CeedElemRestrictionHasBackendStrides(r, &has_backend_strides);
       CeedChkBackend(ierr);
@@ -99,8 +118,26 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
   } else {
     // Restriction from E-vector to L-vector
     // Performing v += r^T * u
-    // No offsets provided, Identity Restriction
-    if (!impl->offsets) {
+    if (impl->elem_bases) {
+      // Compressed offsets, decoded for each element of the block
+      // uu has shape [elem_size, num_comp, num_elem]
+      // vv has shape [nnodes, num_comp]
+      for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+        // Iteration bound set to discard padding elements
+        for (CeedInt j = 0; j < CeedIntMin(blk_size, num_elem-e); j++) {
+          const CeedInt *pattern = impl->patterns +
+                                   (impl->elem_patterns ? impl->elem_patterns[e+j] : 0);
+          const bool *orient = is_oriented ? &impl->orient[e*elem_size + j] : NULL;
+          for (CeedInt k = 0; k < num_comp; k++) {
+            const CeedScalar *uu_k = &uu[elem_size*(k*blk_size+num_comp*e) + j - v_offset];
+            CeedScalar *vv_k = &vv[impl->elem_bases[e+j] + k*comp_stride];
+            for (CeedInt n = 0; n < elem_size; n++)
+              vv_k[pattern[n]] += uu_k[n*blk_size] *
+                                  (orient && orient[n*blk_size] ? -1. : 1.);
+          }
+        }
+    } else if (!impl->offsets) {
+      // No offsets provided, Identity Restriction
       bool has_backend_strides;
       ierr = CeedElemRestrictionHasBackendStrides(r, &has_backend_strides);
       CeedChkBackend(ierr);
@@ -218,6 +255,38 @@ static int CeedElemRestrictionApply_Ref_381(CeedElemRestriction r,
          u, v, request);
 }
 
+static int CeedElemRestrictionApply_Ref_410(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 4, 1, comp_stride, start, stop,
+         t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_411(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 4, 1, 1, start, stop, t_mode,
+         u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_480(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 4, 8, comp_stride, start, stop,
+         t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_481(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 4, 8, 1, start, stop, t_mode,
+         u, v, request);
+}
+
 // LCOV_EXCL_START
 static int CeedElemRestrictionApply_Ref_510(CeedElemRestriction r,
     const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
@@ -254,6 +323,312 @@ static int CeedElemRestrictionApply_Ref_581(CeedElemRestriction r,
          u, v, request);
 }
 
+static int CeedElemRestrictionApply_Ref_910(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 9, 1, comp_stride, start, stop,
+         t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_911(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 9, 1, 1, start, stop, t_mode,
+         u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_980(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 9, 8, comp_stride, start, stop,
+         t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_981(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 9, 8, 1, start, stop, t_mode,
+         u, v, request);
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Expand Compressed Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionExpandOffsets_Ref(CeedElemRestriction r,
+    const CeedElemRestriction_Ref *impl, CeedInt **offsets) {
+  int ierr;
+  CeedInt elem_size, num_blk, blk_size;
+  ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumBlocks(r, &num_blk); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blk_size); CeedChkBackend(ierr);
+
+  ierr = CeedMalloc(num_blk*blk_size*elem_size, offsets); CeedChkBackend(ierr);
+  for (CeedInt e = 0; e < num_blk*blk_size; e++) {
+    const CeedInt *pattern = impl->patterns +
+                             (impl->elem_patterns ? impl->elem_patterns[e] : 0);
+    CeedInt *row = &(*offsets)[(e/blk_size)*blk_size*elem_size + e%blk_size];
+    for (CeedInt n = 0; n < elem_size; n++)
+      row[n*blk_size] = impl->elem_bases[e] + pattern[n];
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Transpose Setup
+//   The map is built on the first transpose apply rather than at creation, so
+//   restrictions that are never transposed do not store their indices twice;
+//   the request thread or other host threads may be the first to apply it
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionBuildTranspose_Ref(CeedElemRestriction r,
+    CeedElemRestriction_Ref *impl) {
+  int ierr;
+  CeedInt num_elem, elem_size, num_blk, blk_size, num_comp;
+  ierr = CeedElemRestrictionGetNumElements(r, &num_elem); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumBlocks(r, &num_blk); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blk_size); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(r, &num_comp); CeedChkBackend(ierr);
+  const CeedInt blk_elem_size = blk_size*elem_size,
+                num_entries = num_blk*blk_elem_size;
+  CeedInt num_t_nodes = 0, *t_offsets, *t_indices, *next, *expanded = NULL;
+  const CeedInt *offsets = impl->offsets;
+
+  // Compressed offsets are decoded into a temporary copy
+  if (!offsets) {
+    ierr = CeedElemRestrictionExpandOffsets_Ref(r, impl, &expanded);
+    CeedChkBackend(ierr);
+    offsets = expanded;
+  }
+
+  // Count E-vector entries of each node, skipping padding elements
+  for (CeedInt p = 0; p < num_entries; p++)
+    num_t_nodes = CeedIntMax(num_t_nodes, offsets[p] + 1);
+  ierr = CeedCalloc(num_t_nodes + 1, &t_offsets); CeedChkBackend(ierr);
+  for (CeedInt p = 0; p < num_entries; p++)
+    if ((p / blk_elem_size)*blk_size + p % blk_size < num_elem)
+      t_offsets[offsets[p] + 1]++;
+  for (CeedInt n = 0; n < num_t_nodes; n++)
+    t_offsets[n + 1] += t_offsets[n];
+
+  // Store E-vector index of each entry, in E-vector order
+  ierr = CeedMalloc(t_offsets[num_t_nodes], &t_indices); CeedChkBackend(ierr);
+  ierr = CeedMalloc(num_t_nodes, &next); CeedChkBackend(ierr);
+  memcpy(next, t_offsets, num_t_nodes * sizeof(next[0]));
+  for (CeedInt p = 0; p < num_entries; p++)
+    if ((p / blk_elem_size)*blk_size + p % blk_size < num_elem)
+      t_indices[next[offsets[p]]++] =
+        (p / blk_elem_size)*blk_elem_size*num_comp + p % blk_elem_size;
+  ierr = CeedFree(&next); CeedChkBackend(ierr);
+  ierr = CeedFree(&expanded); CeedChkBackend(ierr);
+
+  // Publish
+  impl->num_t_nodes = num_t_nodes;
+  impl->t_indices = t_indices;
+  __atomic_store_n(&impl->t_offsets, t_offsets, __ATOMIC_RELEASE);
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedElemRestrictionSetupTranspose_Ref(CeedElemRestriction r,
+    CeedElemRestriction_Ref *impl) {
+  int ierr = CEED_ERROR_SUCCESS;
+
+  if (__atomic_load_n(&impl->t_offsets, __ATOMIC_ACQUIRE))
+    return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&impl->t_lock);
+  if (!impl->t_offsets)
+    ierr = CeedElemRestrictionBuildTranspose_Ref(r, impl);
+  pthread_mutex_unlock(&impl->t_lock);
+  CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Offsets Compression
+//   Each element, padding elements included, is stored as the offset of its
+//   first node and one of a few patterns of node offsets relative to it, as
+//   for structured meshes; the offsets are kept as is if they do not fit
+//------------------------------------------------------------------------------
+#define CEED_REF_MAX_PATTERNS 16
+
+static int CeedElemRestrictionCompressOffsets_Ref(CeedElemRestriction r,
+    CeedElemRestriction_Ref *impl) {
+  int ierr;
+  CeedInt elem_size, num_blk, blk_size;
+  ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumBlocks(r, &num_blk); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blk_size); CeedChkBackend(ierr);
+  const CeedInt *offsets = impl->offsets;
+  const CeedInt num_slots = num_blk*blk_size;
+  CeedInt num_patterns = 0, last = 0, *elem_bases, *elem_patterns, *patterns;
+
+  ierr = CeedMalloc(num_slots, &elem_bases); CeedChkBackend(ierr);
+  ierr = CeedMalloc(num_slots, &elem_patterns); CeedChkBackend(ierr);
+  ierr = CeedMalloc(CEED_REF_MAX_PATTERNS*elem_size, &patterns);
+  CeedChkBackend(ierr);
+  for (CeedInt e = 0; e < num_slots; e++) {
+    // Node n of the element is row[n*blk_size]
+    const CeedInt *row = &offsets[(e/blk_size)*blk_size*elem_size + e%blk_size];
+    CeedInt match = -1;
+    elem_bases[e] = row[0];
+    // Look for the pattern of the previous element first
+    for (CeedInt m = 0; m < num_patterns && match < 0; m++) {
+      const CeedInt p = (last + m) % num_patterns;
+      bool is_same = true;
+      for (CeedInt n = 1; n < elem_size && is_same; n++)
+        is_same = patterns[p*elem_size + n] == row[n*blk_size] - row[0];
+      if (is_same) match = p;
+    }
+    if (match < 0) {
+      if (num_patterns == CEED_REF_MAX_PATTERNS) {
+        num_patterns++;
+        break;
+      }
+      match = num_patterns++;
+      for (CeedInt n = 0; n < elem_size; n++)
+        patterns[match*elem_size + n] = row[n*blk_size] - row[0];
+    }
+    elem_patterns[e] = match*elem_size;
+    last = match;
+  }
+
+  // Keep the compressed offsets only if they are smaller
+  if (num_patterns > CEED_REF_MAX_PATTERNS ||
+      num_slots*(num_patterns > 1 ? 2 : 1) + num_patterns*elem_size >=
+      num_slots*elem_size) {
+    ierr = CeedFree(&elem_bases); CeedChkBackend(ierr);
+    ierr = CeedFree(&elem_patterns); CeedChkBackend(ierr);
+    ierr = CeedFree(&patterns); CeedChkBackend(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+  if (num_patterns == 1) {
+    ierr = CeedFree(&elem_patterns); CeedChkBackend(ierr);
+  }
+  impl->num_patterns = num_patterns;
+  impl->elem_bases = elem_bases;
+  impl->elem_patterns = elem_patterns;
+  impl->patterns = patterns;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Transpose Sum of the E-vector Entries Owned by Each Node
+//------------------------------------------------------------------------------
+static void CeedElemRestrictionTransposeSum_Ref(const CeedInt *t_offsets,
+    const CeedInt *t_indices, const CeedScalar *uu, CeedInt start, CeedInt stop,
+    bool is_assign, CeedScalar *vv) {
+  for (CeedInt n = start; n < stop; n++) {
+    CeedScalar sum = 0.;
+    for (CeedInt q = t_offsets[n]; q < t_offsets[n+1]; q++)
+      sum += uu[t_indices[q]];
+    if (is_assign)
+      vv[n] = sum;
+    else
+      vv[n] += sum;
+  }
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Transpose Apply Context
+//------------------------------------------------------------------------------
+typedef struct {
+  const CeedElemRestriction_Ref *impl;
+  const CeedScalar *uu;
+  CeedScalar *vv;
+  CeedInt num_comp, comp_stride, e_comp_stride, l_size, chunk;
+  bool is_overwrite;
+} CeedElemRestrictionTransposeCtx_Ref;
+
+//------------------------------------------------------------------------------
+// ElemRestriction Transpose Apply on One Chunk of the L-vector
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionTransposeTask_Ref(void *ctx, CeedInt task,
+    CeedInt thread) {
+  const CeedElemRestrictionTransposeCtx_Ref *t_ctx = ctx;
+  const CeedInt *t_offsets = t_ctx->impl->t_offsets,
+                 *t_indices = t_ctx->impl->t_indices;
+  const CeedInt num_t_nodes = t_ctx->impl->num_t_nodes,
+                comp_stride = t_ctx->comp_stride,
+                start = task*t_ctx->chunk,
+                stop = CeedIntMin(start + t_ctx->chunk, t_ctx->l_size);
+  CeedScalar *vv = t_ctx->vv;
+  bool is_assign = false;
+
+  // Overwrite mode zeros the entries owned by no node, then assigns the sums
+  //   if the nodes of different components do not share entries
+  if (t_ctx->is_overwrite) {
+    is_assign = t_ctx->num_comp == 1 || comp_stride >= num_t_nodes;
+    CeedInt zero_start = start;
+    for (CeedInt k = 0; k < t_ctx->num_comp && is_assign; k++) {
+      const CeedInt k_start = CeedIntMax(start, k*comp_stride),
+                    k_stop = CeedIntMin(stop, k*comp_stride + num_t_nodes);
+      for (CeedInt l = zero_start; l < CeedIntMin(k_start, stop); l++)
+        vv[l] = 0.;
+      zero_start = CeedIntMax(zero_start, k_stop);
+    }
+    for (CeedInt l = is_assign ? zero_start : start; l < stop; l++)
+      vv[l] = 0.;
+  }
+
+  // Each L-vector entry in [start, stop) gathers the E-vector entries it owns
+  for (CeedInt k = 0; k < t_ctx->num_comp; k++) {
+    const CeedScalar *uu = &t_ctx->uu[k*t_ctx->e_comp_stride];
+    const CeedInt k_start = CeedIntMax(start, k*comp_stride),
+                  k_stop = CeedIntMin(stop, k*comp_stride + num_t_nodes);
+    if (k_start < k_stop)
+      t_ctx->impl->TransposeSum(t_offsets, t_indices, uu,
+                                k_start - k*comp_stride, k_stop - k*comp_stride,
+                                is_assign, &vv[k*comp_stride]);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Transpose Apply
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyTranspose_Ref(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    bool is_overwrite, CeedVector u, CeedVector v, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChkBackend(ierr);
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionSetupTranspose_Ref(r, impl); CeedChkBackend(ierr);
+  CeedInt elem_size, num_threads;
+  ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
+  ierr = CeedGetNumThreads(ceed, &num_threads); CeedChkBackend(ierr);
+  CeedElemRestrictionTransposeCtx_Ref t_ctx = {.impl = impl,
+                                               .num_comp = num_comp,
+                                               .comp_stride = comp_stride,
+                                               .e_comp_stride = elem_size*blk_size,
+                                               .is_overwrite = is_overwrite
+                                              };
+  ierr = CeedElemRestrictionGetLVectorSize(r, &t_ctx.l_size);
+  CeedChkBackend(ierr);
+  t_ctx.chunk = CeedIntMax((t_ctx.l_size + num_threads - 1) / num_threads, 1);
+
+  // Performing v (+)= r^T * u, without write conflicts between L-vector chunks
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &t_ctx.uu); CeedChkBackend(ierr);
+  if (is_overwrite) {
+    ierr = CeedVectorGetArrayWrite(v, CEED_MEM_HOST, &t_ctx.vv);
+    CeedChkBackend(ierr);
+  } else {
+    ierr = CeedVectorGetArray(v, CEED_MEM_HOST, &t_ctx.vv); CeedChkBackend(ierr);
+  }
+  ierr = CeedParallelFor(ceed, (t_ctx.l_size + t_ctx.chunk - 1) / t_ctx.chunk,
+                         CeedElemRestrictionTransposeTask_Ref, &t_ctx);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArrayRead(u, &t_ctx.uu); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(v, &t_ctx.vv); CeedChkBackend(ierr);
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Apply
 //------------------------------------------------------------------------------
@@ -269,10 +644,64 @@ static int CeedElemRestrictionApply_Ref(CeedElemRestriction r,
   CeedElemRestriction_Ref *impl;
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
 
+  // Gather-reduce transpose for restrictions with offsets
+  if (t_mode == CEED_TRANSPOSE && (impl->offsets || impl->elem_bases) &&
+      !impl->orient)
+    return CeedElemRestrictionApplyTranspose_Ref(r, num_comp, blk_size,
+           comp_stride, false, u, v, request);
+
   return impl->Apply(r, num_comp, blk_size, comp_stride, 0, num_blk, t_mode, u, v,
                      request);
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Apply Transpose Overwriting the Output
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyTransposeOverwrite_Ref(CeedElemRestriction r,
+    CeedVector u, CeedVector v, CeedRequest *request) {
+  int ierr;
+  CeedInt num_elem, elem_size, num_blk, blk_size, num_comp, comp_stride, l_size;
+  ierr = CeedElemRestrictionGetNumElements(r, &num_elem); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumBlocks(r, &num_blk); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blk_size); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(r, &num_comp); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetCompStride(r, &comp_stride); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(r, &l_size); CeedChkBackend(ierr);
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
+
+  // Gather-reduce transpose writes each L-vector entry once
+  if ((impl->offsets || impl->elem_bases) && !impl->orient)
+    return CeedElemRestrictionApplyTranspose_Ref(r, num_comp, blk_size,
+           comp_stride, true, u, v, request);
+
+  // Unblocked backend strides have the same layout for E- and L-vectors
+  if (!impl->offsets && !impl->elem_bases && blk_size == 1 &&
+      l_size == num_elem*elem_size*num_comp) {
+    bool has_backend_strides;
+    ierr = CeedElemRestrictionHasBackendStrides(r, &has_backend_strides);
+    CeedChkBackend(ierr);
+    if (has_backend_strides) {
+      const CeedScalar *uu;
+      CeedScalar *vv;
+      ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu); CeedChkBackend(ierr);
+      ierr = CeedVectorGetArrayWrite(v, CEED_MEM_HOST, &vv); CeedChkBackend(ierr);
+      memcpy(vv, uu, l_size * sizeof(vv[0]));
+      ierr = CeedVectorRestoreArrayRead(u, &uu); CeedChkBackend(ierr);
+      ierr = CeedVectorRestoreArray(v, &vv); CeedChkBackend(ierr);
+      if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+        *request = NULL;
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  // Zero and sum into otherwise
+  ierr = CeedVectorSetValue(v, 0.0); CeedChkBackend(ierr);
+  return impl->Apply(r, num_comp, blk_size, comp_stride, 0, num_blk,
+                     CEED_TRANSPOSE, u, v, request);
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Apply Block
 //------------------------------------------------------------------------------
@@ -307,10 +736,33 @@ static int CeedElemRestrictionGetOffsets_Ref(CeedElemRestriction rstr,
     return CeedError(ceed, CEED_ERROR_BACKEND, "Can only provide to HOST memory");
   // LCOV_EXCL_STOP
 
+  // Expand compressed offsets into a buffer freed by RestoreOffsets
+  if (!impl->offsets && impl->elem_bases) {
+    CeedInt *expanded;
+    ierr = CeedElemRestrictionExpandOffsets_Ref(rstr, impl, &expanded);
+    CeedChkBackend(ierr);
+    *offsets = expanded;
+    return CEED_ERROR_SUCCESS;
+  }
   *offsets = impl->offsets;
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Restore Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionRestoreOffsets_Ref(CeedElemRestriction rstr,
+    const CeedInt **offsets) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(rstr, &impl); CeedChkBackend(ierr);
+
+  if (!impl->offsets && impl->elem_bases) {
+    ierr = CeedFree(offsets); CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Destroy
 //------------------------------------------------------------------------------
@@ -320,6 +772,12 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction r) {
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
 
   ierr = CeedFree(&impl->offsets_allocated); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->elem_bases); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->elem_patterns); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->patterns); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->t_offsets); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->t_indices); CeedChkBackend(ierr);
+  pthread_mutex_destroy(&impl->t_lock);
   ierr = CeedFree(&impl); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
 }
@@ -347,6 +805,7 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
     return CeedError(ceed, CEED_ERROR_BACKEND, "Only MemType = HOST supported");
   // LCOV_EXCL_STOP
   ierr = CeedCalloc(1, &impl); CeedChkBackend(ierr);
+  pthread_mutex_init(&impl->t_lock, NULL);
 
   // Offsets data
   bool is_strided;
@@ -359,11 +818,16 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
       ierr = CeedGetParent(curr_ceed, &parent_ceed); CeedChkBackend(ierr);
     }
     const char *resource;
+    char *resource_root;
     ierr = CeedGetResource(parent_ceed, &resource); CeedChkBackend(ierr);
-    if (!strcmp(resource, "/cpu/self/ref/serial") ||
-        !strcmp(resource, "/cpu/self/ref/blocked") ||
-        !strcmp(resource, "/cpu/self/memcheck/serial") ||
-        !strcmp(resource, "/cpu/self/memcheck/blocked")) {
+    ierr = CeedGetResourceRoot(parent_ceed, resource, ":", &resource_root);
+    CeedChkBackend(ierr);
+    bool check_offsets = !strcmp(resource_root, "/cpu/self/ref/serial") ||
+                         !strcmp(resource_root, "/cpu/self/ref/blocked") ||
+                         !strcmp(resource_root, "/cpu/self/memcheck/serial") ||
+                         !strcmp(resource_root, "/cpu/self/memcheck/blocked");
+    ierr = CeedFree(&resource_root); CeedChkBackend(ierr);
+    if (check_offsets) {
       CeedInt l_size;
       ierr = CeedElemRestrictionGetLVectorSize(r, &l_size); CeedChkBackend(ierr);
 
@@ -392,6 +856,16 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
     case CEED_USE_POINTER:
       impl->offsets = offsets;
     }
+
+    // Transpose map, built on first use
+    impl->TransposeSum = CeedElemRestrictionTransposeSum_Ref;
+
+    // Compressed offsets replace the owned copy, GetOffsets expands a copy
+    ierr = CeedElemRestrictionCompressOffsets_Ref(r, impl); CeedChkBackend(ierr);
+    if (impl->elem_bases && impl->offsets_allocated) {
+      ierr = CeedFree(&impl->offsets_allocated); CeedChkBackend(ierr);
+      impl->offsets = NULL;
+    }
   }
 
   ierr = CeedElemRestrictionSetData(r, impl); CeedChkBackend(ierr);
@@ -399,12 +873,19 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   ierr = CeedElemRestrictionSetELayout(r, layout); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Apply",
                                 CeedElemRestrictionApply_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r,
+                                "ApplyTransposeOverwrite",
+                                CeedElemRestrictionApplyTransposeOverwrite_Ref);
+  CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyBlock",
                                 CeedElemRestrictionApplyBlock_Ref);
   CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets",
                                 CeedElemRestrictionGetOffsets_Ref);
   CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "RestoreOffsets",
+                                CeedElemRestrictionRestoreOffsets_Ref);
+  CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Destroy",
                                 CeedElemRestrictionDestroy_Ref); CeedChkBackend(ierr);
 
@@ -437,6 +918,18 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   case 381:
     impl->Apply = CeedElemRestrictionApply_Ref_381;
     break;
+  case 410:
+    impl->Apply = CeedElemRestrictionApply_Ref_410;
+    break;
+  case 411:
+    impl->Apply = CeedElemRestrictionApply_Ref_411;
+    break;
+  case 480:
+    impl->Apply = CeedElemRestrictionApply_Ref_480;
+    break;
+  case 481:
+    impl->Apply = CeedElemRestrictionApply_Ref_481;
+    break;
   // LCOV_EXCL_START
   case 510:
     impl->Apply = CeedElemRestrictionApply_Ref_510;
@@ -453,6 +946,18 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   case 581:
     impl->Apply = CeedElemRestrictionApply_Ref_581;
     break;
+  case 910:
+    impl->Apply = CeedElemRestrictionApply_Ref_910;
+    break;
+  case 911:
+    impl->Apply = CeedElemRestrictionApply_Ref_911;
+    break;
+  case 980:
+    impl->Apply = CeedElemRestrictionApply_Ref_980;
+    break;
+  case 981:
+    impl->Apply = CeedElemRestrictionApply_Ref_981;
+    break;
   default:
     impl->Apply = CeedElemRestrictionApply_Ref_Core;
     break;
@@ -46,6 +46,30 @@ static int CeedTensorContractApply_Ref(CeedTensorContract contract, CeedInt A,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Fusable
+//   Plain loop nest contractions are marked so the fixed size fused basis
+//   kernels may stand in for them; contractions from backends with their own
+//   kernels are left unmarked and always used
+//------------------------------------------------------------------------------
+static char ceed_tensor_contract_fusable_ref;
+
+int CeedTensorContractSetFusable_Ref(CeedTensorContract contract) {
+  int ierr;
+  ierr = CeedTensorContractSetData(contract, &ceed_tensor_contract_fusable_ref);
+  CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+int CeedTensorContractIsFusable_Ref(CeedTensorContract contract,
+                                    bool *is_fusable) {
+  int ierr;
+  void *data;
+  ierr = CeedTensorContractGetData(contract, &data); CeedChkBackend(ierr);
+  *is_fusable = data == &ceed_tensor_contract_fusable_ref;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Destroy
 //------------------------------------------------------------------------------
@@ -65,6 +89,7 @@ int CeedTensorContractCreate_Ref(CeedBasis basis, CeedTensorContract contract) {
                                 CeedTensorContractApply_Ref); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
                                 CeedTensorContractDestroy_Ref); CeedChkBackend(ierr);
+  ierr = CeedTensorContractSetFusable_Ref(contract); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
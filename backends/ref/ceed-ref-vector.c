@@ -16,9 +16,16 @@
 
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
+#include <math.h>
 #include <string.h>
 #include "ceed-ref.h"
 
+// Vector kernels split the vector into fixed size chunks, so that reductions
+//   give the same result for any number of host threads
+#define CEED_VECTOR_CHUNK_REF 16384
+// Independent accumulators per chunk in reductions
+#define CEED_VECTOR_LANES_REF 8
+
 //------------------------------------------------------------------------------
 // Has Valid Array
 //------------------------------------------------------------------------------
@@ -58,6 +65,52 @@ static inline int CeedVectorHasBorrowedArrayOfType_Ref(const CeedVector vec,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// First Touch of a New Array, One Task per Chunk
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedInt length;
+  CeedScalar *array;
+} CeedVectorFirstTouchCtx_Ref;
+
+static int CeedVectorFirstTouchTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  CeedVectorFirstTouchCtx_Ref *touch_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, touch_ctx->length);
+
+  memset(&touch_ctx->array[start], 0, (stop - start) * sizeof(touch_ctx->array[0]));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Allocate Owned Array, Placing Pages with the Threads of the Vector Kernels
+//   if NUMA Aware
+//------------------------------------------------------------------------------
+static int CeedVectorAllocArray_Ref(CeedVector vec, CeedInt length,
+                                    CeedScalar **array) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChkBackend(ierr);
+  bool is_numa_aware;
+  ierr = CeedIsNumaAware(ceed, &is_numa_aware); CeedChkBackend(ierr);
+
+  if (!is_numa_aware) {
+    ierr = CeedCalloc(length, array); CeedChkBackend(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Pages are placed on first write, so zero with the chunk split every vector
+  //   kernel uses
+  CeedVectorFirstTouchCtx_Ref ctx = {.length = length};
+  ierr = CeedMalloc(length, &ctx.array); CeedChkBackend(ierr);
+  ierr = CeedParallelFor(ceed, (length / CEED_VECTOR_CHUNK_REF) +
+                         !!(length % CEED_VECTOR_CHUNK_REF),
+                         CeedVectorFirstTouchTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  *array = ctx.array;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Vector Set Array
 //------------------------------------------------------------------------------
@@ -80,7 +133,8 @@ static int CeedVectorSetArray_Ref(CeedVector vec, CeedMemType mem_type,
   switch (copy_mode) {
   case CEED_COPY_VALUES:
     if (!impl->array_owned) {
-      ierr = CeedCalloc(length, &impl->array_owned); CeedChkBackend(ierr);
+      ierr = CeedVectorAllocArray_Ref(vec, length, &impl->array_owned);
+      CeedChkBackend(ierr);
     }
     impl->array_borrowed = NULL;
     impl->array = impl->array_owned;
@@ -194,6 +248,487 @@ static int CeedVectorRestoreArrayRead_Ref(CeedVector vec) {
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Vector Kernel Task Context
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedInt length, num_vecs;
+  CeedScalar alpha, beta;
+  const CeedScalar *alphas;
+  CeedNormType norm_type;
+  CeedScalar *w;
+  const CeedScalar *x, *y, **xs, **ys;
+  CeedScalar *partial;
+} CeedVectorTaskCtx_Ref;
+
+//------------------------------------------------------------------------------
+// Run a Vector Kernel on Host Threads, One Task per Chunk
+//------------------------------------------------------------------------------
+static inline int CeedVectorParallelFor_Ref(CeedVector vec,
+    CeedParallelTask task, CeedVectorTaskCtx_Ref *ctx) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChkBackend(ierr);
+  const CeedInt num_chunks = (ctx->length / CEED_VECTOR_CHUNK_REF) +
+                             !!(ctx->length % CEED_VECTOR_CHUNK_REF);
+
+  ierr = CeedParallelFor(ceed, num_chunks, task, ctx); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Pairwise Sum, Error Grows with log(n) Rather Than n
+//------------------------------------------------------------------------------
+static CeedScalar CeedVectorPairwiseSum_Ref(const CeedScalar *a, CeedInt n) {
+  if (n <= CEED_VECTOR_LANES_REF) {
+    CeedScalar sum = 0.;
+    for (CeedInt i=0; i<n; i++)
+      sum += a[i];
+    return sum;
+  }
+  return CeedVectorPairwiseSum_Ref(a, n/2) +
+         CeedVectorPairwiseSum_Ref(&a[n/2], n - n/2);
+}
+
+//------------------------------------------------------------------------------
+// Dot Product of One Chunk
+//------------------------------------------------------------------------------
+static inline CeedScalar CeedVectorChunkDot_Ref(const CeedScalar *x,
+    const CeedScalar *y, CeedInt start, CeedInt stop) {
+  const CeedInt stop_lanes = start + ((stop - start) / CEED_VECTOR_LANES_REF)*
+                             CEED_VECTOR_LANES_REF;
+  CeedScalar acc[CEED_VECTOR_LANES_REF] = {0.};
+
+  // Independent accumulators, one per SIMD lane
+  for (CeedInt i=start; i<stop_lanes; i+=CEED_VECTOR_LANES_REF) {
+    CeedPragmaSIMD
+    for (CeedInt j=0; j<CEED_VECTOR_LANES_REF; j++)
+      acc[j] += x[i+j]*y[i+j];
+  }
+  for (CeedInt i=stop_lanes; i<stop; i++)
+    acc[i-stop_lanes] += x[i]*y[i];
+  return CeedVectorPairwiseSum_Ref(acc, CEED_VECTOR_LANES_REF);
+}
+
+//------------------------------------------------------------------------------
+// Vector Set Value
+//------------------------------------------------------------------------------
+static int CeedVectorSetValueTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length);
+  const CeedScalar alpha = task_ctx->alpha;
+  CeedScalar *w = task_ctx->w;
+
+  CeedPragmaSIMD
+  for (CeedInt i=start; i<stop; i++)
+    w[i] = alpha;
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorSetValue_Ref(CeedVector vec, CeedScalar value) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {.alpha = value};
+  ierr = CeedVectorGetLength(vec, &ctx.length); CeedChkBackend(ierr);
+
+  ierr = CeedVectorGetArrayWrite(vec, CEED_MEM_HOST, &ctx.w);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorParallelFor_Ref(vec, CeedVectorSetValueTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(vec, &ctx.w); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Norm
+//------------------------------------------------------------------------------
+static int CeedVectorNormTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length),
+                stop_lanes = start + ((stop - start) / CEED_VECTOR_LANES_REF)*
+                             CEED_VECTOR_LANES_REF;
+  const CeedScalar *x = task_ctx->x;
+  CeedScalar acc[CEED_VECTOR_LANES_REF] = {0.};
+
+  // Independent accumulators, one per SIMD lane
+  switch (task_ctx->norm_type) {
+  case CEED_NORM_1:
+    for (CeedInt i=start; i<stop_lanes; i+=CEED_VECTOR_LANES_REF) {
+      CeedPragmaSIMD
+      for (CeedInt j=0; j<CEED_VECTOR_LANES_REF; j++)
+        acc[j] += fabs(x[i+j]);
+    }
+    for (CeedInt i=stop_lanes; i<stop; i++)
+      acc[i-stop_lanes] += fabs(x[i]);
+    break;
+  case CEED_NORM_2:
+    task_ctx->partial[t] = CeedVectorChunkDot_Ref(x, x, start, stop);
+    return CEED_ERROR_SUCCESS;
+  case CEED_NORM_MAX:
+    for (CeedInt i=start; i<stop_lanes; i+=CEED_VECTOR_LANES_REF) {
+      CeedPragmaSIMD
+      for (CeedInt j=0; j<CEED_VECTOR_LANES_REF; j++)
+        acc[j] = fmax(acc[j], fabs(x[i+j]));
+    }
+    for (CeedInt i=stop_lanes; i<stop; i++)
+      acc[i-stop_lanes] = fmax(acc[i-stop_lanes], fabs(x[i]));
+    for (CeedInt j=1; j<CEED_VECTOR_LANES_REF; j++)
+      acc[0] = fmax(acc[0], acc[j]);
+    task_ctx->partial[t] = acc[0];
+    return CEED_ERROR_SUCCESS;
+  }
+  task_ctx->partial[t] = CeedVectorPairwiseSum_Ref(acc, CEED_VECTOR_LANES_REF);
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorNorm_Ref(CeedVector vec, CeedNormType norm_type,
+                              CeedScalar *norm) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {.norm_type = norm_type};
+  ierr = CeedVectorGetLength(vec, &ctx.length); CeedChkBackend(ierr);
+  const CeedInt num_chunks = (ctx.length / CEED_VECTOR_CHUNK_REF) +
+                             !!(ctx.length % CEED_VECTOR_CHUNK_REF);
+
+  // Partial result per chunk
+  ierr = CeedCalloc(num_chunks, &ctx.partial); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &ctx.x);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorParallelFor_Ref(vec, CeedVectorNormTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArrayRead(vec, &ctx.x); CeedChkBackend(ierr);
+
+  // Combine chunks
+  if (norm_type == CEED_NORM_MAX) {
+    *norm = 0.;
+    for (CeedInt t=0; t<num_chunks; t++)
+      *norm = fmax(*norm, ctx.partial[t]);
+  } else {
+    *norm = CeedVectorPairwiseSum_Ref(ctx.partial, num_chunks);
+  }
+  if (norm_type == CEED_NORM_2)
+    *norm = sqrt(*norm);
+  ierr = CeedFree(&ctx.partial); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Dot Product
+//------------------------------------------------------------------------------
+static int CeedVectorDotTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length);
+
+  task_ctx->partial[t] = CeedVectorChunkDot_Ref(task_ctx->x, task_ctx->y, start,
+                         stop);
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorDot_Ref(CeedVector x, CeedVector y, CeedScalar *result) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {0};
+  ierr = CeedVectorGetLength(x, &ctx.length); CeedChkBackend(ierr);
+  const CeedInt num_chunks = (ctx.length / CEED_VECTOR_CHUNK_REF) +
+                             !!(ctx.length % CEED_VECTOR_CHUNK_REF);
+
+  // Partial result per chunk
+  ierr = CeedCalloc(num_chunks, &ctx.partial); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &ctx.x); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArrayRead(y, CEED_MEM_HOST, &ctx.y); CeedChkBackend(ierr);
+  ierr = CeedVectorParallelFor_Ref(x, CeedVectorDotTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArrayRead(y, &ctx.y); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &ctx.x); CeedChkBackend(ierr);
+
+  // Combine chunks
+  *result = CeedVectorPairwiseSum_Ref(ctx.partial, num_chunks);
+  ierr = CeedFree(&ctx.partial); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Multiple Dot Products
+//------------------------------------------------------------------------------
+static int CeedVectorMDotTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length),
+                num_chunks = (task_ctx->length / CEED_VECTOR_CHUNK_REF) +
+                             !!(task_ctx->length % CEED_VECTOR_CHUNK_REF);
+
+  // The chunk of x stays in cache across the dot products
+  for (CeedInt j=0; j<task_ctx->num_vecs; j++)
+    task_ctx->partial[j*num_chunks + t] = CeedVectorChunkDot_Ref(task_ctx->x,
+                                          task_ctx->ys[j], start, stop);
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorMDot_Ref(CeedVector x, CeedInt num_vecs, CeedVector *y,
+                              CeedScalar *results) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {.num_vecs = num_vecs};
+  ierr = CeedVectorGetLength(x, &ctx.length); CeedChkBackend(ierr);
+  const CeedInt num_chunks = (ctx.length / CEED_VECTOR_CHUNK_REF) +
+                             !!(ctx.length % CEED_VECTOR_CHUNK_REF);
+
+  // Partial results per vector and chunk
+  ierr = CeedCalloc(num_vecs*num_chunks, &ctx.partial); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_vecs, &ctx.ys); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &ctx.x); CeedChkBackend(ierr);
+  for (CeedInt j=0; j<num_vecs; j++) {
+    ierr = CeedVectorGetArrayRead(y[j], CEED_MEM_HOST, &ctx.ys[j]);
+    CeedChkBackend(ierr);
+  }
+  ierr = CeedVectorParallelFor_Ref(x, CeedVectorMDotTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  for (CeedInt j=0; j<num_vecs; j++) {
+    ierr = CeedVectorRestoreArrayRead(y[j], &ctx.ys[j]); CeedChkBackend(ierr);
+  }
+  ierr = CeedVectorRestoreArrayRead(x, &ctx.x); CeedChkBackend(ierr);
+
+  // Combine chunks
+  for (CeedInt j=0; j<num_vecs; j++)
+    results[j] = CeedVectorPairwiseSum_Ref(&ctx.partial[j*num_chunks],
+                                           num_chunks);
+  ierr = CeedFree(&ctx.ys); CeedChkBackend(ierr);
+  ierr = CeedFree(&ctx.partial); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Scale
+//------------------------------------------------------------------------------
+static int CeedVectorScaleTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length);
+  const CeedScalar alpha = task_ctx->alpha;
+  CeedScalar *w = task_ctx->w;
+
+  CeedPragmaSIMD
+  for (CeedInt i=start; i<stop; i++)
+    w[i] *= alpha;
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorScale_Ref(CeedVector x, CeedScalar alpha) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {.alpha = alpha};
+  ierr = CeedVectorGetLength(x, &ctx.length); CeedChkBackend(ierr);
+
+  ierr = CeedVectorGetArray(x, CEED_MEM_HOST, &ctx.w); CeedChkBackend(ierr);
+  ierr = CeedVectorParallelFor_Ref(x, CeedVectorScaleTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(x, &ctx.w); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector AXPY
+//------------------------------------------------------------------------------
+static int CeedVectorAXPYTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length);
+  const CeedScalar alpha = task_ctx->alpha;
+  const CeedScalar *x = task_ctx->x;
+  CeedScalar *w = task_ctx->w;
+
+  CeedPragmaSIMD
+  for (CeedInt i=start; i<stop; i++)
+    w[i] += alpha*x[i];
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorAXPY_Ref(CeedVector y, CeedScalar alpha, CeedVector x) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {.alpha = alpha};
+  ierr = CeedVectorGetLength(y, &ctx.length); CeedChkBackend(ierr);
+
+  ierr = CeedVectorGetArray(y, CEED_MEM_HOST, &ctx.w); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &ctx.x); CeedChkBackend(ierr);
+  ierr = CeedVectorParallelFor_Ref(y, CeedVectorAXPYTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &ctx.x); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(y, &ctx.w); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector AXPBY
+//------------------------------------------------------------------------------
+static int CeedVectorAXPBYTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length);
+  const CeedScalar alpha = task_ctx->alpha, beta = task_ctx->beta;
+  const CeedScalar *x = task_ctx->x;
+  CeedScalar *w = task_ctx->w;
+
+  CeedPragmaSIMD
+  for (CeedInt i=start; i<stop; i++)
+    w[i] = alpha*x[i] + beta*w[i];
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorAXPBY_Ref(CeedVector y, CeedScalar alpha, CeedScalar beta,
+                               CeedVector x) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {.alpha = alpha, .beta = beta};
+  ierr = CeedVectorGetLength(y, &ctx.length); CeedChkBackend(ierr);
+
+  ierr = CeedVectorGetArray(y, CEED_MEM_HOST, &ctx.w); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &ctx.x); CeedChkBackend(ierr);
+  ierr = CeedVectorParallelFor_Ref(y, CeedVectorAXPBYTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &ctx.x); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(y, &ctx.w); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Linear Combination
+//------------------------------------------------------------------------------
+static int CeedVectorLinearCombinationTask_Ref(void *ctx, CeedInt t,
+    CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length);
+  const CeedScalar *alphas = task_ctx->alphas;
+  CeedScalar *w = task_ctx->w;
+  CeedScalar sum[CEED_VECTOR_LANES_REF*32];
+
+  // Sum into a small buffer, since w may be one of the inputs
+  for (CeedInt b=start; b<stop; b+=CEED_VECTOR_LANES_REF*32) {
+    const CeedInt n = CeedIntMin(CEED_VECTOR_LANES_REF*32, stop - b);
+    for (CeedInt i=0; i<n; i++)
+      sum[i] = 0.;
+    for (CeedInt j=0; j<task_ctx->num_vecs; j++) {
+      const CeedScalar alpha = alphas[j], *x = &task_ctx->xs[j][b];
+      CeedPragmaSIMD
+      for (CeedInt i=0; i<n; i++)
+        sum[i] += alpha*x[i];
+    }
+    for (CeedInt i=0; i<n; i++)
+      w[b+i] = sum[i];
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorLinearCombination_Ref(CeedVector w, CeedInt num_vecs,
+    const CeedScalar *alpha, CeedVector *x) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {.num_vecs = num_vecs, .alphas = alpha};
+  ierr = CeedVectorGetLength(w, &ctx.length); CeedChkBackend(ierr);
+  bool w_in_x = false;
+
+  for (CeedInt j=0; j<num_vecs; j++)
+    w_in_x = w_in_x || x[j] == w;
+  ierr = CeedCalloc(num_vecs, &ctx.xs); CeedChkBackend(ierr);
+  if (w_in_x) {
+    ierr = CeedVectorGetArray(w, CEED_MEM_HOST, &ctx.w); CeedChkBackend(ierr);
+  } else {
+    ierr = CeedVectorGetArrayWrite(w, CEED_MEM_HOST, &ctx.w); CeedChkBackend(ierr);
+  }
+  for (CeedInt j=0; j<num_vecs; j++) {
+    if (x[j] == w) {
+      ctx.xs[j] = ctx.w;
+    } else {
+      ierr = CeedVectorGetArrayRead(x[j], CEED_MEM_HOST, &ctx.xs[j]);
+      CeedChkBackend(ierr);
+    }
+  }
+  ierr = CeedVectorParallelFor_Ref(w, CeedVectorLinearCombinationTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  for (CeedInt j=0; j<num_vecs; j++) {
+    if (x[j] != w) {
+      ierr = CeedVectorRestoreArrayRead(x[j], &ctx.xs[j]); CeedChkBackend(ierr);
+    }
+  }
+  ierr = CeedVectorRestoreArray(w, &ctx.w); CeedChkBackend(ierr);
+  ierr = CeedFree(&ctx.xs); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Pointwise Multiplication
+//------------------------------------------------------------------------------
+static int CeedVectorPointwiseMultTask_Ref(void *ctx, CeedInt t,
+    CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length);
+  const CeedScalar *x = task_ctx->x, *y = task_ctx->y;
+  CeedScalar *w = task_ctx->w;
+
+  CeedPragmaSIMD
+  for (CeedInt i=start; i<stop; i++)
+    w[i] = x[i]*y[i];
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorPointwiseMult_Ref(CeedVector w, CeedVector x,
+                                       CeedVector y) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {0};
+  ierr = CeedVectorGetLength(w, &ctx.length); CeedChkBackend(ierr);
+
+  // Any of w, x, and y may be the same vector
+  if (w == x || w == y) {
+    ierr = CeedVectorGetArray(w, CEED_MEM_HOST, &ctx.w); CeedChkBackend(ierr);
+  } else {
+    ierr = CeedVectorGetArrayWrite(w, CEED_MEM_HOST, &ctx.w); CeedChkBackend(ierr);
+  }
+  if (x != w) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &ctx.x); CeedChkBackend(ierr);
+  } else {
+    ctx.x = ctx.w;
+  }
+  if (y != w && y != x) {
+    ierr = CeedVectorGetArrayRead(y, CEED_MEM_HOST, &ctx.y); CeedChkBackend(ierr);
+  } else {
+    ctx.y = y == w ? ctx.w : ctx.x;
+  }
+  ierr = CeedVectorParallelFor_Ref(w, CeedVectorPointwiseMultTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  if (y != w && y != x) {
+    ierr = CeedVectorRestoreArrayRead(y, &ctx.y); CeedChkBackend(ierr);
+  }
+  if (x != w) {
+    ierr = CeedVectorRestoreArrayRead(x, &ctx.x); CeedChkBackend(ierr);
+  }
+  ierr = CeedVectorRestoreArray(w, &ctx.w); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Reciprocal
+//------------------------------------------------------------------------------
+static int CeedVectorReciprocalTask_Ref(void *ctx, CeedInt t, CeedInt thread) {
+  CeedVectorTaskCtx_Ref *task_ctx = ctx;
+  const CeedInt start = t*CEED_VECTOR_CHUNK_REF,
+                stop = CeedIntMin(start + CEED_VECTOR_CHUNK_REF, task_ctx->length);
+  CeedScalar *w = task_ctx->w;
+
+  CeedPragmaSIMD
+  for (CeedInt i=start; i<stop; i++)
+    w[i] = fabs(w[i]) > CEED_EPSILON ? 1./w[i] : w[i];
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedVectorReciprocal_Ref(CeedVector vec) {
+  int ierr;
+  CeedVectorTaskCtx_Ref ctx = {0};
+  ierr = CeedVectorGetLength(vec, &ctx.length); CeedChkBackend(ierr);
+
+  ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &ctx.w); CeedChkBackend(ierr);
+  ierr = CeedVectorParallelFor_Ref(vec, CeedVectorReciprocalTask_Ref, &ctx);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(vec, &ctx.w); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Vector Destroy
 //------------------------------------------------------------------------------
@@ -235,6 +770,27 @@ int CeedVectorCreate_Ref(CeedInt n, CeedVector vec) {
                                 CeedVectorRestoreArray_Ref); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArrayRead",
                                 CeedVectorRestoreArrayRead_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetValue",
+                                CeedVectorSetValue_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Norm",
+                                CeedVectorNorm_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Dot",
+                                CeedVectorDot_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "MDot",
+                                CeedVectorMDot_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Scale",
+                                CeedVectorScale_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "AXPY",
+                                CeedVectorAXPY_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "AXPBY",
+                                CeedVectorAXPBY_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "LinearCombination",
+                                CeedVectorLinearCombination_Ref);
+  CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "PointwiseMult",
+                                CeedVectorPointwiseMult_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Reciprocal",
+                                CeedVectorReciprocal_Ref); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Destroy",
                                 CeedVectorDestroy_Ref); CeedChkBackend(ierr);
 
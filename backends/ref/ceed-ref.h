@@ -19,12 +19,30 @@
 
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdint.h>
 
+// Fixed size tensor basis kernel applying all directions to one element
+typedef int (*CeedBasisFused_Ref)(CeedInt num_comp,
+                                  const CeedScalar *interp_1d,
+                                  const CeedScalar *grad_1d,
+                                  const CeedScalar *u, CeedScalar *v);
+
 typedef struct {
   CeedScalar *collo_grad_1d;
   bool has_collo_interp;
+  /* Folded 1D matrices for even-odd contractions, NULL if not symmetric */
+  CeedScalar *interp_1d_even_odd, *grad_1d_even_odd, *collo_grad_1d_even_odd;
+  CeedBasisFused_Ref fused_interp[2]; /* Indexed by CeedTransposeMode */
+  CeedBasisFused_Ref fused_grad[2];
+  /* Closed and open 1D matrices of tensor H(div) bases */
+  CeedInt P_1d, Q_1d;
+  CeedScalar *interp_1d, *grad_1d, *interp_1d_open;
+  /* Levels of 1D functions of collapsed coordinate bases, interp_1d and
+       grad_1d hold one (Q_1d * num_funcs[l]) matrix per level */
+  CeedInt num_funcs[3], *parents;
+  CeedScalar *d_eta;
 } CeedBasis_Ref;
 
 typedef struct {
@@ -36,19 +54,30 @@ typedef struct {
 typedef struct {
   const CeedInt *offsets;
   CeedInt *offsets_allocated;
+  // Compressed offsets, if they exist, give node i of element slot e (padding
+  //   elements included) at elem_bases[e] + patterns[elem_patterns[e] + i],
+  //   with elem_patterns NULL if all elements share the same pattern
+  CeedInt num_patterns;
+  CeedInt *elem_bases, *elem_patterns, *patterns;
   // Orientation, if it exists, is true when the face must be flipped (multiplies by -1.).
   const bool *orient;
   bool *orient_allocated;
+  // Transpose map, in CSR format, from each L-vector node to the E-vector
+  //   entries of its first component; built on the first transpose apply
+  //   under t_lock and published by setting t_offsets last
+  pthread_mutex_t t_lock;
+  CeedInt num_t_nodes;
+  CeedInt *t_offsets;
+  CeedInt *t_indices;
   int (*Apply)(CeedElemRestriction, const CeedInt, const CeedInt,
                const CeedInt, CeedInt, CeedInt, CeedTransposeMode, CeedVector,
                CeedVector, CeedRequest *);
+  // Gather-reduce of the transpose map for nodes [start, stop) of one
+  //   component, adding to or assigning the L-vector entries
+  void (*TransposeSum)(const CeedInt *, const CeedInt *, const CeedScalar *,
+                       CeedInt, CeedInt, bool, CeedScalar *);
 } CeedElemRestriction_Ref;
 
-typedef struct {
-  const CeedScalar **inputs;
-  CeedScalar **outputs;
-} CeedQFunction_Ref;
-
 typedef struct {
   void *data;
   void *data_borrowed;
@@ -58,6 +87,8 @@ typedef struct {
 typedef struct {
   bool is_identity_qf, is_identity_restr_op;
   CeedVector *e_vecs_full; /* Full E-vectors, inputs followed by outputs */
+  CeedVector *e_vecs_blk;  /* Single block views into the full E-vectors, for
+                              element ranges */
   uint64_t *input_states;  /* State counter of inputs */
   CeedVector *e_vecs_in;   /* Single element input E-vectors  */
   CeedVector *e_vecs_out;  /* Single element output E-vectors */
@@ -68,6 +99,16 @@ typedef struct {
   CeedVector *qf_active_in;
 } CeedOperator_Ref;
 
+typedef struct {
+  bool is_setup;
+  CeedInt num_sub, num_serial, num_waves;
+  CeedInt *serial_subs;  /* Sub-operators applied one after another */
+  CeedInt *wave_offsets; /* Offsets into wave_subs for each wave */
+  CeedInt *wave_subs;    /* Sub-operators applied concurrently, by wave */
+  CeedVector *in_vecs;   /* Active input views, one per sub-operator */
+  CeedVector *acc_vecs;  /* Private output accumulators, one per sub-operator */
+} CeedOperatorComposite_Ref;
+
 CEED_INTERN int CeedVectorCreate_Ref(CeedInt n, CeedVector vec);
 
 CEED_INTERN int CeedElemRestrictionCreate_Ref(CeedMemType mem_type,
@@ -97,8 +138,24 @@ CEED_INTERN int CeedBasisCreateHdiv_Ref(CeedElemTopology topo,
                                         const CeedScalar *q_weight,
                                         CeedBasis basis);
 
+CEED_INTERN int CeedBasisCreateTensorHdiv_Ref(CeedInt dim, CeedInt P_1d,
+    CeedInt Q_1d, const CeedScalar *interp_1d, const CeedScalar *grad_1d,
+    const CeedScalar *interp_1d_open, const CeedScalar *q_ref_1d,
+    const CeedScalar *q_weight_1d, CeedBasis basis);
+CEED_INTERN int CeedBasisCreateH1Collapsed_Ref(CeedElemTopology topo,
+    CeedInt dim, CeedInt Q_1d, const CeedInt *num_funcs,
+    const CeedInt *parents, const CeedScalar *interp_1d,
+    const CeedScalar *grad_1d, const CeedScalar *d_eta, CeedBasis basis);
+
+CEED_INTERN int CeedBasisGetFusedKernel_Ref(CeedInt P_1d, CeedInt Q_1d,
+    CeedInt dim, CeedEvalMode eval_mode, CeedTransposeMode t_mode,
+    CeedBasisFused_Ref *kernel);
+
 CEED_INTERN int CeedTensorContractCreate_Ref(CeedBasis basis,
     CeedTensorContract contract);
+CEED_INTERN int CeedTensorContractSetFusable_Ref(CeedTensorContract contract);
+CEED_INTERN int CeedTensorContractIsFusable_Ref(CeedTensorContract contract,
+    bool *is_fusable);
 
 CEED_INTERN int CeedQFunctionCreate_Ref(CeedQFunction qf);
 
@@ -106,4 +163,6 @@ CEED_INTERN int CeedQFunctionContextCreate_Ref(CeedQFunctionContext ctx);
 
 CEED_INTERN int CeedOperatorCreate_Ref(CeedOperator op);
 
+CEED_INTERN int CeedCompositeOperatorCreate_Ref(CeedOperator op);
+
 #endif // _ceed_ref_h
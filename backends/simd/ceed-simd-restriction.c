@@ -0,0 +1,147 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include "ceed-simd.h"
+#include "../ref/ceed-ref.h"
+
+//------------------------------------------------------------------------------
+// Core ElemRestriction Apply Code, offsets without orientation
+//------------------------------------------------------------------------------
+static inline int CeedElemRestrictionApply_Simd_Core(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
+  const CeedInt *offsets = impl->offsets;
+  const CeedScalar *uu;
+  CeedScalar *vv;
+  CeedInt num_elem, elem_size, v_offset;
+  ierr = CeedElemRestrictionGetNumElements(r, &num_elem); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
+  v_offset = start*blk_size*elem_size*num_comp;
+  const CeedInt blk_len = elem_size*blk_size,
+                vec_len = blk_len - blk_len%CEED_SIMD_LANES;
+
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu); CeedChkBackend(ierr);
+  if (t_mode == CEED_NOTRANSPOSE) {
+    // Restriction from L-vector to E-vector
+    // vv has shape [elem_size, num_comp, num_elem], row-major
+    // uu has shape [nnodes, num_comp]
+    ierr = CeedVectorGetArrayWrite(v, CEED_MEM_HOST, &vv); CeedChkBackend(ierr);
+    for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size) {
+      const CeedInt *offsets_e = &offsets[e*elem_size];
+      for (CeedInt k = 0; k < num_comp; k++) {
+        const CeedScalar *uu_k = &uu[k*comp_stride];
+        CeedScalar *vv_k = &vv[elem_size*(k*blk_size+num_comp*e) - v_offset];
+        // Gather a vector of lanes at a time, then store it contiguously
+        for (CeedInt i = 0; i < vec_len; i+=CEED_SIMD_LANES) {
+          CeedSimdVector w;
+          for (CeedInt l = 0; l < CEED_SIMD_LANES; l++)
+            w[l] = uu_k[offsets_e[i+l]];
+          *(CeedSimdVector *)&vv_k[i] = w;
+        }
+        for (CeedInt i = vec_len; i < blk_len; i++)
+          vv_k[i] = uu_k[offsets_e[i]];
+      }
+    }
+  } else {
+    // Restriction from E-vector to L-vector
+    // Performing v += r^T * u
+    // uu has shape [elem_size, num_comp, num_elem]
+    // vv has shape [nnodes, num_comp]
+    ierr = CeedVectorGetArray(v, CEED_MEM_HOST, &vv); CeedChkBackend(ierr);
+    for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+      for (CeedInt k = 0; k < num_comp; k++)
+        for (CeedInt i = 0; i < blk_len; i+=blk_size)
+          // Iteration bound set to discard padding elements
+          for (CeedInt j = i; j < i+CeedIntMin(blk_size, num_elem-e); j++)
+            vv[offsets[j+e*elem_size] + k*comp_stride]
+            += uu[elem_size*(k*blk_size+num_comp*e) + j - v_offset];
+  }
+  ierr = CeedVectorRestoreArrayRead(u, &uu); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(v, &vv); CeedChkBackend(ierr);
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply - Common Block Sizes
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApply_Simd_1(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Simd_Core(r, num_comp, 1, comp_stride, start,
+         stop, t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Simd_8(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Simd_Core(r, num_comp, 8, comp_stride, start,
+         stop, t_mode, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Simd(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Simd_Core(r, num_comp, blk_size, comp_stride,
+         start, stop, t_mode, u, v, request);
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Create
+//------------------------------------------------------------------------------
+int CeedElemRestrictionCreate_Simd(CeedMemType mem_type,
+                                   CeedCopyMode copy_mode,
+                                   const CeedInt *offsets,
+                                   CeedElemRestriction r) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  CeedInt blk_size;
+
+  // Storage, transpose map, and strided and compressed offset kernels are
+  //   shared with the reference backend
+  ierr = CeedElemRestrictionCreate_Ref(mem_type, copy_mode, offsets, r);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
+  if (!impl->offsets || impl->elem_bases)
+    return CEED_ERROR_SUCCESS;
+
+  // Set apply function based upon blk_size
+  ierr = CeedElemRestrictionGetBlockSize(r, &blk_size); CeedChkBackend(ierr);
+  switch (blk_size) {
+  case 1:
+    impl->Apply = CeedElemRestrictionApply_Simd_1;
+    break;
+  case 8:
+    impl->Apply = CeedElemRestrictionApply_Simd_8;
+    break;
+  default:
+    impl->Apply = CeedElemRestrictionApply_Simd;
+    break;
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
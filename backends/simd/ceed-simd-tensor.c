@@ -0,0 +1,217 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include "ceed-simd.h"
+
+// Unaligned vector load and store
+#define CEED_SIMD_LOAD(p) (*(const CeedSimdVector *)(p))
+#define CEED_SIMD_STORE(p, x) (*(CeedSimdVector *)(p) = (x))
+
+//------------------------------------------------------------------------------
+// Blocked Tensor Contract
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Simd_Blocked(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u,
+    CeedScalar *restrict v, const CeedInt JJ, const CeedInt CC) {
+  const CeedInt L = CEED_SIMD_LANES;
+  CeedInt t_stride_0 = B, t_stride_1 = 1;
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1; t_stride_1 = J;
+  }
+
+  for (CeedInt a=0; a<A; a++) {
+    for (CeedInt j=0; j<J; j+=JJ) {
+      // Blocks of JJ rows, then the remainder of rows
+      const CeedInt J_tile = CeedIntMin(JJ, J-j);
+      for (CeedInt c=0; c<(C/CC)*CC; c+=CC) {
+        CeedSimdVector vv[JJ][CC/L]; // Output tile to be held in registers
+        for (CeedInt jj=0; jj<J_tile; jj++)
+          for (CeedInt cc=0; cc<CC/L; cc++)
+            vv[jj][cc] = CEED_SIMD_LOAD(&v[(a*J+j+jj)*C+c+cc*L]);
+
+        for (CeedInt b=0; b<B; b++) {
+          for (CeedInt jj=0; jj<J_tile; jj++) {
+            const CeedScalar tq = t[(j+jj)*t_stride_0 + b*t_stride_1];
+            for (CeedInt cc=0; cc<CC/L; cc++) // unroll
+              vv[jj][cc] += tq * CEED_SIMD_LOAD(&u[(a*B+b)*C+c+cc*L]);
+          }
+        }
+        for (CeedInt jj=0; jj<J_tile; jj++)
+          for (CeedInt cc=0; cc<CC/L; cc++)
+            CEED_SIMD_STORE(&v[(a*J+j+jj)*C+c+cc*L], vv[jj][cc]);
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract Remainder
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Simd_Remainder(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u,
+    CeedScalar *restrict v, const CeedInt CC) {
+  const CeedInt L = CEED_SIMD_LANES;
+  const CeedInt C_start = (C/CC)*CC, C_break = C_start + ((C-C_start)/L)*L;
+  CeedInt t_stride_0 = B, t_stride_1 = 1;
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1; t_stride_1 = J;
+  }
+
+  for (CeedInt a=0; a<A; a++)
+    for (CeedInt j=0; j<J; j++) {
+      // Single vectors of columns
+      for (CeedInt c=C_start; c<C_break; c+=L) {
+        CeedSimdVector vv = CEED_SIMD_LOAD(&v[(a*J+j)*C+c]);
+        for (CeedInt b=0; b<B; b++)
+          vv += t[j*t_stride_0 + b*t_stride_1] *
+                CEED_SIMD_LOAD(&u[(a*B+b)*C+c]);
+        CEED_SIMD_STORE(&v[(a*J+j)*C+c], vv);
+      }
+      // Remainder of columns
+      for (CeedInt b=0; b<B; b++) {
+        const CeedScalar tq = t[j*t_stride_0 + b*t_stride_1];
+        for (CeedInt c=C_break; c<C; c++)
+          v[(a*J+j)*C+c] += tq * u[(a*B+b)*C+c];
+      }
+    }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract C=1
+//   Vectors run along j, so t is read as a B x J matrix, transposed for
+//   CEED_NOTRANSPOSE
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Simd_Single(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u,
+    CeedScalar *restrict v, const CeedInt AA) {
+  const CeedInt L = CEED_SIMD_LANES, J_break = (J/L)*L;
+  CeedScalar t_T[t_mode == CEED_TRANSPOSE ? 1 : B*J];
+  const CeedScalar *t_bj = t;
+  if (t_mode == CEED_NOTRANSPOSE) {
+    for (CeedInt j=0; j<J; j++)
+      for (CeedInt b=0; b<B; b++)
+        t_T[b*J+j] = t[j*B+b];
+    t_bj = t_T;
+  }
+
+  for (CeedInt a=0; a<A; a+=AA) {
+    // Blocks of AA rows, then the remainder of rows
+    const CeedInt A_tile = CeedIntMin(AA, A-a);
+    for (CeedInt j=0; j<J_break; j+=L) {
+      CeedSimdVector vv[AA]; // Output tile to be held in registers
+      for (CeedInt aa=0; aa<A_tile; aa++)
+        vv[aa] = CEED_SIMD_LOAD(&v[(a+aa)*J+j]);
+
+      for (CeedInt b=0; b<B; b++) {
+        const CeedSimdVector tqv = CEED_SIMD_LOAD(&t_bj[b*J+j]);
+        for (CeedInt aa=0; aa<A_tile; aa++) // unroll
+          vv[aa] += u[(a+aa)*B+b] * tqv;
+      }
+      for (CeedInt aa=0; aa<A_tile; aa++)
+        CEED_SIMD_STORE(&v[(a+aa)*J+j], vv[aa]);
+    }
+    // Remainder of columns
+    for (CeedInt aa=0; aa<A_tile; aa++)
+      for (CeedInt b=0; b<B; b++) {
+        const CeedScalar uq = u[(a+aa)*B+b];
+        for (CeedInt j=J_break; j<J; j++)
+          v[(a+aa)*J+j] += uq * t_bj[b*J+j];
+      }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract - Common Sizes
+//------------------------------------------------------------------------------
+static int CeedTensorContract_Simd_Blocked_4(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Simd_Blocked(contract, A, B, C, J, t, t_mode, add,
+                                         u, v, 4, 2*CEED_SIMD_LANES);
+}
+static int CeedTensorContract_Simd_Remainder_2(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Simd_Remainder(contract, A, B, C, J, t, t_mode, add,
+         u, v, 2*CEED_SIMD_LANES);
+}
+static int CeedTensorContract_Simd_Single_4(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Simd_Single(contract, A, B, C, J, t, t_mode, add,
+                                        u, v, 4);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Simd(CeedTensorContract contract, CeedInt A,
+                                        CeedInt B, CeedInt C, CeedInt J,
+                                        const CeedScalar *restrict t,
+                                        CeedTransposeMode t_mode,
+                                        const CeedInt add,
+                                        const CeedScalar *restrict u,
+                                        CeedScalar *restrict v) {
+  const CeedInt blk_size = 2*CEED_SIMD_LANES;
+
+  if (!add)
+    for (CeedInt q=0; q<A*J*C; q++)
+      v[q] = (CeedScalar) 0.0;
+
+  if (C == 1) {
+    // Serial C=1 Case
+    CeedTensorContract_Simd_Single_4(contract, A, B, C, J, t, t_mode, true, u,
+                                     v);
+  } else {
+    // Blocks of 2 vectors of columns
+    if (C >= blk_size)
+      CeedTensorContract_Simd_Blocked_4(contract, A, B, C, J, t, t_mode, true,
+                                        u, v);
+    // Remainder of columns
+    if (C % blk_size)
+      CeedTensorContract_Simd_Remainder_2(contract, A, B, C, J, t, t_mode, true,
+                                          u, v);
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Create
+//------------------------------------------------------------------------------
+int CeedTensorContractCreate_Simd(CeedBasis basis,
+                                  CeedTensorContract contract) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChkBackend(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                CeedTensorContractApply_Simd); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
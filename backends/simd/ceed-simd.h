@@ -0,0 +1,39 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#ifndef _ceed_simd_h
+#define _ceed_simd_h
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+
+// Number of CeedScalar lanes per vector, set at build time
+#ifndef CEED_SIMD_LANES
+#  define CEED_SIMD_LANES 4
+#endif
+
+// Vector of CEED_SIMD_LANES CeedScalars, loaded and stored without alignment
+typedef CeedScalar CeedSimdVector
+__attribute__((vector_size(CEED_SIMD_LANES*sizeof(CeedScalar)),
+               aligned(sizeof(CeedScalar)), may_alias));
+
+CEED_INTERN int CeedTensorContractCreate_Simd(CeedBasis basis,
+    CeedTensorContract contract);
+
+CEED_INTERN int CeedElemRestrictionCreate_Simd(CeedMemType mem_type,
+    CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction r);
+
+#endif // _ceed_simd_h
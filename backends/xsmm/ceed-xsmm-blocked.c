@@ -14,19 +14,53 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#define _POSIX_C_SOURCE 200112 // pthread_rwlock_t
+
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
+#include <ceed/khash.h>
+#include <libxsmm.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <string.h>
 #include "ceed-xsmm.h"
 
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Xsmm(Ceed ceed) {
+  int ierr;
+  Ceed_Xsmm *data;
+  libxsmm_smmfunction kernel_f32;
+  libxsmm_dmmfunction kernel_f64;
+  ierr = CeedGetData(ceed, &data); CeedChkBackend(ierr);
+
+  // Free kernels
+  kh_foreach_value(data->lookup_f32, kernel_f32,
+                   libxsmm_release_kernel(&kernel_f32));
+  kh_foreach_value(data->lookup_f64, kernel_f64,
+                   libxsmm_release_kernel(&kernel_f64));
+  kh_destroy(f32, data->lookup_f32);
+  kh_destroy(f64, data->lookup_f64);
+  pthread_rwlock_destroy(&data->lock);
+  ierr = CeedFree(&data); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Backend Init
 //------------------------------------------------------------------------------
 static int CeedInit_Xsmm_Blocked(const char *resource, Ceed ceed) {
   int ierr;
-  if (strcmp(resource, "/cpu/self") && strcmp(resource, "/cpu/self/xsmm") &&
-      strcmp(resource, "/cpu/self/xsmm/blocked"))
+  char *resource_root;
+  ierr = CeedGetResourceRoot(ceed, resource, ":", &resource_root);
+  CeedChkBackend(ierr);
+  const bool is_valid = !strcmp(resource_root, "/cpu/self") ||
+                        !strcmp(resource_root, "/cpu/self/xsmm") ||
+                        !strcmp(resource_root, "/cpu/self/xsmm/blocked");
+  ierr = CeedFree(&resource_root); CeedChkBackend(ierr);
+  if (!is_valid)
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_BACKEND,
                      "blocked libXSMM backend cannot use resource: %s",
@@ -40,6 +74,16 @@ static int CeedInit_Xsmm_Blocked(const char *resource, Ceed ceed) {
   CeedInit("/cpu/self/opt/blocked", &ceed_ref);
   ierr = CeedSetDelegate(ceed, ceed_ref); CeedChkBackend(ierr);
 
+  // Kernel cache shared by all bases
+  Ceed_Xsmm *data;
+  ierr = CeedCalloc(1, &data); CeedChkBackend(ierr);
+  pthread_rwlock_init(&data->lock, NULL);
+  data->lookup_f32 = kh_init(f32);
+  data->lookup_f64 = kh_init(f64);
+  ierr = CeedSetData(ceed, data); CeedChkBackend(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                CeedDestroy_Xsmm); CeedChkBackend(ierr);
   if (CEED_SCALAR_TYPE == CEED_SCALAR_FP64) {
     ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
                                   CeedTensorContractCreate_f64_Xsmm);
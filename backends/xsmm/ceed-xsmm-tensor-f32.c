@@ -14,41 +14,82 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#define _POSIX_C_SOURCE 200112 // pthread_rwlock_t
+
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
 #include <ceed/hash.h>
 #include <ceed/khash.h>
 #include <libxsmm.h>
+#include <pthread.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include "ceed-xsmm.h"
 
 //------------------------------------------------------------------------------
-// Tensor Contract C=1
+// Get Kernel
+//   GEMM kernels c = op(a) op(b), with c of size m x n, are generated on first
+//   use and shared by all bases of the Ceed
 //------------------------------------------------------------------------------
-static int CeedTensorContract_Xsmm_C1(CeedTensorContract contract,
-                                      CeedInt A, CeedInt B, CeedInt C,
-                                      CeedInt J, const float *restrict t,
-                                      CeedTransposeMode t_mode,
-                                      const CeedInt add,
-                                      const float *restrict u,
-                                      float *restrict v) {
+static int CeedTensorContractGetKernel_Xsmm(Ceed ceed, CeedInt m, CeedInt n,
+    CeedInt k, char trans_a, char trans_b, const CeedInt add,
+    libxsmm_smmfunction *kernel) {
+  int ierr;
+  Ceed_Xsmm *data;
+  ierr = CeedGetData(ceed, &data); CeedChkBackend(ierr);
+  const int flags = LIBXSMM_GEMM_FLAGS(trans_a, trans_b);
+  CeedHashIJKLMKey key = {m, n, k, flags, add};
+
+  // Look up kernel, lookups share the lock and only inserts are exclusive
+  pthread_rwlock_rdlock(&data->lock);
+  khint_t i = kh_get(f32, data->lookup_f32, key);
+  const bool is_missing = CeedHashMissing(data->lookup_f32, i);
+  if (!is_missing)
+    CeedHashGetValue(data->lookup_f32, i, *kernel);
+  pthread_rwlock_unlock(&data->lock);
+  if (!is_missing)
+    return CEED_ERROR_SUCCESS;
+
+  // Build kernel
   float alpha = 1.0, beta = 1.0;
-  char trans_u = 'N', trans_t = 'N';
-  if ((t_mode == CEED_TRANSPOSE && C != 1) ||
-      (t_mode == CEED_NOTRANSPOSE && C == 1))
-    trans_t = 'T';
-
-  if (!add)
-    beta = 0.0;
-
-  // libXSMM GEMM
-  libxsmm_sgemm(&trans_t, &trans_u, &J, &A, &B,
-                &alpha, &t[0], NULL, &u[0], NULL,
-                &beta, &v[0], NULL);
+  if (!add) beta = 0.0;
+  *kernel = libxsmm_smmdispatch(m, n, k, NULL, NULL, NULL, &alpha, &beta,
+                                &flags, NULL);
+  if (!*kernel)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
+  // LCOV_EXCL_STOP
+
+  // Add kernel to hash table, unless another thread built it first
+  int new_item;
+  pthread_rwlock_wrlock(&data->lock);
+  i = kh_put(f32, data->lookup_f32, key, &new_item);
+  if (new_item > 0)
+    kh_value(data->lookup_f32, i) = *kernel;
+  else if (new_item == 0)
+    CeedHashGetValue(data->lookup_f32, i, *kernel);
+  pthread_rwlock_unlock(&data->lock);
+  if (new_item < 0)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_MAJOR,
+                     "Failed to add LIBXSMM kernel to hash table");
+  // LCOV_EXCL_STOP
 
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Get Kernel for C=1
+//   With C=1, u and v are column-major matrices of size B x A and J x A, so
+//   the whole contraction is the single GEMM v = t u, with t column-major of
+//   size J x B as for CEED_TRANSPOSE
+//------------------------------------------------------------------------------
+static inline int CeedTensorContractGetKernel_Xsmm_C1(Ceed ceed, CeedInt A,
+    CeedInt B, CeedInt J, const CeedInt add, libxsmm_smmfunction *kernel) {
+  return CeedTensorContractGetKernel_Xsmm(ceed, J, A, B, 'N', 'N', add,
+                                          kernel);
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
@@ -60,38 +101,36 @@ static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A,
                                         const float *restrict u,
                                         float *restrict v) {
   int ierr;
-  CeedTensorContract_Xsmm *impl;
-  ierr = CeedTensorContractGetData(contract, &impl); CeedChkBackend(ierr);
-
-  // Get kernel
+  Ceed ceed;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChkBackend(ierr);
   libxsmm_smmfunction kernel;
-  CeedHashIJKLMKey key = {B, C, J, t_mode, add};
-  khint_t k = kh_get(f32, impl->lookup_f32, key);
-  CeedHashGetValue(impl->lookup_f32, k, kernel);
 
-  // Run kernel or fallback to default implementation
-  if (C != 1)
+  if (C != 1) {
+    // One GEMM v_a = u_a op(t) of size C x J per a
+    ierr = CeedTensorContractGetKernel_Xsmm(ceed, C, J, B, 'N',
+                                            t_mode == CEED_TRANSPOSE ? 'T' : 'N',
+                                            add, &kernel); CeedChkBackend(ierr);
     for (CeedInt a=0; a<A; a++)
       LIBXSMM_MMFUNCTION_KERNEL(&u[a*B*C], &t[0], &v[a*J*C]);
-  else
-    CeedTensorContract_Xsmm_C1(contract, A, B, C, J, t, t_mode, add, u, v);
-
-  return CEED_ERROR_SUCCESS;
-}
-
-//------------------------------------------------------------------------------
-// Tensor Contract Destroy
-//------------------------------------------------------------------------------
-static int CeedTensorContractDestroy_Xsmm(CeedTensorContract contract) {
-  int ierr;
-  CeedTensorContract_Xsmm *impl;
-  libxsmm_smmfunction kernel;
+  } else {
+    // libXSMM kernels do not transpose the first matrix, so t is transposed
+    ierr = CeedTensorContractGetKernel_Xsmm_C1(ceed, A, B, J, add, &kernel);
+    CeedChkBackend(ierr);
+    if (t_mode == CEED_NOTRANSPOSE) {
+      // The transpose lives in the work arena of the calling thread; this
+      //   contraction is only selected when CeedScalar is float
+      CeedScalar *t_T;
+      ierr = CeedGetWorkArray(ceed, J*B, &t_T); CeedChkBackend(ierr);
+      for (CeedInt j=0; j<J; j++)
+        for (CeedInt b=0; b<B; b++)
+          t_T[j+b*J] = t[j*B+b];
+      LIBXSMM_MMFUNCTION_KERNEL((const float *)t_T, &u[0], &v[0]);
+      ierr = CeedRestoreWorkArray(ceed, &t_T); CeedChkBackend(ierr);
+    } else {
+      LIBXSMM_MMFUNCTION_KERNEL(&t[0], &u[0], &v[0]);
+    }
+  }
 
-  ierr = CeedTensorContractGetData(contract, &impl); CeedChkBackend(ierr);
-  // Free kernels
-  kh_foreach_value(impl->lookup_f32, kernel, libxsmm_release_kernel(&kernel));
-  kh_destroy(f32, impl->lookup_f32);
-  ierr = CeedFree(&impl); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -103,86 +142,27 @@ int CeedTensorContractCreate_f32_Xsmm(CeedBasis basis,
   int ierr;
   Ceed ceed;
   ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChkBackend(ierr);
-  CeedTensorContract_Xsmm *impl;
-  ierr = CeedCalloc(1, &impl); CeedChkBackend(ierr);
 
-  // Setup kernels hash table
-  impl->lookup_f32 = kh_init(f32);
-
-  // Set up pointers to kernels
-  ierr = CeedBasisIsTensor(basis, &impl->is_tensor); CeedChkBackend(ierr);
-  if (impl->is_tensor) {
-    ierr = CeedBasisGetNumNodes1D(basis, &impl->P); CeedChkBackend(ierr);
-    ierr = CeedBasisGetNumQuadraturePoints1D(basis, &impl->Q); CeedChkBackend(ierr);
-    ierr = CeedBasisGetDimension(basis, &impl->dim); CeedChkBackend(ierr);
-    // Build all required kernels
-    for (CeedInt num_elem = 1; num_elem <= 8; num_elem+=7)
-      for (CeedInt add = 0; add <= 1; add++)
-        for (CeedInt t_mode = 0; t_mode <= 1; t_mode++)
-          for (CeedInt grad = 0; grad <=1; grad++)
-            for (CeedInt dim = 0; dim < impl->dim; dim++) {
-              const int flags = LIBXSMM_GEMM_FLAGS('N', t_mode ? 'T' : 'N');
-              CeedInt B = grad ? impl->Q : (t_mode ? impl->Q : impl->P),
-                      J = grad ? impl->Q : (t_mode ? impl->P : impl->Q),
-                      C = num_elem*CeedIntPow(J, dim);
-              // Add key, kernel pair to hash table
-              CeedHashIJKLMKey key = {B, C, J, t_mode, add};
-              int new_item;
-              khint_t k = kh_put(f32, impl->lookup_f32, key, &new_item);
-              if (new_item) {
-                // Build kernel
-                float alpha = 1.0, beta = 1.0;
-                if (!add) beta = 0.0;
-                libxsmm_smmfunction kernel = libxsmm_smmdispatch(
-                                               C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
-                if (!kernel)
-                  // LCOV_EXCL_START
-                  return CeedError(ceed, CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
-                // LCOV_EXCL_STOP
-                // Add kernel to hash table
-                kh_value(impl->lookup_f32, k) = kernel;
-              }
-            }
-  } else {
-    ierr = CeedBasisGetNumNodes(basis, &impl->P); CeedChkBackend(ierr);
-    ierr = CeedBasisGetNumQuadraturePoints(basis, &impl->Q); CeedChkBackend(ierr);
-    ierr = CeedBasisGetDimension(basis, &impl->dim); CeedChkBackend(ierr);
-    // Build all required kernels
-    for (CeedInt num_elem = 1; num_elem <= 8; num_elem+=7)
-      for (CeedInt add = 0; add <= 1; add++)
-        for (CeedInt t_mode = 0; t_mode <= 1; t_mode++) {
-          CeedInt gradstride = CeedIntMax(impl->dim-1, 1);
-          for (CeedInt grad = 1; grad <= impl->dim; grad+=gradstride) {
-            const int flags = LIBXSMM_GEMM_FLAGS('N', t_mode ? 'T' : 'N');
-            CeedInt B = t_mode ? grad*impl->Q : impl->P,
-                    J = t_mode ? impl->P : grad*impl->Q,
-                    C = num_elem;
-            // Add key, kernel pair to hash table
-            CeedHashIJKLMKey key = {B, C, J, t_mode, add};
-            int new_item;
-            khint_t k = kh_put(f32, impl->lookup_f32, key, &new_item);
-            if (new_item) {
-              // Build kernel
-              float alpha = 1.0, beta = 1.0;
-              if (!add) beta = 0.0;
-              libxsmm_smmfunction kernel = libxsmm_smmdispatch(
-                                             C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
-              if (!kernel)
-                // LCOV_EXCL_START
-                return CeedError(ceed, CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
-              // LCOV_EXCL_STOP
-              // Add kernel to hash table
-              kh_value(impl->lookup_f32, k) = kernel;
-            }
-          }
-        }
+  // Build the kernels for the first contraction of single elements, with C=1
+  bool is_tensor;
+  ierr = CeedBasisIsTensor(basis, &is_tensor); CeedChkBackend(ierr);
+  if (is_tensor) {
+    CeedInt dim, num_comp, P, Q;
+    libxsmm_smmfunction kernel;
+    ierr = CeedBasisGetDimension(basis, &dim); CeedChkBackend(ierr);
+    ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChkBackend(ierr);
+    ierr = CeedBasisGetNumNodes1D(basis, &P); CeedChkBackend(ierr);
+    ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q); CeedChkBackend(ierr);
+    ierr = CeedTensorContractGetKernel_Xsmm_C1(ceed,
+           num_comp*CeedIntPow(P, dim-1), P, Q, false, &kernel);
+    CeedChkBackend(ierr);
+    ierr = CeedTensorContractGetKernel_Xsmm_C1(ceed,
+           num_comp*CeedIntPow(Q, dim-1), Q, P, false, &kernel);
+    CeedChkBackend(ierr);
   }
-  ierr = CeedTensorContractSetData(contract, impl); CeedChkBackend(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
                                 CeedTensorContractApply_Xsmm); CeedChkBackend(ierr);
-  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
-                                CeedTensorContractDestroy_Xsmm); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
@@ -21,6 +21,7 @@
 #include <ceed/backend.h>
 #include <ceed/hash.h>
 #include <libxsmm.h>
+#include <pthread.h>
 
 #if !defined(LIBXSMM_VERSION_GE)
 #define LIBXSMM_VERSION_GE(major, minor, update, patch)                           \
@@ -42,12 +43,12 @@
 CeedHashIJKLMInit(f32, libxsmm_smmfunction)
 CeedHashIJKLMInit(f64, libxsmm_dmmfunction)
 
+// GEMM kernels generated on first use, keyed by (m, n, k, flags, add)
 typedef struct {
-  bool is_tensor;
-  CeedInt P, Q, dim;
+  pthread_rwlock_t lock;
   khash_t(f32) *lookup_f32;
   khash_t(f64) *lookup_f64;
-} CeedTensorContract_Xsmm;
+} Ceed_Xsmm;
 
 CEED_INTERN int CeedTensorContractCreate_f32_Xsmm(CeedBasis basis,
     CeedTensorContract contract);
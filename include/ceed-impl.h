@@ -121,6 +121,14 @@ struct Ceed_private {
                          const CeedScalar *,
                          const CeedScalar *, const CeedScalar *,
                          const CeedScalar *, CeedBasis);
+  int (*BasisCreateTensorHdiv)(CeedInt, CeedInt, CeedInt, const CeedScalar *,
+                               const CeedScalar *, const CeedScalar *,
+                               const CeedScalar *, const CeedScalar *,
+                               CeedBasis);
+  int (*BasisCreateH1Collapsed)(CeedElemTopology, CeedInt, CeedInt,
+                                const CeedInt *, const CeedInt *,
+                                const CeedScalar *, const CeedScalar *,
+                                const CeedScalar *, CeedBasis);
   int (*TensorContractCreate)(CeedBasis, CeedTensorContract);
   int (*QFunctionCreate)(CeedQFunction);
   int (*QFunctionContextCreate)(CeedQFunctionContext);
@@ -130,8 +138,21 @@ struct Ceed_private {
   void *data;
   bool is_debug;
   bool is_deterministic;
+  bool has_async_requests;
   char err_msg[CEED_MAX_RESOURCE_LEN];
   FOffset *f_offsets;
+  CeedInt num_threads; /* number of host threads for CPU backends */
+  bool is_numa_aware; /* host threads are bound and run fixed task shares */
+  struct CeedThreadPool_private *thread_pool; /* host worker threads, created on
+                                                   first use */
+  struct CeedWorkArena_private *work_arenas; /* scratch arena per host thread,
+                                                plus asynchronous requests,
+                                                created on first use */
+  CeedInt num_work_arenas;
+  void *work_owner; /* identifies the thread that created the context, which
+                       uses the first arena */
+  struct CeedRequestQueue_private *request_queue; /* background thread for
+                                                       asynchronous requests */
 };
 
 struct CeedVector_private {
@@ -148,8 +169,13 @@ struct CeedVector_private {
   int (*RestoreArray)(CeedVector);
   int (*RestoreArrayRead)(CeedVector);
   int (*Norm)(CeedVector, CeedNormType, CeedScalar *);
+  int (*Dot)(CeedVector, CeedVector, CeedScalar *);
+  int (*MDot)(CeedVector, CeedInt, CeedVector *, CeedScalar *);
   int (*Scale)(CeedVector, CeedScalar);
   int (*AXPY)(CeedVector, CeedScalar, CeedVector);
+  int (*AXPBY)(CeedVector, CeedScalar, CeedScalar, CeedVector);
+  int (*LinearCombination)(CeedVector, CeedInt, const CeedScalar *,
+                           CeedVector *);
   int (*PointwiseMult)(CeedVector, CeedVector, CeedVector);
   int (*Reciprocal)(CeedVector);
   int (*Destroy)(CeedVector);
@@ -166,7 +192,10 @@ struct CeedElemRestriction_private {
                CeedRequest *);
   int (*ApplyBlock)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector,
                     CeedVector, CeedRequest *);
+  int (*ApplyTransposeOverwrite)(CeedElemRestriction, CeedVector, CeedVector,
+                                 CeedRequest *);
   int (*GetOffsets)(CeedElemRestriction, CeedMemType, const CeedInt **);
+  int (*RestoreOffsets)(CeedElemRestriction, const CeedInt **);
   int (*Destroy)(CeedElemRestriction);
   int ref_count;
   CeedInt num_elem;      /* number of elements */
@@ -181,6 +210,11 @@ struct CeedElemRestriction_private {
   CeedInt layout[3];     /* E-vector layout [nodes, components, elements] */
   uint64_t num_readers;  /* number of instances of offset read only access */
   bool is_oriented;       /* flag for oriented restriction */
+  CeedInt num_colors;    /* number of colors of element blocks */
+  CeedInt *color_offsets; /* start of each color in color_blocks */
+  CeedInt *color_blocks; /* element blocks sorted by color */
+  CeedInt num_blk_rstrs; /* number of cached blocked restrictions */
+  CeedElemRestriction *blk_rstrs; /* blocked copies, one per block size */
   void *data;            /* place for the backend to store any data */
 };
 
@@ -231,6 +265,11 @@ struct CeedTensorContract_private {
   int (*Apply)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt,
                const CeedScalar *restrict, CeedTransposeMode, const CeedInt,
                const CeedScalar *restrict, CeedScalar *restrict);
+  int (*ApplyEvenOdd)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt,
+                      const CeedScalar *restrict, const CeedScalar *restrict,
+                      CeedInt, CeedTransposeMode,
+                      const CeedInt, const CeedScalar *restrict,
+                      CeedScalar *restrict);
   int (*Destroy)(CeedTensorContract);
   int ref_count;
   void *data;
@@ -264,6 +303,8 @@ struct CeedQFunction_private {
   bool is_immutable;
   bool is_context_writable;
   CeedQFunctionContext ctx; /* user context for function */
+  void *ctx_data;      /* context data shared by concurrent applies */
+  int num_ctx_users;   /* number of applies holding ctx_data */
   void *data;          /* place for the backend to store any data */
 };
 
@@ -348,10 +389,14 @@ struct CeedOperator_private {
   int (*LinearAssembleSymbolic)(CeedOperator, CeedInt *, CeedInt **, CeedInt **);
   int (*LinearAssemble)(CeedOperator, CeedVector);
   int (*CreateFDMElementInverse)(CeedOperator, CeedOperator *, CeedRequest *);
+  int (*Setup)(CeedOperator);
   int (*Apply)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddRange)(CeedOperator, CeedInt, CeedInt, CeedVector, CeedVector,
+                       CeedRequest *);
+  int (*ApplyDot)(CeedOperator, CeedVector, CeedVector, CeedScalar *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector,
                        CeedVector, CeedRequest *);
   int (*Destroy)(CeedOperator);
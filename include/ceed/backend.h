@@ -78,6 +78,16 @@ CEED_EXTERN bool CeedDebugFlagEnv(void);
   { if (CeedDebugFlagEnv()) CeedDebugImpl256(color, ## __VA_ARGS__); }
 #define CeedDebugEnv(...) CeedDebugEnv256((unsigned char)CEED_DEBUG_COLOR_NONE, ## __VA_ARGS__)
 
+/// Task run by CeedParallelFor(); `task` is the task index and `thread` the
+///   index of the host thread executing it
+/// @ingroup Ceed
+typedef int (*CeedParallelTask)(void *ctx, CeedInt task, CeedInt thread);
+
+/// Work run by a CeedRequest on the background thread, or finalization run by
+///   CeedRequestWait() on the waiting thread
+/// @ingroup Ceed
+typedef int (*CeedRequestTask)(void *ctx);
+
 /// Handle for object handling TensorContraction
 /// @ingroup CeedBasis
 typedef struct CeedTensorContract_private *CeedTensorContract;
@@ -123,12 +133,27 @@ CEED_EXTERN int CeedSetOperatorFallbackResource(Ceed ceed,
     const char *resource);
 CEED_EXTERN int CeedGetOperatorFallbackParentCeed(Ceed ceed, Ceed *parent);
 CEED_EXTERN int CeedSetDeterministic(Ceed ceed, bool is_deterministic);
+CEED_EXTERN int CeedSetAsyncRequests(Ceed ceed, bool has_async_requests);
 CEED_EXTERN int CeedSetBackendFunction(Ceed ceed,
                                        const char *type, void *object,
                                        const char *func_name, int (*f)());
 CEED_EXTERN int CeedGetData(Ceed ceed, void *data);
 CEED_EXTERN int CeedSetData(Ceed ceed, void *data);
 CEED_EXTERN int CeedReference(Ceed ceed);
+CEED_EXTERN int CeedGetResourceRoot(Ceed ceed, const char *resource,
+                                    const char *delineator, char **resource_root);
+CEED_EXTERN int CeedGetNumThreads(Ceed ceed, CeedInt *num_threads);
+CEED_EXTERN int CeedSetNumThreads(Ceed ceed, CeedInt num_threads);
+CEED_EXTERN int CeedIsNumaAware(Ceed ceed, bool *is_numa_aware);
+CEED_EXTERN int CeedParallelFor(Ceed ceed, CeedInt num_tasks,
+                                CeedParallelTask task, void *ctx);
+CEED_EXTERN int CeedGetWorkArray(Ceed ceed, size_t length, CeedScalar **array);
+CEED_EXTERN int CeedRestoreWorkArray(Ceed ceed, CeedScalar **array);
+CEED_EXTERN int CeedRequestIsAsync(Ceed ceed, CeedRequest *request,
+                                   bool *is_async);
+CEED_EXTERN int CeedRequestCreate(Ceed ceed, CeedRequestTask run,
+                                  CeedRequestTask finalize, void *ctx,
+                                  CeedRequest *request);
 
 CEED_EXTERN int CeedVectorHasValidArray(CeedVector vec, bool *has_valid_array);
 CEED_EXTERN int CeedVectorHasBorrowedArrayOfType(CeedVector vec, CeedMemType mem_type,
@@ -156,6 +181,10 @@ CEED_EXTERN int CeedElemRestrictionGetELayout(CeedElemRestriction rstr,
     CeedInt (*layout)[3]);
 CEED_EXTERN int CeedElemRestrictionSetELayout(CeedElemRestriction rstr,
     CeedInt layout[3]);
+CEED_EXTERN int CeedElemRestrictionGetColoring(CeedElemRestriction rstr,
+    CeedInt *num_colors, const CeedInt **color_offsets, const CeedInt **blocks);
+CEED_EXTERN int CeedElemRestrictionGetBlocked(CeedElemRestriction rstr,
+    CeedInt blk_size, CeedElemRestriction *blk_rstr);
 CEED_EXTERN int CeedElemRestrictionGetData(CeedElemRestriction rstr,
     void *data);
 CEED_EXTERN int CeedElemRestrictionSetData(CeedElemRestriction rstr,
@@ -199,6 +228,14 @@ CEED_EXTERN int CeedTensorContractApply(CeedTensorContract contract, CeedInt A,
                                         const CeedInt Add,
                                         const CeedScalar *__restrict__ u,
                                         CeedScalar *__restrict__ v);
+CEED_EXTERN int CeedTensorContractFoldEvenOdd(CeedTensorContract contract,
+    CeedInt Q, CeedInt P, const CeedScalar *t, CeedInt parity,
+    CeedScalar **t_even_odd);
+CEED_EXTERN int CeedTensorContractApplyEvenOdd(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *__restrict__ t,
+    const CeedScalar *__restrict__ t_even_odd, CeedInt parity,
+    CeedTransposeMode t_mode, const CeedInt add,
+    const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v);
 CEED_EXTERN int CeedTensorContractGetCeed(CeedTensorContract contract,
     Ceed *ceed);
 CEED_EXTERN int CeedTensorContractGetData(CeedTensorContract contract,
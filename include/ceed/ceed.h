@@ -355,8 +355,15 @@ CEED_EXTERN int CeedVectorRestoreArrayRead(CeedVector vec,
     const CeedScalar **array);
 CEED_EXTERN int CeedVectorNorm(CeedVector vec, CeedNormType type,
                                CeedScalar *norm);
+CEED_EXTERN int CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result);
+CEED_EXTERN int CeedVectorMDot(CeedVector x, CeedInt num_vecs, CeedVector *y,
+                               CeedScalar *results);
 CEED_EXTERN int CeedVectorScale(CeedVector x, CeedScalar alpha);
 CEED_EXTERN int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x);
+CEED_EXTERN int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta,
+                                CeedVector x);
+CEED_EXTERN int CeedVectorLinearCombination(CeedVector w, CeedInt num_vecs,
+    const CeedScalar *alpha, CeedVector *x);
 CEED_EXTERN int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y);
 CEED_EXTERN int CeedVectorReciprocal(CeedVector vec);
 CEED_EXTERN int CeedVectorView(CeedVector vec, const char *fp_fmt, FILE *stream);
@@ -438,6 +445,8 @@ CEED_EXTERN int CeedElemRestrictionApply(CeedElemRestriction rstr,
 CEED_EXTERN int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr,
     CeedInt block, CeedTransposeMode t_mode, CeedVector u, CeedVector ru,
     CeedRequest *request);
+CEED_EXTERN int CeedElemRestrictionApplyTransposeOverwrite(
+  CeedElemRestriction rstr, CeedVector u, CeedVector ru, CeedRequest *request);
 CEED_EXTERN int CeedElemRestrictionGetCeed(CeedElemRestriction rstr,
     Ceed *ceed);
 CEED_EXTERN int CeedElemRestrictionGetCompStride(CeedElemRestriction rstr,
@@ -540,6 +549,16 @@ CEED_EXTERN int CeedBasisCreateHdiv(Ceed ceed, CeedElemTopology topo,
                                     const CeedScalar *div,
                                     const CeedScalar *q_ref,
                                     const CeedScalar *q_weights, CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateTensorHdiv(Ceed ceed, CeedInt dim,
+    CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d,
+    const CeedScalar *grad_1d, const CeedScalar *interp_1d_open,
+    const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d,
+    CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateTensorHdivRaviartThomas(Ceed ceed, CeedInt dim,
+    CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, CeedQuadMode quad_mode,
+    CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateH1Collapsed(Ceed ceed, CeedElemTopology topo,
+    CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, CeedBasis *basis);
 CEED_EXTERN int CeedBasisReferenceCopy(CeedBasis basis, CeedBasis *basis_copy);
 CEED_EXTERN int CeedBasisView(CeedBasis basis, FILE *stream);
 CEED_EXTERN int CeedBasisApply(CeedBasis basis, CeedInt num_elem,
@@ -741,6 +760,10 @@ CEED_EXTERN int CeedOperatorApply(CeedOperator op, CeedVector in,
                                   CeedVector out, CeedRequest *request);
 CEED_EXTERN int CeedOperatorApplyAdd(CeedOperator op, CeedVector in,
                                      CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyAddRange(CeedOperator op, CeedInt elem_start,
+    CeedInt elem_end, CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyDot(CeedOperator op, CeedVector in,
+                                     CeedVector out, CeedScalar *result);
 CEED_EXTERN int CeedOperatorDestroy(CeedOperator *op);
 
 CEED_EXTERN int CeedOperatorFieldGetName(CeedOperatorField op_field,
@@ -179,6 +179,205 @@ static int CeedScalarView(const char *name, const char *fp_fmt, CeedInt m,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Build 1D Lagrange interpolation and derivative matrices
+
+    Evaluates the Lagrange polynomials on the P nodes, and their derivatives,
+    at the Q points x, using the recurrence of Fornberg, 1998
+
+  @param P             Number of nodes
+  @param nodes         Array of length P holding the nodes
+  @param Q             Number of evaluation points
+  @param x             Array of length Q holding the evaluation points
+  @param[out] interp   Row-major (Q * P) matrix of the polynomial values
+  @param[out] grad     Row-major (Q * P) matrix of the polynomial derivatives
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedLagrangeInterp1D(CeedInt P, const CeedScalar *nodes, CeedInt Q,
+                                const CeedScalar *x, CeedScalar *interp,
+                                CeedScalar *grad) {
+  CeedScalar c1, c2, c3, c4, dx;
+
+  for (CeedInt i = 0; i < Q*P; i++) {
+    interp[i] = 0.0;
+    grad[i] = 0.0;
+  }
+  for (CeedInt i = 0; i < Q; i++) {
+    c1 = 1.0;
+    c3 = nodes[0] - x[i];
+    interp[i*P+0] = 1.0;
+    for (CeedInt j = 1; j < P; j++) {
+      c2 = 1.0;
+      c4 = c3;
+      c3 = nodes[j] - x[i];
+      for (CeedInt k = 0; k < j; k++) {
+        dx = nodes[j] - nodes[k];
+        c2 *= dx;
+        if (k == j - 1) {
+          grad[i*P + j] = c1*(interp[i*P + k] - c4*grad[i*P + k]) / c2;
+          interp[i*P + j] = - c1*c4*interp[i*P + k] / c2;
+        }
+        grad[i*P + k] = (c3*grad[i*P + k] - interp[i*P + k]) / dx;
+        interp[i*P + k] = c3*interp[i*P + k] / dx;
+      }
+      c1 = c2;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Evaluate a Jacobi polynomial with the three term recurrence
+
+  @param n      Degree of the polynomial
+  @param alpha  Jacobi parameter alpha
+  @param beta   Jacobi parameter beta
+  @param x      Evaluation point in [-1, 1]
+
+  @return The value of P_n^(alpha, beta)(x)
+
+  @ref Developer
+**/
+static CeedScalar CeedJacobiPolynomial(CeedInt n, CeedScalar alpha,
+                                       CeedScalar beta, CeedScalar x) {
+  CeedScalar p_prev = 1.0, p = 0.5*((alpha + beta + 2)*x + alpha - beta);
+
+  if (n == 0) return p_prev;
+  for (CeedInt k = 2; k <= n; k++) {
+    const CeedScalar s = 2*k + alpha + beta,
+                     a1 = 2*k*(k + alpha + beta)*(s - 2),
+                     a2 = (s - 1)*(alpha*alpha - beta*beta),
+                     a3 = (s - 2)*(s - 1)*s,
+                     a4 = 2*(k + alpha - 1)*(k + beta - 1)*s,
+                     p_next = ((a2 + a3*x)*p - a4*p_prev) / a1;
+    p_prev = p;
+    p = p_next;
+  }
+  return p;
+}
+
+/**
+  @brief Evaluate a 1D function of a collapsed coordinate simplex basis
+
+    The function ((1-x)/2)^i ((1+x)/2)^j P_n^(alpha, 1)(x) is described by
+    func = {parent, i, j, n, alpha}, where parent is the index of the function
+    of the previous collapsed coordinate it multiplies.
+
+  @param func        Array of length 5 describing the function
+  @param x           Evaluation point in [-1, 1]
+  @param[out] value  Value of the function at x
+  @param[out] deriv  Derivative of the function at x
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCollapsedFunction1D(const CeedInt *func, CeedScalar x,
+                                   CeedScalar *value, CeedScalar *deriv) {
+  const CeedInt i = func[1], j = func[2], n = func[3];
+  const CeedScalar alpha = func[4], s_1 = 0.5*(1 - x), s_2 = 0.5*(1 + x);
+  CeedScalar pow_1 = 1.0, pow_2 = 1.0, d_pow_1 = 0.0, d_pow_2 = 0.0;
+
+  for (CeedInt k = 0; k < i; k++) {
+    d_pow_1 = d_pow_1*s_1 - 0.5*pow_1;
+    pow_1 *= s_1;
+  }
+  for (CeedInt k = 0; k < j; k++) {
+    d_pow_2 = d_pow_2*s_2 + 0.5*pow_2;
+    pow_2 *= s_2;
+  }
+  const CeedScalar jac = CeedJacobiPolynomial(n, alpha, 1, x),
+                   d_jac = n > 0 ? 0.5*(n + alpha + 2) *
+                           CeedJacobiPolynomial(n - 1, alpha + 1, 2, x) : 0.0;
+  *value = pow_1*pow_2*jac;
+  *deriv = (d_pow_1*pow_2 + pow_1*d_pow_2)*jac + pow_1*pow_2*d_jac;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Build the 1D functions of a collapsed coordinate simplex basis
+
+    The 1D functions are grouped in one level per collapsed coordinate; each
+    function of level l > 0 multiplies one function of level l-1, and the
+    functions of the last level are the basis functions, in the order
+    documented in @ref CeedBasisCreateH1Collapsed().  The first level holds
+    the constant, the two linear vertex functions, and the P_1d-2 bubbles.
+
+  @param dim        Dimension of the simplex, 2 or 3
+  @param P_1d       Number of basis functions along an edge
+  @param num_funcs  Array of length dim holding the number of functions of
+                      each level
+  @param[out] funcs Array of 5 entries per function, see
+                      CeedCollapsedFunction1D()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCollapsedFunctions(CeedInt dim, CeedInt P_1d,
+                                  const CeedInt *num_funcs, CeedInt *funcs) {
+  const CeedInt p = P_1d - 1, num_edge = p - 1,
+                num_tri = num_funcs[1] - (dim == 3);
+  CeedInt *f = funcs, *tri = funcs + 5*num_funcs[0];
+#define CEED_COLLAPSED_FUNC(parent, i, j, n, alpha) \
+  do { f[0] = parent; f[1] = i; f[2] = j; f[3] = n; f[4] = alpha; f += 5; } \
+  while (0)
+
+  // Constant, vertex functions, and bubbles in the first coordinate
+  CEED_COLLAPSED_FUNC(0, 0, 0, 0, 0);
+  CEED_COLLAPSED_FUNC(0, 1, 0, 0, 0);
+  CEED_COLLAPSED_FUNC(0, 0, 1, 0, 0);
+  for (CeedInt k = 1; k < p; k++)
+    CEED_COLLAPSED_FUNC(0, 1, 1, k - 1, 1);
+
+  // Triangle: vertices, edges 01, 02, 12, and interior
+  CEED_COLLAPSED_FUNC(1, 1, 0, 0, 0);
+  CEED_COLLAPSED_FUNC(2, 1, 0, 0, 0);
+  CEED_COLLAPSED_FUNC(0, 0, 1, 0, 0);
+  for (CeedInt k = 1; k < p; k++)
+    CEED_COLLAPSED_FUNC(2 + k, k + 1, 0, 0, 0);
+  for (CeedInt g = 1; g <= 2; g++)
+    for (CeedInt k = 1; k < p; k++)
+      CEED_COLLAPSED_FUNC(g, 1, 1, k - 1, 1);
+  for (CeedInt k = 1; k < p; k++)
+    for (CeedInt r = 1; r < p - k; r++)
+      CEED_COLLAPSED_FUNC(2 + k, k + 1, 1, r - 1, 2*k + 1);
+  if (dim == 2) return CEED_ERROR_SUCCESS;
+
+  // Tetrahedron: each triangle function t of degree e is extended by
+  //   ((1-z)/2)^e, or vanishes on the bottom face with (1+z)/2 P_(r-1)^(2e-1,1)
+  CEED_COLLAPSED_FUNC(0, 0, 0, 0, 0);
+  const CeedInt *t = tri;
+  // -- Vertices
+  for (CeedInt v = 0; v < 3; v++)
+    CEED_COLLAPSED_FUNC(v, 1, 0, 0, 0);
+  CEED_COLLAPSED_FUNC(num_tri, 0, 1, 0, 0);
+  // -- Edges 01, 02, 12 on the bottom face, then 03, 13, 23
+  for (CeedInt k = 3; k < 3 + 3*num_edge; k++)
+    CEED_COLLAPSED_FUNC(k, t[5*k+1] + t[5*k+2] + t[5*k+3], 0, 0, 0);
+  for (CeedInt v = 0; v < 3; v++)
+    for (CeedInt r = 1; r < p; r++)
+      CEED_COLLAPSED_FUNC(v, 1, 1, r - 1, 1);
+  // -- Faces 012 on the bottom, then 013, 023, 123
+  for (CeedInt k = 3 + 3*num_edge; k < num_tri; k++)
+    CEED_COLLAPSED_FUNC(k, t[5*k+1] + t[5*k+2] + t[5*k+3], 0, 0, 0);
+  for (CeedInt g = 0; g < 3; g++)
+    for (CeedInt k = 1; k < p; k++)
+      for (CeedInt r = 1; r < p - k; r++)
+        CEED_COLLAPSED_FUNC(3 + g*num_edge + k - 1, k + 1, 1, r - 1, 2*k + 1);
+  // -- Interior
+  for (CeedInt k = 3 + 3*num_edge; k < num_tri; k++) {
+    const CeedInt e = t[5*k+1] + t[5*k+2] + t[5*k+3];
+    for (CeedInt r = 1; r <= p - e; r++)
+      CEED_COLLAPSED_FUNC(k, e, 1, r - 1, 2*e - 1);
+  }
+#undef CEED_COLLAPSED_FUNC
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -489,9 +688,8 @@ int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt num_comp,
                                     CeedInt P, CeedInt Q, CeedQuadMode quad_mode,
                                     CeedBasis *basis) {
   // Allocate
-  int ierr, ierr2, i, j, k;
-  CeedScalar c1, c2, c3, c4, dx, *nodes, *interp_1d, *grad_1d, *q_ref_1d,
-             *q_weight_1d;
+  int ierr, ierr2;
+  CeedScalar *nodes, *interp_1d, *grad_1d, *q_ref_1d, *q_weight_1d;
 
   if (dim<1)
     // LCOV_EXCL_START
@@ -518,28 +716,8 @@ int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt num_comp,
   if (ierr) { goto cleanup; } CeedChk(ierr);
 
   // Build B, D matrix
-  // Fornberg, 1998
-  for (i = 0; i  < Q; i++) {
-    c1 = 1.0;
-    c3 = nodes[0] - q_ref_1d[i];
-    interp_1d[i*P+0] = 1.0;
-    for (j = 1; j < P; j++) {
-      c2 = 1.0;
-      c4 = c3;
-      c3 = nodes[j] - q_ref_1d[i];
-      for (k = 0; k < j; k++) {
-        dx = nodes[j] - nodes[k];
-        c2 *= dx;
-        if (k == j - 1) {
-          grad_1d[i*P + j] = c1*(interp_1d[i*P + k] - c4*grad_1d[i*P + k]) / c2;
-          interp_1d[i*P + j] = - c1*c4*interp_1d[i*P + k] / c2;
-        }
-        grad_1d[i*P + k] = (c3*grad_1d[i*P + k] - interp_1d[i*P + k]) / dx;
-        interp_1d[i*P + k] = c3*interp_1d[i*P + k] / dx;
-      }
-      c1 = c2;
-    }
-  }
+  ierr = CeedLagrangeInterp1D(P, nodes, Q, q_ref_1d, interp_1d, grad_1d);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   // Pass to CeedBasisCreateTensorH1
   ierr = CeedBasisCreateTensorH1(ceed, dim, num_comp, P, Q, interp_1d, grad_1d,
                                  q_ref_1d, q_weight_1d, basis); CeedChk(ierr);
@@ -700,6 +878,430 @@ int CeedBasisCreateHdiv(Ceed ceed, CeedElemTopology topo, CeedInt num_comp,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a tensor-product basis for H(div) discretizations
+
+    Each vector component d of the field is the tensor product of a closed
+      set of P_1d functions in the direction d, normal to the faces carrying
+      its nodes, with an open set of P_1d-1 functions in every other direction.
+      The nodes are ordered by vector component, then lexicographically with
+      x fastest, for a total of dim*P_1d*(P_1d-1)^(dim-1) nodes.
+
+  @param ceed            A Ceed object where the CeedBasis will be created
+  @param dim             Topological dimension of element
+  @param num_comp        Number of components (usually 1 for vectors in H(div)
+                           bases)
+  @param P_1d            Number of closed nodes in one dimension
+  @param Q_1d            Number of quadrature points in one dimension
+  @param interp_1d       Row-major (Q_1d * P_1d) matrix expressing the values of
+                           the closed 1D functions at quadrature points
+  @param grad_1d         Row-major (Q_1d * P_1d) matrix expressing derivatives
+                           of the closed 1D functions at quadrature points
+  @param interp_1d_open  Row-major (Q_1d * (P_1d-1)) matrix expressing the
+                           values of the open 1D functions at quadrature points
+  @param q_ref_1d        Array of length Q_1d holding the locations of
+                           quadrature points on the 1D reference element [-1, 1]
+  @param q_weight_1d     Array of length Q_1d holding the quadrature weights on
+                           the reference element
+  @param[out] basis      Address of the variable where the newly created
+                           CeedBasis will be stored.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateTensorHdiv(Ceed ceed, CeedInt dim, CeedInt num_comp,
+                              CeedInt P_1d, CeedInt Q_1d,
+                              const CeedScalar *interp_1d,
+                              const CeedScalar *grad_1d,
+                              const CeedScalar *interp_1d_open,
+                              const CeedScalar *q_ref_1d,
+                              const CeedScalar *q_weight_1d,
+                              CeedBasis *basis) {
+  int ierr;
+  const CeedElemTopology topos[3] = {CEED_TOPOLOGY_LINE, CEED_TOPOLOGY_QUAD,
+                                     CEED_TOPOLOGY_HEX
+                                    };
+
+  if (!ceed->BasisCreateTensorHdiv) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "Basis"); CeedChk(ierr);
+
+    if (delegate) {
+      ierr = CeedBasisCreateTensorHdiv(delegate, dim, num_comp, P_1d, Q_1d,
+                                       interp_1d, grad_1d, interp_1d_open,
+                                       q_ref_1d, q_weight_1d, basis);
+      CeedChk(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  if (dim < 1 || dim > 3)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION,
+                     "Tensor H(div) basis dimension must be 1, 2, or 3");
+  // LCOV_EXCL_STOP
+  if (P_1d < 2)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION,
+                     "Tensor H(div) basis needs at least 2 closed nodes");
+  // LCOV_EXCL_STOP
+
+  // Dense matrices, for the interface and for backends without tensor H(div)
+  const CeedInt num_block_nodes = P_1d*CeedIntPow(P_1d-1, dim-1),
+                P = dim*num_block_nodes, Q = CeedIntPow(Q_1d, dim);
+  CeedScalar *interp, *div, *q_ref, *q_weight;
+  ierr = CeedCalloc(dim*Q*P, &interp); CeedChk(ierr);
+  ierr = CeedCalloc(Q*P, &div); CeedChk(ierr);
+  ierr = CeedMalloc(dim*Q, &q_ref); CeedChk(ierr);
+  ierr = CeedMalloc(Q, &q_weight); CeedChk(ierr);
+  for (CeedInt q=0; q<Q; q++) {
+    q_weight[q] = 1.0;
+    for (CeedInt e=0, q_e=q; e<dim; e++, q_e/=Q_1d) {
+      q_ref[e*Q+q] = q_ref_1d[q_e%Q_1d];
+      q_weight[q] *= q_weight_1d[q_e%Q_1d];
+    }
+  }
+  for (CeedInt d=0; d<dim; d++)
+    for (CeedInt i=0; i<num_block_nodes; i++)
+      for (CeedInt q=0; q<Q; q++) {
+        CeedScalar val = 1.0, div_val = 1.0;
+        for (CeedInt e=0, i_e=i, q_e=q; e<dim; e++, q_e/=Q_1d) {
+          const CeedInt n = e == d ? P_1d : P_1d-1,
+                        k = (q_e%Q_1d)*n + i_e%n;
+          if (e == d) {
+            val *= interp_1d[k];
+            div_val *= grad_1d[k];
+          } else {
+            val *= interp_1d_open[k];
+            div_val *= interp_1d_open[k];
+          }
+          i_e /= n;
+        }
+        interp[(d*Q+q)*P + d*num_block_nodes + i] = val;
+        div[q*P + d*num_block_nodes + i] = div_val;
+      }
+
+  if (!ceed->BasisCreateTensorHdiv) {
+    ierr = CeedBasisCreateHdiv(ceed, topos[dim-1], num_comp, P, Q, interp, div,
+                               q_ref, q_weight, basis); CeedChk(ierr);
+    ierr = CeedFree(&interp); CeedChk(ierr);
+    ierr = CeedFree(&div); CeedChk(ierr);
+    ierr = CeedFree(&q_ref); CeedChk(ierr);
+    ierr = CeedFree(&q_weight); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  ierr = CeedCalloc(1, basis); CeedChk(ierr);
+
+  (*basis)->ceed = ceed;
+  ierr = CeedReference(ceed); CeedChk(ierr);
+  (*basis)->ref_count = 1;
+  (*basis)->tensor_basis = 0;
+  (*basis)->dim = dim;
+  (*basis)->topo = topos[dim-1];
+  (*basis)->num_comp = num_comp;
+  (*basis)->P = P;
+  (*basis)->Q = Q;
+  (*basis)->Q_comp = dim;
+  (*basis)->basis_space = 2; // 2 for H(div) space
+  (*basis)->q_ref_1d = q_ref;
+  (*basis)->q_weight_1d = q_weight;
+  (*basis)->interp = interp;
+  (*basis)->div = div;
+  ierr = ceed->BasisCreateTensorHdiv(dim, P_1d, Q_1d, interp_1d, grad_1d,
+                                     interp_1d_open, q_ref_1d, q_weight_1d,
+                                     *basis); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create a tensor-product Raviart-Thomas basis on quads and hexes
+
+    The normal component of the field is interpolated at the P_1d
+      Gauss-Lobatto nodes and the tangential components at the P_1d-1 Gauss
+      nodes, see @ref CeedBasisCreateTensorHdiv() for the node ordering.
+
+  @param ceed        A Ceed object where the CeedBasis will be created
+  @param dim         Topological dimension of element
+  @param num_comp    Number of components (usually 1 for vectors in H(div)
+                       bases)
+  @param P_1d        Number of Gauss-Lobatto nodes in one dimension.  The
+                       resulting element is RT_k with k=P_1d-2, so P_1d=2
+                       gives the lowest order element.
+  @param Q_1d        Number of quadrature points in one dimension.
+  @param quad_mode   Distribution of the Q_1d quadrature points (affects order
+                       of accuracy for the quadrature)
+  @param[out] basis  Address of the variable where the newly created
+                       CeedBasis will be stored.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateTensorHdivRaviartThomas(Ceed ceed, CeedInt dim,
+    CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, CeedQuadMode quad_mode,
+    CeedBasis *basis) {
+  int ierr, ierr2;
+  CeedScalar *nodes, *nodes_open, *weights_open, *interp_1d, *grad_1d,
+             *interp_1d_open, *grad_1d_open, *q_ref_1d, *q_weight_1d;
+
+  if (P_1d < 2)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION,
+                     "Raviart-Thomas basis needs at least 2 closed nodes");
+  // LCOV_EXCL_STOP
+
+  // Get Nodes and Weights
+  ierr = CeedCalloc(P_1d*Q_1d, &interp_1d); CeedChk(ierr);
+  ierr = CeedCalloc(P_1d*Q_1d, &grad_1d); CeedChk(ierr);
+  ierr = CeedCalloc((P_1d-1)*Q_1d, &interp_1d_open); CeedChk(ierr);
+  ierr = CeedCalloc((P_1d-1)*Q_1d, &grad_1d_open); CeedChk(ierr);
+  ierr = CeedCalloc(P_1d, &nodes); CeedChk(ierr);
+  ierr = CeedCalloc(P_1d-1, &nodes_open); CeedChk(ierr);
+  ierr = CeedCalloc(P_1d-1, &weights_open); CeedChk(ierr);
+  ierr = CeedCalloc(Q_1d, &q_ref_1d); CeedChk(ierr);
+  ierr = CeedCalloc(Q_1d, &q_weight_1d); CeedChk(ierr);
+  ierr = CeedLobattoQuadrature(P_1d, nodes, NULL);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGaussQuadrature(P_1d-1, nodes_open, weights_open);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  switch (quad_mode) {
+  case CEED_GAUSS:
+    ierr = CeedGaussQuadrature(Q_1d, q_ref_1d, q_weight_1d);
+    break;
+  case CEED_GAUSS_LOBATTO:
+    ierr = CeedLobattoQuadrature(Q_1d, q_ref_1d, q_weight_1d);
+    break;
+  }
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+
+  // Build closed and open B, D matrices
+  ierr = CeedLagrangeInterp1D(P_1d, nodes, Q_1d, q_ref_1d, interp_1d, grad_1d);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedLagrangeInterp1D(P_1d-1, nodes_open, Q_1d, q_ref_1d,
+                              interp_1d_open, grad_1d_open);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  // Pass to CeedBasisCreateTensorHdiv
+  ierr = CeedBasisCreateTensorHdiv(ceed, dim, num_comp, P_1d, Q_1d, interp_1d,
+                                   grad_1d, interp_1d_open, q_ref_1d,
+                                   q_weight_1d, basis); CeedChk(ierr);
+cleanup:
+  ierr2 = CeedFree(&interp_1d); CeedChk(ierr2);
+  ierr2 = CeedFree(&grad_1d); CeedChk(ierr2);
+  ierr2 = CeedFree(&interp_1d_open); CeedChk(ierr2);
+  ierr2 = CeedFree(&grad_1d_open); CeedChk(ierr2);
+  ierr2 = CeedFree(&nodes); CeedChk(ierr2);
+  ierr2 = CeedFree(&nodes_open); CeedChk(ierr2);
+  ierr2 = CeedFree(&weights_open); CeedChk(ierr2);
+  ierr2 = CeedFree(&q_ref_1d); CeedChk(ierr2);
+  ierr2 = CeedFree(&q_weight_1d); CeedChk(ierr2);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create an H^1 basis on triangles or tetrahedra in collapsed
+           coordinates
+
+    The reference simplex, with vertices v0 = (-1, -1, -1), v1 = (1, -1, -1),
+      v2 = (-1, 1, -1), and v3 = (-1, -1, 1), is the image of the cube
+      [-1, 1]^dim by the collapse x = (1+a)(1-b)(1-c)/4 - 1,
+      y = (1+b)(1-c)/2 - 1, z = c (on triangles, x = (1+a)(1-b)/2 - 1, y = b).
+      The basis is the boundary adapted modal basis of Sherwin and Karniadakis,
+      whose functions are products of 1D functions of a, b, and c, so
+      interpolation and gradients are applied by sum factorization in
+      O(P_1d^(dim+1)) operations per element instead of the O(P_1d^(2 dim)) of
+      @ref CeedBasisCreateH1().  Quadrature points are tensor products of Q_1d
+      Gauss points in the collapsed coordinates; Q_1d = P_1d + 1 integrates the
+      mass matrix exactly.
+
+    The basis functions are ordered by vertices v0, ..., v_dim, then P_1d-2
+      functions of increasing degree on each edge 01, 02, 12 (and 03, 13, 23),
+      then the functions on faces 012, 013, 023, 123 of tetrahedra, then the
+      interior functions.  Functions on an edge or a face depend only on its
+      vertices, taken in increasing order, so the basis is continuous between
+      elements whose local vertex numbering follows the global one.
+
+  @param ceed        A Ceed object where the CeedBasis will be created
+  @param topo        Topology of element, `CEED_TOPOLOGY_TRIANGLE` or
+                       `CEED_TOPOLOGY_TET`
+  @param num_comp    Number of field components (1 for scalar fields)
+  @param P_1d        Number of basis functions along an edge, the polynomial
+                       degree is P_1d-1
+  @param Q_1d        Number of quadrature points in each collapsed coordinate
+  @param[out] basis  Address of the variable where the newly created
+                       CeedBasis will be stored.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateH1Collapsed(Ceed ceed, CeedElemTopology topo,
+                               CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d,
+                               CeedBasis *basis) {
+  int ierr, ierr2;
+  CeedInt dim = 0;
+
+  if (!ceed->BasisCreateH1Collapsed) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "Basis"); CeedChk(ierr);
+
+    if (delegate) {
+      ierr = CeedBasisCreateH1Collapsed(delegate, topo, num_comp, P_1d, Q_1d,
+                                        basis); CeedChk(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  if (topo != CEED_TOPOLOGY_TRIANGLE && topo != CEED_TOPOLOGY_TET)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Collapsed coordinate bases are only defined on triangles "
+                     "and tetrahedra");
+  // LCOV_EXCL_STOP
+  if (P_1d < 2 || Q_1d < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION,
+                     "Collapsed coordinate basis needs at least 2 functions "
+                     "per edge and 1 quadrature point");
+  // LCOV_EXCL_STOP
+  ierr = CeedBasisGetTopologyDimension(topo, &dim); CeedChk(ierr);
+
+  // 1D functions of each collapsed coordinate
+  CeedInt num_funcs[3] = {P_1d + 1, P_1d*(P_1d + 1)/2 + (dim == 3),
+                          P_1d*(P_1d + 1)*(P_1d + 2)/6
+                         }, offsets[3] = {0, 0, 0}, num_total = 0;
+  for (CeedInt l = 0; l < dim; l++) {
+    offsets[l] = num_total;
+    num_total += num_funcs[l];
+  }
+  const CeedInt P = num_funcs[dim-1], Q = CeedIntPow(Q_1d, dim);
+  CeedInt *funcs = NULL, *parents = NULL;
+  CeedScalar *interp_1d = NULL, *grad_1d = NULL, *q_ref_1d = NULL,
+              *q_weight_1d = NULL, *d_eta = NULL, *interp = NULL, *grad = NULL,
+              *q_ref = NULL, *q_weight = NULL;
+  ierr = CeedMalloc(5*num_total, &funcs); CeedChk(ierr);
+  ierr = CeedMalloc(num_total - num_funcs[0], &parents); CeedChk(ierr);
+  ierr = CeedMalloc(Q_1d*num_total, &interp_1d); CeedChk(ierr);
+  ierr = CeedMalloc(Q_1d*num_total, &grad_1d); CeedChk(ierr);
+  ierr = CeedMalloc(Q_1d, &q_ref_1d); CeedChk(ierr);
+  ierr = CeedMalloc(Q_1d, &q_weight_1d); CeedChk(ierr);
+  ierr = CeedCalloc(dim*dim*Q, &d_eta); CeedChk(ierr);
+  ierr = CeedCalloc(Q*P, &interp); CeedChk(ierr);
+  ierr = CeedCalloc(dim*Q*P, &grad); CeedChk(ierr);
+  ierr = CeedMalloc(dim*Q, &q_ref); CeedChk(ierr);
+  ierr = CeedMalloc(Q, &q_weight); CeedChk(ierr);
+  ierr = CeedCollapsedFunctions(dim, P_1d, num_funcs, funcs);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGaussQuadrature(Q_1d, q_ref_1d, q_weight_1d);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  for (CeedInt l = 0; l < dim; l++)
+    for (CeedInt k = 0; k < num_funcs[l]; k++) {
+      const CeedInt *func = &funcs[5*(offsets[l] + k)];
+      if (l > 0) parents[offsets[l] - num_funcs[0] + k] = func[0];
+      for (CeedInt i = 0; i < Q_1d; i++) {
+        ierr = CeedCollapsedFunction1D(func, q_ref_1d[i],
+                                       &interp_1d[Q_1d*offsets[l] +
+                                                  i*num_funcs[l] + k],
+                                       &grad_1d[Q_1d*offsets[l] +
+                                                i*num_funcs[l] + k]);
+        if (ierr) { goto cleanup; } CeedChk(ierr);
+      }
+    }
+
+  // Quadrature on the simplex and derivatives of the collapsed coordinates
+  //   d_eta[(d*dim + e)*Q + q] = d eta_e / d x_d
+  for (CeedInt q = 0; q < Q; q++) {
+    CeedScalar eta[3] = {0., 0., 0.};
+    q_weight[q] = 1.0;
+    for (CeedInt e = 0, q_e = q; e < dim; e++, q_e /= Q_1d) {
+      eta[e] = q_ref_1d[q_e%Q_1d];
+      q_weight[q] *= q_weight_1d[q_e%Q_1d];
+    }
+    const CeedScalar a = eta[0], b = eta[1], c = eta[2];
+    if (dim == 2) {
+      q_weight[q] *= 0.5*(1 - b);
+      q_ref[0*Q+q] = 0.5*(1 + a)*(1 - b) - 1;
+      q_ref[1*Q+q] = b;
+      d_eta[(0*2+0)*Q+q] = 2/(1 - b);
+      d_eta[(1*2+0)*Q+q] = (1 + a)/(1 - b);
+      d_eta[(1*2+1)*Q+q] = 1.0;
+    } else {
+      q_weight[q] *= 0.125*(1 - b)*(1 - c)*(1 - c);
+      q_ref[0*Q+q] = 0.25*(1 + a)*(1 - b)*(1 - c) - 1;
+      q_ref[1*Q+q] = 0.5*(1 + b)*(1 - c) - 1;
+      q_ref[2*Q+q] = c;
+      d_eta[(0*3+0)*Q+q] = 4/((1 - b)*(1 - c));
+      d_eta[(1*3+0)*Q+q] = 2*(1 + a)/((1 - b)*(1 - c));
+      d_eta[(1*3+1)*Q+q] = 2/(1 - c);
+      d_eta[(2*3+0)*Q+q] = 2*(1 + a)/((1 - b)*(1 - c));
+      d_eta[(2*3+1)*Q+q] = (1 + b)/(1 - c);
+      d_eta[(2*3+2)*Q+q] = 1.0;
+    }
+  }
+
+  // Dense matrices, for the interface and for backends without this basis
+  for (CeedInt n = 0; n < P; n++)
+    for (CeedInt q = 0; q < Q; q++) {
+      CeedScalar val = 1.0, d_val[3] = {1., 1., 1.};
+      for (CeedInt l = dim-1, k = n; l >= 0; l--) {
+        const CeedInt q_l = (q/CeedIntPow(Q_1d, l))%Q_1d,
+                      i = Q_1d*offsets[l] + q_l*num_funcs[l] + k;
+        val *= interp_1d[i];
+        for (CeedInt e = 0; e < dim; e++)
+          d_val[e] *= e == l ? grad_1d[i] : interp_1d[i];
+        k = funcs[5*(offsets[l] + k)];
+      }
+      interp[q*P+n] = val;
+      for (CeedInt d = 0; d < dim; d++)
+        for (CeedInt e = 0; e < dim; e++)
+          grad[(d*Q+q)*P+n] += d_eta[(d*dim+e)*Q+q]*d_val[e];
+    }
+
+  if (!ceed->BasisCreateH1Collapsed) {
+    ierr = CeedBasisCreateH1(ceed, topo, num_comp, P, Q, interp, grad, q_ref,
+                             q_weight, basis);
+    goto cleanup;
+  }
+
+  ierr = CeedCalloc(1, basis);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  (*basis)->ceed = ceed;
+  ierr = CeedReference(ceed);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  (*basis)->ref_count = 1;
+  (*basis)->tensor_basis = 0;
+  (*basis)->dim = dim;
+  (*basis)->topo = topo;
+  (*basis)->num_comp = num_comp;
+  (*basis)->P = P;
+  (*basis)->Q = Q;
+  (*basis)->Q_comp = 1;
+  (*basis)->basis_space = 1; // 1 for H^1 space
+  (*basis)->q_ref_1d = q_ref;
+  (*basis)->q_weight_1d = q_weight;
+  (*basis)->interp = interp;
+  (*basis)->grad = grad;
+  q_ref = q_weight = interp = grad = NULL;
+  ierr = ceed->BasisCreateH1Collapsed(topo, dim, Q_1d, num_funcs, parents,
+                                      interp_1d, grad_1d, d_eta, *basis);
+cleanup:
+  ierr2 = CeedFree(&funcs); CeedChk(ierr2);
+  ierr2 = CeedFree(&parents); CeedChk(ierr2);
+  ierr2 = CeedFree(&interp_1d); CeedChk(ierr2);
+  ierr2 = CeedFree(&grad_1d); CeedChk(ierr2);
+  ierr2 = CeedFree(&q_ref_1d); CeedChk(ierr2);
+  ierr2 = CeedFree(&q_weight_1d); CeedChk(ierr2);
+  ierr2 = CeedFree(&d_eta); CeedChk(ierr2);
+  ierr2 = CeedFree(&interp); CeedChk(ierr2);
+  ierr2 = CeedFree(&grad); CeedChk(ierr2);
+  ierr2 = CeedFree(&q_ref); CeedChk(ierr2);
+  ierr2 = CeedFree(&q_weight); CeedChk(ierr2);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Copy the pointer to a CeedBasis. Both pointers should
            be destroyed with `CeedBasisDestroy()`;
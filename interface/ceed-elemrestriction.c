@@ -17,8 +17,10 @@
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
 #include <ceed-impl.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 /// @file
 /// Implementation of CeedElemRestriction interfaces
@@ -29,6 +31,10 @@
 /// @addtogroup CeedElemRestrictionDeveloper
 /// @{
 
+/// Lock for the colorings and blocked copies cached on restrictions, which
+///   may be requested by operators set up concurrently on several threads
+static pthread_mutex_t ceed_rstr_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
 /**
   @brief Permute and pad offsets for a blocked restriction
 
@@ -59,6 +65,189 @@ int CeedPermutePadOffsets(const CeedInt *offsets, CeedInt *blk_offsets,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute a greedy coloring of the element blocks of a
+           CeedElemRestriction
+
+  Each block gets the smallest color not used by an earlier block that
+    shares an L-vector node with it. The blocks of each color are stored in
+    increasing order. Must be called with ceed_rstr_cache_lock held; the
+    coloring is published last, with release ordering, so lock-free readers
+    of rstr->color_offsets see the complete coloring.
+
+  @param rstr  CeedElemRestriction to color
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionSetupColoring(CeedElemRestriction rstr) {
+  int ierr;
+  const CeedInt num_blk = rstr->num_blk,
+                blk_elem_size = rstr->blk_size*rstr->elem_size;
+  CeedInt num_colors = num_blk ? 1 : 0, *blk_color, *next;
+
+  ierr = CeedCalloc(num_blk, &blk_color); CeedChk(ierr);
+  if (!rstr->strides) {
+    const CeedInt *offsets;
+    CeedInt num_nodes = 0, *node_blk_offsets, *node_blks, *forbidden;
+    ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+
+    // Blocks touching each node
+    for (CeedInt p=0; p<num_blk*blk_elem_size; p++)
+      num_nodes = CeedIntMax(num_nodes, offsets[p] + 1);
+    ierr = CeedCalloc(num_nodes + 1, &node_blk_offsets); CeedChk(ierr);
+    for (CeedInt p=0; p<num_blk*blk_elem_size; p++)
+      node_blk_offsets[offsets[p] + 1]++;
+    for (CeedInt n=0; n<num_nodes; n++)
+      node_blk_offsets[n + 1] += node_blk_offsets[n];
+    ierr = CeedMalloc(node_blk_offsets[num_nodes], &node_blks); CeedChk(ierr);
+    ierr = CeedMalloc(num_nodes, &next); CeedChk(ierr);
+    memcpy(next, node_blk_offsets, num_nodes * sizeof(next[0]));
+    for (CeedInt p=0; p<num_blk*blk_elem_size; p++)
+      node_blks[next[offsets[p]]++] = p / blk_elem_size;
+    ierr = CeedFree(&next); CeedChk(ierr);
+
+    // Greedy coloring
+    ierr = CeedMalloc(num_blk, &forbidden); CeedChk(ierr);
+    for (CeedInt b=0; b<num_blk; b++)
+      forbidden[b] = -1;
+    for (CeedInt b=0; b<num_blk; b++) {
+      for (CeedInt i=0; i<blk_elem_size; i++) {
+        const CeedInt n = offsets[b*blk_elem_size + i];
+        for (CeedInt q=node_blk_offsets[n]; q<node_blk_offsets[n+1]; q++)
+          if (node_blks[q] < b)
+            forbidden[blk_color[node_blks[q]]] = b;
+      }
+      CeedInt c = 0;
+      while (forbidden[c] == b) c++;
+      blk_color[b] = c;
+      num_colors = CeedIntMax(num_colors, c + 1);
+    }
+    ierr = CeedFree(&forbidden); CeedChk(ierr);
+    ierr = CeedFree(&node_blks); CeedChk(ierr);
+    ierr = CeedFree(&node_blk_offsets); CeedChk(ierr);
+    ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  }
+
+  // Sort blocks by color
+  CeedInt *color_offsets, *color_blocks;
+  ierr = CeedCalloc(num_colors + 1, &color_offsets); CeedChk(ierr);
+  for (CeedInt b=0; b<num_blk; b++)
+    color_offsets[blk_color[b] + 1]++;
+  for (CeedInt c=0; c<num_colors; c++)
+    color_offsets[c + 1] += color_offsets[c];
+  ierr = CeedMalloc(num_blk, &color_blocks); CeedChk(ierr);
+  ierr = CeedMalloc(num_colors, &next); CeedChk(ierr);
+  memcpy(next, color_offsets, num_colors * sizeof(next[0]));
+  for (CeedInt b=0; b<num_blk; b++)
+    color_blocks[next[blk_color[b]]++] = b;
+  ierr = CeedFree(&next); CeedChk(ierr);
+  ierr = CeedFree(&blk_color); CeedChk(ierr);
+
+  // Publish
+  rstr->num_colors = num_colors;
+  rstr->color_blocks = color_blocks;
+  __atomic_store_n(&rstr->color_offsets, color_offsets, __ATOMIC_RELEASE);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get or create the cached blocked copy of a CeedElemRestriction
+
+  Must be called with ceed_rstr_cache_lock held.
+
+  @param rstr            CeedElemRestriction
+  @param blk_size        Number of elements in a block
+  @param[out] blk_rstr   Address of the variable where the blocked
+                           CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionGetBlockedCached(CeedElemRestriction rstr,
+    CeedInt blk_size, CeedElemRestriction *blk_rstr) {
+  int ierr;
+
+  for (CeedInt i=0; i<rstr->num_blk_rstrs; i++)
+    if (rstr->blk_rstrs[i]->blk_size == blk_size) {
+      ierr = CeedElemRestrictionReferenceCopy(rstr->blk_rstrs[i], blk_rstr);
+      CeedChk(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+
+  // Create and cache blocked copy
+  CeedElemRestriction blk;
+  if (rstr->strides) {
+    ierr = CeedElemRestrictionCreateBlockedStrided(rstr->ceed, rstr->num_elem,
+           rstr->elem_size, blk_size, rstr->num_comp, rstr->l_size,
+           rstr->strides, &blk); CeedChk(ierr);
+  } else {
+    const CeedInt *offsets;
+    ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionCreateBlocked(rstr->ceed, rstr->num_elem,
+                                            rstr->elem_size, blk_size,
+                                            rstr->num_comp, rstr->comp_stride,
+                                            rstr->l_size, CEED_MEM_HOST,
+                                            CEED_COPY_VALUES, offsets, &blk);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  }
+  ierr = CeedRealloc(rstr->num_blk_rstrs + 1, &rstr->blk_rstrs); CeedChk(ierr);
+  rstr->blk_rstrs[rstr->num_blk_rstrs++] = blk;
+  ierr = CeedElemRestrictionReferenceCopy(blk, blk_rstr); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @cond DOXYGEN_SKIP
+typedef struct {
+  CeedElemRestriction rstr;
+  CeedTransposeMode t_mode;
+  CeedVector u, ru;
+} CeedElemRestrictionRequestCtx;
+/// @endcond
+
+/**
+  @brief Apply a CeedElemRestriction for an asynchronous request
+
+  @param ctx  CeedElemRestrictionRequestCtx holding the restriction and vectors
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionRequestRun(void *ctx) {
+  CeedElemRestrictionRequestCtx *req = ctx;
+
+  return CeedElemRestrictionApply(req->rstr, req->t_mode, req->u, req->ru,
+                                  CEED_REQUEST_IMMEDIATE);
+}
+
+/**
+  @brief Release the objects held by an asynchronous CeedElemRestriction
+           request
+
+  @param ctx  CeedElemRestrictionRequestCtx to release
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionRequestFinalize(void *ctx) {
+  int ierr;
+  CeedElemRestrictionRequestCtx *req = ctx;
+
+  ierr = CeedVectorDestroy(&req->u); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&req->ru); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&req->rstr); CeedChk(ierr);
+  ierr = CeedFree(&req); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -132,6 +321,11 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr,
 **/
 int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr,
                                       const CeedInt **offsets) {
+  int ierr;
+
+  if (rstr->RestoreOffsets) {
+    ierr = rstr->RestoreOffsets(rstr, offsets); CeedChk(ierr);
+  }
   *offsets = NULL;
   rstr->num_readers--;
   return CEED_ERROR_SUCCESS;
@@ -241,6 +435,84 @@ int CeedElemRestrictionSetELayout(CeedElemRestriction rstr,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get a coloring of the element blocks of a CeedElemRestriction
+
+  Blocks of one color share no L-vector nodes, so the transpose restriction
+    of all blocks of one color may run concurrently without write conflicts.
+    Whole blocks are colored, so blocked restrictions created with
+    CeedElemRestrictionCreateBlocked() keep their layout. Strided
+    restrictions have a single color. The coloring is computed on first use
+    and cached on the CeedElemRestriction; this is safe to call from
+    several threads at once.
+
+  @param rstr                CeedElemRestriction
+  @param[out] num_colors     Variable to store number of colors
+  @param[out] color_offsets  Variable to store array of size num_colors+1; the
+                               blocks of color c are blocks[color_offsets[c]]
+                               through blocks[color_offsets[c+1]-1]
+  @param[out] blocks         Variable to store array of block indices, sorted
+                               by color
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetColoring(CeedElemRestriction rstr,
+                                   CeedInt *num_colors,
+                                   const CeedInt **color_offsets,
+                                   const CeedInt **blocks) {
+  int ierr;
+
+  if (!__atomic_load_n(&rstr->color_offsets, __ATOMIC_ACQUIRE)) {
+    pthread_mutex_lock(&ceed_rstr_cache_lock);
+    ierr = rstr->color_offsets ? CEED_ERROR_SUCCESS :
+           CeedElemRestrictionSetupColoring(rstr);
+    pthread_mutex_unlock(&ceed_rstr_cache_lock);
+    CeedChk(ierr);
+  }
+  *num_colors = rstr->num_colors;
+  *color_offsets = rstr->color_offsets;
+  *blocks = rstr->color_blocks;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get a blocked copy of a CeedElemRestriction
+
+  The blocked copy is created on first use for each block size and cached on
+    the CeedElemRestriction, so all fields and operators using the same
+    restriction share one set of blocked offsets. The cache is updated under
+    a lock, so operators sharing a restriction may be set up concurrently.
+    Restrictions that already have the requested block size and no
+    orientation are returned directly.
+
+  @param rstr            CeedElemRestriction
+  @param blk_size        Number of elements in a block
+  @param[out] blk_rstr   Address of the variable where the blocked
+                           CeedElemRestriction will be stored, the caller
+                           must destroy it with CeedElemRestrictionDestroy()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetBlocked(CeedElemRestriction rstr, CeedInt blk_size,
+                                  CeedElemRestriction *blk_rstr) {
+  int ierr;
+
+  *blk_rstr = NULL;
+  if (rstr->blk_size == blk_size && !rstr->is_oriented) {
+    ierr = CeedElemRestrictionReferenceCopy(rstr, blk_rstr); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+  pthread_mutex_lock(&ceed_rstr_cache_lock);
+  ierr = CeedElemRestrictionGetBlockedCached(rstr, blk_size, blk_rstr);
+  pthread_mutex_unlock(&ceed_rstr_cache_lock);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the backend data of a CeedElemRestriction
 
@@ -755,6 +1027,21 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode,
                      "Output vector size %d not compatible with "
                      "element restriction (%d, %d)", ru->length, m, n);
   // LCOV_EXCL_STOP
+
+  bool is_async;
+  ierr = CeedRequestIsAsync(rstr->ceed, request, &is_async); CeedChk(ierr);
+  if (is_async) {
+    CeedElemRestrictionRequestCtx *req;
+    ierr = CeedCalloc(1, &req); CeedChk(ierr);
+    req->t_mode = t_mode;
+    ierr = CeedElemRestrictionReferenceCopy(rstr, &req->rstr); CeedChk(ierr);
+    ierr = CeedVectorReferenceCopy(u, &req->u); CeedChk(ierr);
+    ierr = CeedVectorReferenceCopy(ru, &req->ru); CeedChk(ierr);
+    ierr = CeedRequestCreate(rstr->ceed, CeedElemRestrictionRequestRun,
+                             CeedElemRestrictionRequestFinalize, req, request);
+    CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
   ierr = rstr->Apply(rstr, t_mode, u, ru, request); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
 }
@@ -814,6 +1101,53 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply the transpose of a CeedElemRestriction, overwriting the output
+           L-vector instead of summing into it
+
+  This computes @a ru = r^T @a u, with the same result as setting @a ru to zero
+    and calling CeedElemRestrictionApply() with @ref CEED_TRANSPOSE. Backends
+    may write each L-vector entry once with its full sum, which avoids a
+    separate sweep to zero @a ru.
+
+  @param rstr    CeedElemRestriction
+  @param u       Input E-vector
+  @param ru      Output L-vector (of size @a l_size)
+  @param request Request or @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionApplyTransposeOverwrite(CeedElemRestriction rstr,
+    CeedVector u, CeedVector ru, CeedRequest *request) {
+  CeedInt m, n;
+  int ierr;
+
+  m = rstr->l_size;
+  n = rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
+  if (n != u->length)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
+                     "Input vector size %d not compatible with "
+                     "element restriction (%d, %d)", u->length, m, n);
+  // LCOV_EXCL_STOP
+  if (m != ru->length)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
+                     "Output vector size %d not compatible with "
+                     "element restriction (%d, %d)", ru->length, m, n);
+  // LCOV_EXCL_STOP
+
+  if (rstr->ApplyTransposeOverwrite) {
+    ierr = rstr->ApplyTransposeOverwrite(rstr, u, ru, request); CeedChk(ierr);
+  } else {
+    ierr = CeedVectorSetValue(ru, 0.0); CeedChk(ierr);
+    ierr = rstr->Apply(rstr, CEED_TRANSPOSE, u, ru, request); CeedChk(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the Ceed associated with a CeedElemRestriction
 
@@ -1021,6 +1355,12 @@ int CeedElemRestrictionDestroy(CeedElemRestriction *rstr) {
     ierr = (*rstr)->Destroy(*rstr); CeedChk(ierr);
   }
   ierr = CeedFree(&(*rstr)->strides); CeedChk(ierr);
+  ierr = CeedFree(&(*rstr)->color_offsets); CeedChk(ierr);
+  ierr = CeedFree(&(*rstr)->color_blocks); CeedChk(ierr);
+  for (CeedInt i=0; i<(*rstr)->num_blk_rstrs; i++) {
+    ierr = CeedElemRestrictionDestroy(&(*rstr)->blk_rstrs[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&(*rstr)->blk_rstrs); CeedChk(ierr);
   ierr = CeedDestroy(&(*rstr)->ceed); CeedChk(ierr);
   ierr = CeedFree(rstr); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
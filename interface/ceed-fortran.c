@@ -447,8 +447,7 @@ void fCeedElemRestrictionView(int *elemr, int *err) {
 
 #define fCeedRequestWait FORTRAN_NAME(ceedrequestwait, CEEDREQUESTWAIT)
 void fCeedRequestWait(int *rqst, int *err) {
-  // TODO Uncomment this once CeedRequestWait is implemented
-  //*err = CeedRequestWait(&CeedRequest_dict[*rqst]);
+  *err = CeedRequestWait(&CeedRequest_dict[*rqst]);
 
   if (*err == 0) {
     CeedRequest_n--;
@@ -46,7 +46,8 @@ static int CeedOperatorCheckField(Ceed ceed, CeedQFunctionField qf_field,
                                   CeedElemRestriction r, CeedBasis b) {
   int ierr;
   CeedEvalMode eval_mode = qf_field->eval_mode;
-  CeedInt dim = 1, num_comp = 1, restr_num_comp = 1, size = qf_field->size;
+  CeedInt dim = 1, num_comp = 1, Q_comp = 1, restr_num_comp = 1,
+          size = qf_field->size;
   // Restriction
   if (r != CEED_ELEMRESTRICTION_NONE) {
     if (eval_mode == CEED_EVAL_WEIGHT) {
@@ -77,6 +78,7 @@ static int CeedOperatorCheckField(Ceed ceed, CeedQFunctionField qf_field,
                        qf_field->field_name);
     ierr = CeedBasisGetDimension(b, &dim); CeedChk(ierr);
     ierr = CeedBasisGetNumComponents(b, &num_comp); CeedChk(ierr);
+    ierr = CeedBasisGetNumQuadratureComponents(b, &Q_comp); CeedChk(ierr);
     if (r != CEED_ELEMRESTRICTION_NONE && restr_num_comp != num_comp) {
       // LCOV_EXCL_START
       return CeedError(ceed, CEED_ERROR_DIMENSION,
@@ -100,12 +102,12 @@ static int CeedOperatorCheckField(Ceed ceed, CeedQFunctionField qf_field,
     // LCOV_EXCL_STOP
     break;
   case CEED_EVAL_INTERP:
-    if (size != num_comp)
+    if (size != num_comp * Q_comp)
       // LCOV_EXCL_START
       return CeedError(ceed, CEED_ERROR_DIMENSION,
                        "Field '%s' of size %d and EvalMode %s: ElemRestriction/Basis has %d components",
                        qf_field->field_name, qf_field->size, CeedEvalModes[qf_field->eval_mode],
-                       num_comp);
+                       num_comp * Q_comp);
     // LCOV_EXCL_STOP
     break;
   case CEED_EVAL_GRAD:
@@ -122,7 +124,13 @@ static int CeedOperatorCheckField(Ceed ceed, CeedQFunctionField qf_field,
     // No additional checks required
     break;
   case CEED_EVAL_DIV:
-    // Not implemented
+    if (size != num_comp)
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_DIMENSION,
+                       "Field '%s' of size %d and EvalMode %s: ElemRestriction/Basis has %d components",
+                       qf_field->field_name, qf_field->size, CeedEvalModes[qf_field->eval_mode],
+                       num_comp);
+    // LCOV_EXCL_STOP
     break;
   case CEED_EVAL_CURL:
     // Not implemented
@@ -329,6 +337,132 @@ static int CeedOperatorContextSetGeneric(CeedOperator op,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Complete the lazy backend setup of a CeedOperator and its
+           sub-operators
+
+  Backend setup creates and references objects that may be shared with other
+    operators, so it runs on the calling thread before an apply is queued.
+
+  @param op  CeedOperator to set up
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSetupBackend(CeedOperator op) {
+  int ierr;
+
+  for (CeedInt i=0; i<op->num_suboperators; i++) {
+    ierr = CeedOperatorSetupBackend(op->sub_operators[i]); CeedChk(ierr);
+  }
+  if (op->Setup) {
+    ierr = op->Setup(op); CeedChk(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @cond DOXYGEN_SKIP
+typedef struct {
+  CeedOperator op;
+  CeedVector in, out;
+  bool is_add, is_range;
+  CeedInt elem_start, elem_end;
+} CeedOperatorRequestCtx;
+/// @endcond
+
+/**
+  @brief Apply a CeedOperator for an asynchronous request
+
+  @param ctx  CeedOperatorRequestCtx holding the operator and vectors
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorRequestRun(void *ctx) {
+  CeedOperatorRequestCtx *req = ctx;
+
+  if (req->is_range)
+    return CeedOperatorApplyAddRange(req->op, req->elem_start, req->elem_end,
+                                     req->in, req->out, CEED_REQUEST_IMMEDIATE);
+  if (req->is_add)
+    return CeedOperatorApplyAdd(req->op, req->in, req->out,
+                                CEED_REQUEST_IMMEDIATE);
+  return CeedOperatorApply(req->op, req->in, req->out, CEED_REQUEST_IMMEDIATE);
+}
+
+/**
+  @brief Release the objects held by an asynchronous CeedOperator request
+
+  @param ctx  CeedOperatorRequestCtx to release
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorRequestFinalize(void *ctx) {
+  int ierr;
+  CeedOperatorRequestCtx *req = ctx;
+
+  if (req->in && req->in != CEED_VECTOR_NONE) {
+    ierr = CeedVectorDestroy(&req->in); CeedChk(ierr);
+  }
+  if (req->out && req->out != CEED_VECTOR_NONE) {
+    ierr = CeedVectorDestroy(&req->out); CeedChk(ierr);
+  }
+  ierr = CeedOperatorDestroy(&req->op); CeedChk(ierr);
+  ierr = CeedFree(&req); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Start applying a CeedOperator on the background thread of its Ceed
+           context
+
+  @param op          CeedOperator to apply
+  @param in          CeedVector containing input state or NULL
+  @param out         CeedVector to store result or NULL
+  @param is_add      Boolean flag to add to, rather than overwrite, @a out
+  @param elem_start  First element of the range to apply, or -1 to apply all
+                       elements
+  @param elem_end    One past the last element of the range to apply
+  @param request     Address of CeedRequest to create
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAsync(CeedOperator op, CeedVector in,
+                                  CeedVector out, bool is_add,
+                                  CeedInt elem_start, CeedInt elem_end,
+                                  CeedRequest *request) {
+  int ierr;
+  CeedOperatorRequestCtx *req;
+
+  ierr = CeedOperatorSetupBackend(op); CeedChk(ierr);
+  ierr = CeedCalloc(1, &req); CeedChk(ierr);
+  req->is_add = is_add;
+  req->is_range = elem_start >= 0;
+  req->elem_start = elem_start;
+  req->elem_end = elem_end;
+  ierr = CeedOperatorReferenceCopy(op, &req->op); CeedChk(ierr);
+  if (in && in != CEED_VECTOR_NONE) {
+    ierr = CeedVectorReferenceCopy(in, &req->in); CeedChk(ierr);
+  } else {
+    req->in = in;
+  }
+  if (out && out != CEED_VECTOR_NONE) {
+    ierr = CeedVectorReferenceCopy(out, &req->out); CeedChk(ierr);
+  } else {
+    req->out = out;
+  }
+  ierr = CeedRequestCreate(op->ceed, CeedOperatorRequestRun,
+                           CeedOperatorRequestFinalize, req, request);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -1265,6 +1399,14 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out,
   int ierr;
   ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
 
+  bool is_async;
+  ierr = CeedRequestIsAsync(op->ceed, request, &is_async); CeedChk(ierr);
+  if (is_async) {
+    ierr = CeedOperatorApplyAsync(op, in, out, false, -1, -1, request);
+    CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
   if (op->num_elem)  {
     // Standard Operator
     if (op->Apply) {
@@ -1306,9 +1448,14 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out,
         }
       }
       // Apply
-      for (CeedInt i=0; i<op->num_suboperators; i++) {
-        ierr = CeedOperatorApplyAdd(op->sub_operators[i], in, out, request);
-        CeedChk(ierr);
+      if (op->ApplyAddComposite) {
+        ierr = op->ApplyAddComposite(op, in, out, request); CeedChk(ierr);
+      } else {
+        for (CeedInt i=0; i<op->num_suboperators; i++) {
+          ierr = CeedOperatorApplyAdd(op->sub_operators[i], in, out,
+                                      CEED_REQUEST_IMMEDIATE);
+          CeedChk(ierr);
+        }
       }
     }
   }
@@ -1339,6 +1486,14 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out,
   int ierr;
   ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
 
+  bool is_async;
+  ierr = CeedRequestIsAsync(op->ceed, request, &is_async); CeedChk(ierr);
+  if (is_async) {
+    ierr = CeedOperatorApplyAsync(op, in, out, true, -1, -1, request);
+    CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
   if (op->num_elem)  {
     // Standard Operator
     ierr = op->ApplyAdd(op, in, out, request); CeedChk(ierr);
@@ -1353,7 +1508,8 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out,
       ierr = CeedOperatorGetSubList(op, &sub_operators); CeedChk(ierr);
 
       for (CeedInt i=0; i<num_suboperators; i++) {
-        ierr = CeedOperatorApplyAdd(sub_operators[i], in, out, request);
+        ierr = CeedOperatorApplyAdd(sub_operators[i], in, out,
+                                    CEED_REQUEST_IMMEDIATE);
         CeedChk(ierr);
       }
     }
@@ -1361,6 +1517,120 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply CeedOperator on a range of elements and add result to output
+           vector
+
+  This computes the contribution of the elements with indices in
+    [@a elem_start, @a elem_end) to the action of the operator, adding it to
+    the (active) output. The result depends only on the entries of @a in that
+    are touched by these elements, so an application can apply the interior
+    elements while ghost values are still being communicated and apply the
+    remaining elements once they have arrived.
+
+  @param op          CeedOperator to apply
+  @param elem_start  First element of the range
+  @param elem_end    One past the last element of the range
+  @param[in] in      CeedVector containing input state or NULL if there are no
+                       active inputs
+  @param[out] out    CeedVector to sum in result of applying operator (must be
+                       distinct from @a in) or NULL if there are no active
+                       outputs
+  @param request     Address of CeedRequest for non-blocking completion, else
+                       @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddRange(CeedOperator op, CeedInt elem_start,
+                              CeedInt elem_end, CeedVector in, CeedVector out,
+                              CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+
+  if (op->is_composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Cannot apply a range of elements of a composite operator");
+  // LCOV_EXCL_STOP
+  if (elem_start < 0 || elem_start > elem_end || elem_end > op->num_elem)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_DIMENSION,
+                     "Element range [%d, %d) not valid for operator with %d "
+                     "elements", elem_start, elem_end, op->num_elem);
+  // LCOV_EXCL_STOP
+  if (!op->ApplyAddRange)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Backend does not implement ApplyAddRange");
+  // LCOV_EXCL_STOP
+
+  bool is_async;
+  ierr = CeedRequestIsAsync(op->ceed, request, &is_async); CeedChk(ierr);
+  if (is_async) {
+    ierr = CeedOperatorApplyAsync(op, in, out, true, elem_start, elem_end,
+                                  request); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  if (elem_start < elem_end) {
+    ierr = op->ApplyAddRange(op, elem_start, elem_end, in, out, request);
+    CeedChk(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply CeedOperator to a vector and compute the dot product of the
+           input with the output
+
+  This computes @a out = A @a in, as CeedOperatorApply(), and @a result =
+    @a in · @a out, as needed for the step length in conjugate gradients.
+    Backends may accumulate the dot product element by element while the
+    element output is still in cache, which saves a full read of @a out
+    compared to calling CeedVectorDot() after the apply. The result may then
+    differ from CeedVectorDot() by rounding.
+
+  @param op        CeedOperator to apply
+  @param[in] in    CeedVector containing input state
+  @param[out] out  CeedVector to store result of applying operator (must be
+                     distinct from @a in and have the same length)
+  @param[out] result  Dot product of @a in and @a out
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyDot(CeedOperator op, CeedVector in, CeedVector out,
+                         CeedScalar *result) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+
+  if (in == CEED_VECTOR_NONE || out == CEED_VECTOR_NONE)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_INCOMPATIBLE,
+                     "CeedOperatorApplyDot requires active input and output "
+                     "vectors");
+  // LCOV_EXCL_STOP
+  if (in->length != out->length)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_DIMENSION,
+                     "Input length %d does not match output length %d",
+                     in->length, out->length);
+  // LCOV_EXCL_STOP
+
+  if (op->num_elem && op->ApplyDot) {
+    // Apply, overwriting the outputs, and accumulate dot product
+    ierr = op->ApplyDot(op, in, out, result); CeedChk(ierr);
+  } else {
+    // Fallback to apply followed by dot product
+    ierr = CeedOperatorApply(op, in, out, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+    ierr = CeedVectorDot(in, out, result); CeedChk(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Destroy a CeedOperator
 
@@ -1426,7 +1696,9 @@ int CeedOperatorDestroy(CeedOperator *op) {
 
   // Destroy fallback
   if ((*op)->op_fallback) {
-    ierr = (*op)->qf_fallback->Destroy((*op)->qf_fallback); CeedChk(ierr);
+    if ((*op)->qf_fallback->Destroy) {
+      ierr = (*op)->qf_fallback->Destroy((*op)->qf_fallback); CeedChk(ierr);
+    }
     ierr = CeedFree(&(*op)->qf_fallback); CeedChk(ierr);
     ierr = CeedVectorDestroy(&(*op)->op_fallback->qf_assembled); CeedChk(ierr);
     ierr = CeedElemRestrictionDestroy(&(*op)->op_fallback->qf_assembled_rstr);
@@ -82,6 +82,8 @@ int CeedOperatorCreateFallback(CeedOperator op) {
   ierr = CeedCalloc(1, &qf_ref); CeedChk(ierr);
   memcpy(qf_ref, (op->qf), sizeof(*qf_ref));
   qf_ref->data = NULL;
+  qf_ref->ctx_data = NULL;
+  qf_ref->num_ctx_users = 0;
   qf_ref->ceed = ceed_ref;
   ierr = ceed_ref->QFunctionCreate(qf_ref); CeedChk(ierr);
   op_ref->qf = qf_ref;
@@ -199,7 +201,7 @@ static inline int CeedSingleOperatorAssembleAddDiagonal(CeedOperator op,
   CeedVector assembled_qf;
   CeedElemRestriction rstr;
   ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op,  &assembled_qf,
-         &rstr, request); CeedChk(ierr);
+         &rstr, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
   CeedInt layout[3];
   ierr = CeedElemRestrictionGetELayout(rstr, &layout); CeedChk(ierr);
   ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
@@ -328,15 +330,17 @@ static inline int CeedSingleOperatorAssembleAddDiagonal(CeedOperator op,
     evalNone = evalNone || (eval_mode_in[i] == CEED_EVAL_NONE);
   for (CeedInt i=0; i<num_eval_mode_out; i++)
     evalNone = evalNone || (eval_mode_out[i] == CEED_EVAL_NONE);
-  if (evalNone) {
-    ierr = CeedCalloc(num_qpts*num_nodes, &identity); CeedChk(ierr);
-    for (CeedInt i=0; i<(num_nodes<num_qpts?num_nodes:num_qpts); i++)
-      identity[i*num_nodes+i] = 1.0;
-  }
   ierr = CeedBasisGetInterp(basis_in, &interp_in); CeedChk(ierr);
   ierr = CeedBasisGetInterp(basis_out, &interp_out); CeedChk(ierr);
   ierr = CeedBasisGetGrad(basis_in, &grad_in); CeedChk(ierr);
   ierr = CeedBasisGetGrad(basis_out, &grad_out); CeedChk(ierr);
+  // Nothing below may fail while the identity work array is held
+  if (evalNone) {
+    ierr = CeedGetWorkArray(ceed, num_qpts*num_nodes, &identity); CeedChk(ierr);
+    memset(identity, 0, num_qpts*num_nodes*sizeof(identity[0]));
+    for (CeedInt i=0; i<(num_nodes<num_qpts?num_nodes:num_qpts); i++)
+      identity[i*num_nodes+i] = 1.0;
+  }
   // Compute the diagonal of B^T D B
   // Each element
   const CeedScalar qf_value_bound = max_norm*100*CEED_EPSILON;
@@ -384,13 +388,17 @@ static inline int CeedSingleOperatorAssembleAddDiagonal(CeedOperator op,
       }
     }
   }
+  if (identity) {
+    ierr = CeedRestoreWorkArray(ceed, &identity); CeedChk(ierr);
+  }
   ierr = CeedVectorRestoreArray(elem_diag, &elem_diag_array); CeedChk(ierr);
   ierr = CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array);
   CeedChk(ierr);
 
   // Assemble local operator diagonal
   ierr = CeedElemRestrictionApply(diag_rstr, CEED_TRANSPOSE, elem_diag,
-                                  assembled, request); CeedChk(ierr);
+                                  assembled, CEED_REQUEST_IMMEDIATE);
+  CeedChk(ierr);
 
   // Cleanup
   if (is_pointblock) {
@@ -400,7 +408,6 @@ static inline int CeedSingleOperatorAssembleAddDiagonal(CeedOperator op,
   ierr = CeedVectorDestroy(&elem_diag); CeedChk(ierr);
   ierr = CeedFree(&eval_mode_in); CeedChk(ierr);
   ierr = CeedFree(&eval_mode_out); CeedChk(ierr);
-  ierr = CeedFree(&identity); CeedChk(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
@@ -537,7 +544,7 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset,
 **/
 static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
                                       CeedVector values) {
-  int ierr;
+  int ierr, ierr2;
   Ceed ceed = op->ceed;
   if (op->is_composite)
     // LCOV_EXCL_START
@@ -670,15 +677,24 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
   ierr = CeedElemRestrictionDestroy(&rstr_q); CeedChk(ierr);
 
   // we store B_mat_in, B_mat_out, BTD, elem_mat in row-major order
-  CeedScalar B_mat_in[(num_qpts * num_eval_mode_in) * elem_size];
-  CeedScalar B_mat_out[(num_qpts * num_eval_mode_out) * elem_size];
-  CeedScalar D_mat[num_eval_mode_out * num_eval_mode_in *
-                                     num_qpts]; // logically 3-tensor
-  CeedScalar BTD[elem_size * num_qpts*num_eval_mode_in];
-  CeedScalar elem_mat[elem_size * elem_size];
+  CeedScalar *B_mat_in = NULL, *B_mat_out = NULL, *D_mat = NULL, *BTD = NULL,
+             *elem_mat = NULL, *vals = NULL;
+  ierr = CeedGetWorkArray(ceed, (num_qpts * num_eval_mode_in) * elem_size,
+                          &B_mat_in);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, (num_qpts * num_eval_mode_out) * elem_size,
+                          &B_mat_out);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, num_eval_mode_out * num_eval_mode_in * num_qpts,
+                          &D_mat); // logically 3-tensor
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, elem_size * num_qpts*num_eval_mode_in, &BTD);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, elem_size * elem_size, &elem_mat);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   int count = 0;
-  CeedScalar *vals;
-  ierr = CeedVectorGetArrayWrite(values, CEED_MEM_HOST, &vals); CeedChk(ierr);
+  ierr = CeedVectorGetArrayWrite(values, CEED_MEM_HOST, &vals);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   for (int e = 0; e < num_elem; ++e) {
     for (int comp_in = 0; comp_in < num_comp; ++comp_in) {
       for (int comp_out = 0; comp_out < num_comp; ++comp_out) {
@@ -709,7 +725,9 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
                   grad_in[(d_in*num_qpts+q) * elem_size + n];
               } else {
                 // LCOV_EXCL_START
-                return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Not implemented!");
+                ierr = CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                                 "Not implemented!");
+                goto cleanup;
                 // LCOV_EXCL_STOP
               }
             }
@@ -724,7 +742,9 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
                   grad_in[(d_out*num_qpts+q) * elem_size + n];
               } else {
                 // LCOV_EXCL_START
-                return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Not implemented!");
+                ierr = CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                                 "Not implemented!");
+                goto cleanup;
                 // LCOV_EXCL_STOP
               }
             }
@@ -756,7 +776,8 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
         }
 
         ierr = CeedMatrixMultiply(ceed, BTD, B_mat_in, elem_mat, elem_size,
-                                  elem_size, num_qpts*num_eval_mode_in); CeedChk(ierr);
+                                  elem_size, num_qpts*num_eval_mode_in);
+        if (ierr) { goto cleanup; } CeedChk(ierr);
 
         // put element matrix in coordinate data structure
         for (int i = 0; i < elem_size; ++i) {
@@ -768,11 +789,24 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
       }
     }
   }
-  if (count != local_num_entries)
+  if (count != local_num_entries) {
     // LCOV_EXCL_START
-    return CeedError(ceed, CEED_ERROR_MAJOR, "Error computing entries");
-  // LCOV_EXCL_STOP
-  ierr = CeedVectorRestoreArray(values, &vals); CeedChk(ierr);
+    ierr = CeedError(ceed, CEED_ERROR_MAJOR, "Error computing entries");
+    goto cleanup;
+    // LCOV_EXCL_STOP
+  }
+
+cleanup:
+  // Restore in reverse order of getting, also on error
+  if (vals) {
+    ierr2 = CeedVectorRestoreArray(values, &vals); CeedChk(ierr2);
+  }
+  ierr2 = CeedRestoreWorkArray(ceed, &elem_mat); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &BTD); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &D_mat); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &B_mat_out); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &B_mat_in); CeedChk(ierr2);
+  CeedChk(ierr);
 
   ierr = CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array);
   CeedChk(ierr);
@@ -1831,7 +1865,7 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine,
 **/
 int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
                                         CeedRequest *request) {
-  int ierr;
+  int ierr, ierr2;
   ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
 
   // Use backend version, if available
@@ -1910,54 +1944,75 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
                      "FDMElementInverse only supported for tensor "
                      "bases");
   // LCOV_EXCL_STOP
-  CeedScalar *mass, *laplace, *x, *fdm_interp, *lambda;
-  ierr = CeedCalloc(P_1d*P_1d, &mass); CeedChk(ierr);
-  ierr = CeedCalloc(P_1d*P_1d, &laplace); CeedChk(ierr);
-  ierr = CeedCalloc(P_1d*P_1d, &x); CeedChk(ierr);
-  ierr = CeedCalloc(P_1d*P_1d, &fdm_interp); CeedChk(ierr);
-  ierr = CeedCalloc(P_1d, &lambda); CeedChk(ierr);
+  CeedScalar *mass = NULL, *laplace = NULL, *x = NULL, *fdm_interp = NULL,
+             *lambda = NULL, *elem_avg = NULL, *fdm_diagonal = NULL,
+             *grad_dummy = NULL, *q_ref_dummy = NULL, *q_weight_dummy = NULL;
+  ierr = CeedGetWorkArray(ceed, P_1d*P_1d, &fdm_interp);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, P_1d, &lambda);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, P_1d*P_1d, &mass);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, P_1d*P_1d, &laplace);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, P_1d*P_1d, &x);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   // -- Build matrices
   const CeedScalar *interp_1d, *grad_1d, *q_weight_1d;
-  ierr = CeedBasisGetInterp1D(basis, &interp_1d); CeedChk(ierr);
-  ierr = CeedBasisGetGrad1D(basis, &grad_1d); CeedChk(ierr);
-  ierr = CeedBasisGetQWeights(basis, &q_weight_1d); CeedChk(ierr);
+  ierr = CeedBasisGetInterp1D(basis, &interp_1d);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedBasisGetGrad1D(basis, &grad_1d);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedBasisGetQWeights(basis, &q_weight_1d);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   ierr = CeedBuildMassLaplace(interp_1d, grad_1d, q_weight_1d, P_1d, Q_1d, dim,
-                              mass, laplace); CeedChk(ierr);
+                              mass, laplace);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
 
   // -- Diagonalize
   ierr = CeedSimultaneousDiagonalization(ceed, laplace, mass, x, lambda, P_1d);
-  CeedChk(ierr);
-  ierr = CeedFree(&mass); CeedChk(ierr);
-  ierr = CeedFree(&laplace); CeedChk(ierr);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   for (CeedInt i=0; i<P_1d; i++)
     for (CeedInt j=0; j<P_1d; j++)
       fdm_interp[i+j*P_1d] = x[j+i*P_1d];
-  ierr = CeedFree(&x); CeedChk(ierr);
+  ierr = CeedRestoreWorkArray(ceed, &x);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedRestoreWorkArray(ceed, &laplace);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedRestoreWorkArray(ceed, &mass);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
 
   // Assemble QFunction
   CeedVector assembled;
   CeedElemRestriction rstr_qf;
   ierr =  CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled,
-          &rstr_qf, request); CeedChk(ierr);
+          &rstr_qf, CEED_REQUEST_IMMEDIATE);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   CeedInt layout[3];
-  ierr = CeedElemRestrictionGetELayout(rstr_qf, &layout); CeedChk(ierr);
-  ierr = CeedElemRestrictionDestroy(&rstr_qf); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetELayout(rstr_qf, &layout);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr_qf);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   CeedScalar max_norm = 0;
-  ierr = CeedVectorNorm(assembled, CEED_NORM_MAX, &max_norm); CeedChk(ierr);
+  ierr = CeedVectorNorm(assembled, CEED_NORM_MAX, &max_norm);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
 
   // Calculate element averages
   CeedInt num_modes = (interp?1:0) + (grad?dim:0);
-  CeedScalar *elem_avg;
   const CeedScalar *assembled_array, *q_weight_array;
   CeedVector q_weight;
-  ierr = CeedVectorCreate(ceed_parent, num_qpts, &q_weight); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed_parent, num_qpts, &q_weight);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
-                        CEED_VECTOR_NONE, q_weight); CeedChk(ierr);
+                        CEED_VECTOR_NONE, q_weight);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   ierr = CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
-  CeedChk(ierr);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   ierr = CeedVectorGetArrayRead(q_weight, CEED_MEM_HOST, &q_weight_array);
-  CeedChk(ierr);
-  ierr = CeedCalloc(num_elem, &elem_avg); CeedChk(ierr);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, num_elem, &elem_avg);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  memset(elem_avg, 0, num_elem*sizeof(elem_avg[0]));
   const CeedScalar qf_value_bound = max_norm*100*CEED_EPSILON;
   for (CeedInt e=0; e<num_elem; e++) {
     CeedInt count = 0;
@@ -1975,15 +2030,21 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
       elem_avg[e] = 1.0;
     }
   }
-  ierr = CeedVectorRestoreArrayRead(assembled, &assembled_array); CeedChk(ierr);
-  ierr = CeedVectorDestroy(&assembled); CeedChk(ierr);
-  ierr = CeedVectorRestoreArrayRead(q_weight, &q_weight_array); CeedChk(ierr);
-  ierr = CeedVectorDestroy(&q_weight); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(assembled, &assembled_array);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedVectorDestroy(&assembled);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(q_weight, &q_weight_array);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedVectorDestroy(&q_weight);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
 
   // Build FDM diagonal
   CeedVector q_data;
-  CeedScalar *q_data_array, *fdm_diagonal;
-  ierr = CeedCalloc(num_comp*elem_size, &fdm_diagonal); CeedChk(ierr);
+  CeedScalar *q_data_array;
+  ierr = CeedGetWorkArray(ceed, num_comp*elem_size, &fdm_diagonal);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  memset(fdm_diagonal, 0, num_comp*elem_size*sizeof(fdm_diagonal[0]));
   const CeedScalar fdm_diagonal_bound = elem_size*CEED_EPSILON;
   for (CeedInt c=0; c<num_comp; c++)
     for (CeedInt n=0; n<elem_size; n++) {
@@ -1998,34 +2059,53 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
         fdm_diagonal[c*elem_size + n] = fdm_diagonal_bound;
     }
   ierr = CeedVectorCreate(ceed_parent, num_elem*num_comp*elem_size, &q_data);
-  CeedChk(ierr);
-  ierr = CeedVectorSetValue(q_data, 0.0); CeedChk(ierr);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedVectorSetValue(q_data, 0.0);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   ierr = CeedVectorGetArrayWrite(q_data, CEED_MEM_HOST, &q_data_array);
-  CeedChk(ierr);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
   for (CeedInt e=0; e<num_elem; e++)
     for (CeedInt c=0; c<num_comp; c++)
       for (CeedInt n=0; n<elem_size; n++)
         q_data_array[(e*num_comp+c)*elem_size+n] = 1. / (elem_avg[e] *
             fdm_diagonal[c*elem_size + n]);
-  ierr = CeedFree(&elem_avg); CeedChk(ierr);
-  ierr = CeedFree(&fdm_diagonal); CeedChk(ierr);
-  ierr = CeedVectorRestoreArray(q_data, &q_data_array); CeedChk(ierr);
+  ierr = CeedRestoreWorkArray(ceed, &fdm_diagonal);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedRestoreWorkArray(ceed, &elem_avg);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(q_data, &q_data_array);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
 
   // Setup FDM operator
   // -- Basis
   CeedBasis fdm_basis;
-  CeedScalar *grad_dummy, *q_ref_dummy, *q_weight_dummy;
-  ierr = CeedCalloc(P_1d*P_1d, &grad_dummy); CeedChk(ierr);
-  ierr = CeedCalloc(P_1d, &q_ref_dummy); CeedChk(ierr);
-  ierr = CeedCalloc(P_1d, &q_weight_dummy); CeedChk(ierr);
+  ierr = CeedGetWorkArray(ceed, P_1d*P_1d, &grad_dummy);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  memset(grad_dummy, 0, P_1d*P_1d*sizeof(grad_dummy[0]));
+  ierr = CeedGetWorkArray(ceed, P_1d, &q_ref_dummy);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  memset(q_ref_dummy, 0, P_1d*sizeof(q_ref_dummy[0]));
+  ierr = CeedGetWorkArray(ceed, P_1d, &q_weight_dummy);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  memset(q_weight_dummy, 0, P_1d*sizeof(q_weight_dummy[0]));
   ierr = CeedBasisCreateTensorH1(ceed_parent, dim, num_comp, P_1d, P_1d,
                                  fdm_interp, grad_dummy, q_ref_dummy,
-                                 q_weight_dummy, &fdm_basis); CeedChk(ierr);
-  ierr = CeedFree(&fdm_interp); CeedChk(ierr);
-  ierr = CeedFree(&grad_dummy); CeedChk(ierr);
-  ierr = CeedFree(&q_ref_dummy); CeedChk(ierr);
-  ierr = CeedFree(&q_weight_dummy); CeedChk(ierr);
-  ierr = CeedFree(&lambda); CeedChk(ierr);
+                                 q_weight_dummy, &fdm_basis);
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+
+cleanup:
+  // Restore in reverse order of getting, also on error
+  ierr2 = CeedRestoreWorkArray(ceed, &q_weight_dummy); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &q_ref_dummy); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &grad_dummy); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &fdm_diagonal); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &elem_avg); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &x); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &laplace); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &mass); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &lambda); CeedChk(ierr2);
+  ierr2 = CeedRestoreWorkArray(ceed, &fdm_interp); CeedChk(ierr2);
+  CeedChk(ierr);
 
   // -- Restriction
   CeedElemRestriction rstr_qd_i;
@@ -19,6 +19,7 @@
 #include <ceed/jit-tools.h>
 #include <ceed-impl.h>
 #include <limits.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -56,6 +57,10 @@ static size_t num_qfunctions;
 /// @addtogroup CeedQFunctionDeveloper
 /// @{
 
+/// Lock for taking and releasing the context data access shared by
+///   concurrent applies of a CeedQFunction
+static pthread_mutex_t ceed_qf_ctx_lock = PTHREAD_MUTEX_INITIALIZER;
+
 /**
   @brief Register a gallery QFunction
 
@@ -304,6 +309,11 @@ int CeedQFunctionGetContext(CeedQFunction qf, CeedQFunctionContext *ctx) {
 /**
   @brief Get context data of a CeedQFunction
 
+  Concurrent applies of the CeedQFunction, as on the host threads of an
+    operator apply, share a single access to the context data, released by
+    the last matching CeedQFunctionRestoreContextData(); they must request
+    the same memory type.
+
   @param qf         CeedQFunction
   @param mem_type   Memory type on which to access the data. If the backend
                       uses a different memory type, this will perform a copy.
@@ -315,21 +325,41 @@ int CeedQFunctionGetContext(CeedQFunction qf, CeedQFunctionContext *ctx) {
 **/
 int CeedQFunctionGetContextData(CeedQFunction qf, CeedMemType mem_type,
                                 void *data) {
-  int ierr;
+  int ierr = CEED_ERROR_SUCCESS;
   bool is_writable;
   CeedQFunctionContext ctx;
 
   ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
-  if (ctx) {
-    ierr = CeedQFunctionIsContextWritable(qf, &is_writable); CeedChk(ierr);
-    if (is_writable) {
-      ierr = CeedQFunctionContextGetData(ctx, mem_type, data); CeedChk(ierr);
-    } else {
-      ierr = CeedQFunctionContextGetDataRead(ctx, mem_type, data); CeedChk(ierr);
-    }
-  } else {
+  if (!ctx) {
     *(void **)data = NULL;
+    return CEED_ERROR_SUCCESS;
   }
+
+  // Join an access already held
+  int num_users = __atomic_load_n(&qf->num_ctx_users, __ATOMIC_ACQUIRE);
+  while (num_users > 0)
+    if (__atomic_compare_exchange_n(&qf->num_ctx_users, &num_users,
+                                    num_users + 1, true, __ATOMIC_ACQUIRE,
+                                    __ATOMIC_ACQUIRE)) {
+      *(void **)data = qf->ctx_data;
+      return CEED_ERROR_SUCCESS;
+    }
+
+  // Take a new access otherwise
+  pthread_mutex_lock(&ceed_qf_ctx_lock);
+  if (!qf->num_ctx_users) {
+    ierr = CeedQFunctionIsContextWritable(qf, &is_writable);
+    if (!ierr && is_writable)
+      ierr = CeedQFunctionContextGetData(ctx, mem_type, &qf->ctx_data);
+    else if (!ierr)
+      ierr = CeedQFunctionContextGetDataRead(ctx, mem_type, &qf->ctx_data);
+  }
+  if (!ierr) {
+    *(void **)data = qf->ctx_data;
+    __atomic_add_fetch(&qf->num_ctx_users, 1, __ATOMIC_RELEASE);
+  }
+  pthread_mutex_unlock(&ceed_qf_ctx_lock);
+  CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -344,19 +374,33 @@ int CeedQFunctionGetContextData(CeedQFunction qf, CeedMemType mem_type,
   @ref Backend
 **/
 int CeedQFunctionRestoreContextData(CeedQFunction qf, void *data) {
-  int ierr;
+  int ierr = CEED_ERROR_SUCCESS;
   bool is_writable;
   CeedQFunctionContext ctx;
 
   ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
-  if (ctx) {
-    ierr = CeedQFunctionIsContextWritable(qf, &is_writable); CeedChk(ierr);
-    if (is_writable) {
-      ierr = CeedQFunctionContextRestoreData(ctx, data); CeedChk(ierr);
-    } else {
-      ierr = CeedQFunctionContextRestoreDataRead(ctx, data); CeedChk(ierr);
-    }
+  if (!ctx) return CEED_ERROR_SUCCESS;
+  *(void **)data = NULL;
+
+  // Leave a shared access
+  int num_users = __atomic_load_n(&qf->num_ctx_users, __ATOMIC_RELAXED);
+  while (num_users > 1)
+    if (__atomic_compare_exchange_n(&qf->num_ctx_users, &num_users,
+                                    num_users - 1, true, __ATOMIC_RELEASE,
+                                    __ATOMIC_RELAXED))
+      return CEED_ERROR_SUCCESS;
+
+  // The last user releases the access
+  pthread_mutex_lock(&ceed_qf_ctx_lock);
+  if (__atomic_sub_fetch(&qf->num_ctx_users, 1, __ATOMIC_ACQ_REL) == 0) {
+    ierr = CeedQFunctionIsContextWritable(qf, &is_writable);
+    if (!ierr && is_writable)
+      ierr = CeedQFunctionContextRestoreData(ctx, &qf->ctx_data);
+    else if (!ierr)
+      ierr = CeedQFunctionContextRestoreDataRead(ctx, &qf->ctx_data);
   }
+  pthread_mutex_unlock(&ceed_qf_ctx_lock);
+  CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -17,6 +17,7 @@
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
 #include <ceed-impl.h>
+#include <math.h>
 
 /// @file
 /// Implementation of CeedTensorContract interfaces
@@ -104,6 +105,120 @@ int CeedTensorContractApply(CeedTensorContract contract, CeedInt A, CeedInt B,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Fold a 1D basis matrix into its even and odd parts
+
+  For nodes and quadrature points symmetric about the element center, a
+    basis matrix t of shape [Q, P] satisfies
+    t[Q-1-q, P-1-p] = parity * t[q, p], with parity 1 for interpolation and
+    -1 for derivatives. Splitting u into u[p] + u[P-1-p] and u[p] - u[P-1-p]
+    then halves the work of each contraction. The folded matrix holds the
+    even part E of shape [ceil(Q/2), ceil(P/2)] followed by the odd part O of
+    shape [ceil(Q/2), floor(P/2)], row-major, with
+    E[q, p] = (t[q, p] + t[q, P-1-p])/2, O[q, p] = (t[q, p] - t[q, P-1-p])/2,
+    and E[q, (P-1)/2] = t[q, (P-1)/2] for odd P.
+
+  @param contract         CeedTensorContract that will apply the matrix
+  @param Q                Number of rows of t
+  @param P                Number of columns of t
+  @param[in] t            Row-major matrix to fold
+  @param parity           1 if t is centro-symmetric, -1 if centro-antisymmetric
+  @param[out] t_even_odd  Variable to store folded matrix, of size
+                            ceil(Q/2)*P, or NULL if t lacks the symmetry or the
+                            CeedTensorContract has no even-odd contraction;
+                            the caller frees it with CeedFree()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractFoldEvenOdd(CeedTensorContract contract, CeedInt Q,
+                                  CeedInt P, const CeedScalar *t,
+                                  CeedInt parity, CeedScalar **t_even_odd) {
+  int ierr;
+  const CeedInt Q_half = (Q+1)/2, P_even = (P+1)/2, P_odd = P/2;
+
+  *t_even_odd = NULL;
+  if (!contract->ApplyEvenOdd) return CEED_ERROR_SUCCESS;
+
+  // Check symmetry
+  CeedScalar t_max = 0.0;
+  for (CeedInt i=0; i<Q*P; i++)
+    t_max = fmax(t_max, fabs(t[i]));
+  for (CeedInt q=0; q<Q; q++)
+    for (CeedInt p=0; p<P; p++)
+      if (fabs(t[q*P+p] - parity*t[(Q-1-q)*P+P-1-p]) > 1E3*CEED_EPSILON*t_max)
+        return CEED_ERROR_SUCCESS;
+
+  // Fold, averaging symmetric entries
+  ierr = CeedCalloc(Q_half*P, t_even_odd); CeedChk(ierr);
+  CeedScalar *t_even = *t_even_odd, *t_odd = *t_even_odd + Q_half*P_even;
+  for (CeedInt q=0; q<Q_half; q++) {
+    const CeedScalar *t_q = &t[q*P], *t_r = &t[(Q-1-q)*P];
+    for (CeedInt p=0; p<P_odd; p++) {
+      const CeedScalar t_l = (t_q[p] + parity*t_r[P-1-p])/2,
+                       t_m = (t_q[P-1-p] + parity*t_r[p])/2;
+      t_even[q*P_even+p] = (t_l + t_m)/2;
+      t_odd[q*P_odd+p] = (t_l - t_m)/2;
+    }
+    if (P % 2)
+      t_even[q*P_even+P_odd] = (t_q[P_odd] + parity*t_r[P_odd])/2;
+  }
+  // The middle row of an odd Q has no odd part for interpolation and no even
+  //   part for derivatives
+  if (Q % 2) {
+    if (parity > 0)
+      for (CeedInt p=0; p<P_odd; p++) t_odd[(Q_half-1)*P_odd+p] = 0.0;
+    else
+      for (CeedInt p=0; p<P_even; p++) t_even[(Q_half-1)*P_even+p] = 0.0;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply tensor contraction with a folded 1D basis matrix
+
+    Computes the same result as CeedTensorContractApply() with t, using
+    t_even_odd folded from t by CeedTensorContractFoldEvenOdd(). Backends may
+    contract with t for shapes where folding does not pay off.
+
+  @param contract         CeedTensorContract to use
+  @param A                First index of u, v
+  @param B                Middle index of u
+  @param C                Last index of u, v
+  @param J                Middle index of v
+  @param[in] t            Tensor array to contract against
+  @param[in] t_even_odd   Folded t
+  @param parity           Parity t_even_odd was folded with
+  @param t_mode           Transpose mode for t
+  @param add              Add mode
+  @param[in] u            Input array
+  @param[out] v           Output array
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractApplyEvenOdd(CeedTensorContract contract, CeedInt A,
+                                   CeedInt B, CeedInt C, CeedInt J,
+                                   const CeedScalar *restrict t,
+                                   const CeedScalar *restrict t_even_odd,
+                                   CeedInt parity, CeedTransposeMode t_mode,
+                                   const CeedInt add,
+                                   const CeedScalar *restrict u,
+                                   CeedScalar *restrict v) {
+  int ierr;
+
+  if (!contract->ApplyEvenOdd)
+    // LCOV_EXCL_START
+    return CeedError(contract->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Backend does not support even-odd TensorContractApply");
+  // LCOV_EXCL_STOP
+  ierr = contract->ApplyEvenOdd(contract, A, B, C, J, t, t_even_odd, parity,
+                                t_mode, add, u, v); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get Ceed associated with a CeedTensorContract
 
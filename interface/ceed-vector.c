@@ -42,6 +42,67 @@ const CeedVector CEED_VECTOR_NONE = &ceed_vector_none;
 
 /// @}
 
+/// ----------------------------------------------------------------------------
+/// CeedVector Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedVectorDeveloper
+/// @{
+
+/**
+  @brief Check that two CeedVectors can be combined in a vector operation
+
+  @param x  First CeedVector
+  @param y  Second CeedVector
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorCheckCompatible(CeedVector x, CeedVector y) {
+  int ierr;
+
+  if (x->length != y->length)
+    // LCOV_EXCL_START
+    return CeedError(x->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Cannot combine vectors of different lengths");
+  // LCOV_EXCL_STOP
+
+  Ceed ceed_parent_x, ceed_parent_y;
+  ierr = CeedGetParent(x->ceed, &ceed_parent_x); CeedChk(ierr);
+  ierr = CeedGetParent(y->ceed, &ceed_parent_y); CeedChk(ierr);
+  if (ceed_parent_x != ceed_parent_y)
+    // LCOV_EXCL_START
+    return CeedError(x->ceed, CEED_ERROR_INCOMPATIBLE,
+                     "Vectors must be created by the same Ceed context");
+  // LCOV_EXCL_STOP
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check that a CeedVector read by a vector operation has valid data
+
+  @param vec  CeedVector to check
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorCheckValidArray(CeedVector vec) {
+  int ierr;
+  bool has_valid_array = true;
+
+  ierr = CeedVectorHasValidArray(vec, &has_valid_array); CeedChk(ierr);
+  if (!has_valid_array)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, CEED_ERROR_BACKEND,
+                     "CeedVector has no valid data, "
+                     "must set data with CeedVectorSetValue or CeedVectorSetArray");
+  // LCOV_EXCL_STOP
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
 /// ----------------------------------------------------------------------------
 /// CeedVector Backend API
 /// ----------------------------------------------------------------------------
@@ -671,6 +732,80 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute the dot product of two CeedVectors
+
+  Note: This operation is local to the CeedVector, as for CeedVectorNorm().
+
+  @param x             First CeedVector
+  @param y             Second CeedVector, may be the same as @a x
+  @param[out] result   Variable to store x . y
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result) {
+  int ierr;
+
+  ierr = CeedVectorCheckCompatible(x, y); CeedChk(ierr);
+  ierr = CeedVectorCheckValidArray(x); CeedChk(ierr);
+  ierr = CeedVectorCheckValidArray(y); CeedChk(ierr);
+
+  // Backend implementation
+  if (x->Dot) {
+    ierr = x->Dot(x, y, result); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  const CeedScalar *x_array, *y_array;
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array); CeedChk(ierr);
+  *result = 0.;
+  for (CeedInt i=0; i<x->length; i++)
+    *result += x_array[i]*y_array[i];
+  ierr = CeedVectorRestoreArrayRead(y, &y_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the dot products of a CeedVector with several CeedVectors in
+           one pass over the data
+
+  @param x             CeedVector
+  @param num_vecs      Number of CeedVectors in @a y
+  @param y             Array of CeedVectors, any of which may be @a x
+  @param[out] results  Array of length @a num_vecs to store x . y[i]
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorMDot(CeedVector x, CeedInt num_vecs, CeedVector *y,
+                   CeedScalar *results) {
+  int ierr;
+
+  ierr = CeedVectorCheckValidArray(x); CeedChk(ierr);
+  for (CeedInt j=0; j<num_vecs; j++) {
+    ierr = CeedVectorCheckCompatible(x, y[j]); CeedChk(ierr);
+    ierr = CeedVectorCheckValidArray(y[j]); CeedChk(ierr);
+  }
+
+  // Backend implementation
+  if (x->MDot) {
+    ierr = x->MDot(x, num_vecs, y, results); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  for (CeedInt j=0; j<num_vecs; j++) {
+    ierr = CeedVectorDot(x, y[j], &results[j]); CeedChk(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Compute x = alpha x
 
@@ -786,6 +921,120 @@ int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute y = alpha x + beta y
+
+  @param[in,out] y  target vector for sum
+  @param[in] alpha  first scaling factor
+  @param[in] beta   second scaling factor
+  @param[in] x      second vector, must be different than y
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta,
+                    CeedVector x) {
+  int ierr;
+
+  if (x == y)
+    // LCOV_EXCL_START
+    return CeedError(y->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Cannot use same vector for x and y in CeedVectorAXPBY");
+  // LCOV_EXCL_STOP
+  ierr = CeedVectorCheckCompatible(y, x); CeedChk(ierr);
+  ierr = CeedVectorCheckValidArray(x); CeedChk(ierr);
+  ierr = CeedVectorCheckValidArray(y); CeedChk(ierr);
+
+  // Backend implementation
+  if (y->AXPBY) {
+    ierr = y->AXPBY(y, alpha, beta, x); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  CeedScalar *y_array;
+  const CeedScalar *x_array;
+  ierr = CeedVectorGetArray(y, CEED_MEM_HOST, &y_array); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array); CeedChk(ierr);
+  for (CeedInt i=0; i<y->length; i++)
+    y_array[i] = alpha*x_array[i] + beta*y_array[i];
+  ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(y, &y_array); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the linear combination w = sum_i alpha[i] x[i] in one pass
+           over the data
+
+  @param[out] w     target vector, may be one of the vectors in @a x
+  @param num_vecs   Number of CeedVectors in @a x
+  @param[in] alpha  Array of @a num_vecs scaling factors
+  @param[in] x      Array of @a num_vecs CeedVectors
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorLinearCombination(CeedVector w, CeedInt num_vecs,
+                                const CeedScalar *alpha, CeedVector *x) {
+  int ierr;
+  bool w_in_x = false;
+
+  for (CeedInt j=0; j<num_vecs; j++) {
+    ierr = CeedVectorCheckCompatible(w, x[j]); CeedChk(ierr);
+    ierr = CeedVectorCheckValidArray(x[j]); CeedChk(ierr);
+    w_in_x = w_in_x || x[j] == w;
+  }
+
+  // Backend implementation
+  if (w->LinearCombination) {
+    ierr = w->LinearCombination(w, num_vecs, alpha, x); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  int ierr2;
+  CeedScalar *w_array = NULL, **x_arrays;
+  ierr = CeedCalloc(num_vecs, &x_arrays); CeedChk(ierr);
+  if (w_in_x) {
+    ierr = CeedVectorGetArray(w, CEED_MEM_HOST, &w_array);
+  } else {
+    ierr = CeedVectorGetArrayWrite(w, CEED_MEM_HOST, &w_array);
+  }
+  if (ierr) { goto cleanup; } CeedChk(ierr);
+  for (CeedInt j=0; j<num_vecs; j++) {
+    if (x[j] == w) {
+      x_arrays[j] = w_array;
+    } else {
+      ierr = CeedVectorGetArrayRead(x[j], CEED_MEM_HOST,
+                                    (const CeedScalar **)&x_arrays[j]);
+      if (ierr) { goto cleanup; } CeedChk(ierr);
+    }
+  }
+  for (CeedInt i=0; i<w->length; i++) {
+    CeedScalar sum = 0.;
+    for (CeedInt j=0; j<num_vecs; j++)
+      sum += alpha[j]*x_arrays[j][i];
+    w_array[i] = sum;
+  }
+cleanup:
+  for (CeedInt j=0; j<num_vecs; j++) {
+    if (x_arrays[j] && x[j] != w) {
+      ierr2 = CeedVectorRestoreArrayRead(x[j],
+                                         (const CeedScalar **)&x_arrays[j]);
+      CeedChk(ierr2);
+    }
+  }
+  if (w_array) {
+    ierr2 = CeedVectorRestoreArray(w, &w_array); CeedChk(ierr2);
+  }
+  ierr2 = CeedFree(&x_arrays); CeedChk(ierr2);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Compute the pointwise multiplication w = x .* y. Any
            subset of x, y, and w may be the same vector.
@@ -14,11 +14,17 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
-#define _POSIX_C_SOURCE 200112
+#ifdef __linux__
+#  define _GNU_SOURCE // pthread_attr_setaffinity_np
+#else
+#  define _POSIX_C_SOURCE 200112
+#endif
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
 #include <ceed-impl.h>
 #include <limits.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdio.h>
@@ -38,6 +44,85 @@ static size_t num_backends;
 
 #define CEED_FTABLE_ENTRY(class, method) \
   {#class #method, offsetof(struct class ##_private, method)}
+
+// Host worker threads for CeedParallelFor
+typedef struct CeedThreadPool_private *CeedThreadPool;
+
+typedef struct {
+  CeedThreadPool pool;
+  CeedInt id;
+} CeedThreadWorker;
+
+struct CeedThreadPool_private {
+  CeedInt num_threads;
+  bool is_static;
+  pthread_t *threads;
+  CeedThreadWorker *workers;
+  pthread_mutex_t lock, run_lock;
+  pthread_cond_t work_cond, done_cond;
+  uint64_t job;
+  CeedInt num_busy;
+  bool shutdown;
+  CeedParallelTask task;
+  void *ctx;
+  CeedInt num_tasks, next_task;
+  int ierr;
+#ifdef __linux__
+  bool is_caller_bound;
+  pthread_t caller;
+  cpu_set_t caller_cpus;
+#endif
+};
+
+// Background thread running asynchronous requests in submission order
+typedef struct CeedRequestQueue_private *CeedRequestQueue;
+
+struct CeedRequest_private {
+  CeedRequestQueue queue;
+  CeedRequestTask run, finalize;
+  void *ctx;
+  int ierr;
+  bool is_done;
+  CeedRequest next;
+};
+
+struct CeedRequestQueue_private {
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t work_cond, done_cond;
+  CeedRequest head, tail;
+  bool shutdown;
+};
+
+// Scratch arena of one host thread, arrays are handed out and restored in
+//   stack order; arrays that do not fit are allocated separately and the
+//   buffer grows to the high water mark once all arrays are restored
+typedef struct CeedWorkArena_private *CeedWorkArena;
+
+typedef struct {
+  CeedScalar *array;
+  size_t bytes;
+  bool is_owned;
+} CeedWorkArray;
+
+struct CeedWorkArena_private {
+  char *buffer;
+  size_t size, used, in_use, peak;
+  CeedWorkArray *arrays;
+  CeedInt num_arrays, max_arrays;
+};
+
+// Guards lazy creation of host threads shared by a Ceed context
+static pthread_mutex_t ceed_thread_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Index of the calling host thread and whether it is executing tasks
+static __thread CeedInt ceed_thread_id = 0;
+static __thread bool ceed_thread_is_active = false;
+// Whether the calling host thread is running an asynchronous request
+static __thread bool ceed_thread_is_request = false;
+// Thread pool or request queue the calling host thread works for, if any
+static __thread CeedThreadPool ceed_thread_pool = NULL;
+static __thread CeedRequestQueue ceed_thread_queue = NULL;
 /// @endcond
 
 /// @file
@@ -98,19 +183,36 @@ CeedRequest *const CEED_REQUEST_ORDERED = &ceed_request_ordered;
 /**
   @brief Wait for a CeedRequest to complete.
 
-  Calling CeedRequestWait on a NULL request is a no-op.
+  Calling CeedRequestWait on a NULL request is a no-op. Objects passed to the
+    call that returned the request must not be used until it completes.
 
   @param req Address of CeedRequest to wait for; zeroed on completion.
 
-  @return An error code: 0 - success, otherwise - failure
+  @return An error code: 0 - success, otherwise - the error code returned by
+            the requested operation
 
   @ref User
 **/
 int CeedRequestWait(CeedRequest *req) {
+  int ierr;
+
   if (!*req)
     return CEED_ERROR_SUCCESS;
-  return CeedError(NULL, CEED_ERROR_UNSUPPORTED,
-                   "CeedRequestWait not implemented");
+
+  // Wait for background thread
+  CeedRequestQueue queue = (*req)->queue;
+  pthread_mutex_lock(&queue->lock);
+  while (!(*req)->is_done)
+    pthread_cond_wait(&queue->done_cond, &queue->lock);
+  pthread_mutex_unlock(&queue->lock);
+
+  // Finalize on the waiting thread
+  int req_ierr = (*req)->ierr;
+  if ((*req)->finalize) {
+    ierr = (*req)->finalize((*req)->ctx); CeedChk(ierr);
+  }
+  ierr = CeedFree(req); CeedChk(ierr);
+  return req_ierr;
 }
 
 /// @}
@@ -121,6 +223,395 @@ int CeedRequestWait(CeedRequest *req) {
 /// @addtogroup CeedDeveloper
 /// @{
 
+/**
+  @brief Get the Ceed context that owns host threading resources
+
+  Delegate and fallback Ceed contexts share the thread count and worker
+    threads of the Ceed context created by the user.
+
+  @param ceed       Ceed context
+  @param[out] root  Variable to store the owning Ceed context
+
+  @ref Developer
+**/
+static void CeedGetThreadRoot(Ceed ceed, Ceed *root) {
+  while (ceed->parent || ceed->op_fallback_parent)
+    ceed = ceed->parent ? ceed->parent : ceed->op_fallback_parent;
+  *root = ceed;
+}
+
+/**
+  @brief Run tasks from the current CeedParallelFor job until none remain
+
+  @param pool    Thread pool holding the job
+  @param thread  Index of the calling thread
+
+  @ref Developer
+**/
+static void CeedThreadPoolRunTasks(CeedThreadPool pool, CeedInt thread) {
+  // Fixed contiguous share, so a task index runs on the same thread every job
+  if (pool->is_static) {
+    const CeedInt first = ((int64_t)pool->num_tasks*thread) / pool->num_threads,
+                  last = ((int64_t)pool->num_tasks*(thread+1)) / pool->num_threads;
+    for (CeedInt i=first; i<last; i++) {
+      int ierr = pool->task(pool->ctx, i, thread);
+      if (ierr)
+        __sync_bool_compare_and_swap(&pool->ierr, 0, ierr);
+    }
+    return;
+  }
+
+  for (CeedInt i = __sync_fetch_and_add(&pool->next_task, 1);
+       i < pool->num_tasks; i = __sync_fetch_and_add(&pool->next_task, 1)) {
+    int ierr = pool->task(pool->ctx, i, thread);
+    if (ierr)
+      __sync_bool_compare_and_swap(&pool->ierr, 0, ierr);
+  }
+}
+
+/**
+  @brief Main loop of a host worker thread
+
+  @param arg  CeedThreadWorker for this thread
+
+  @ref Developer
+**/
+static void *CeedThreadPoolWorkerLoop(void *arg) {
+  CeedThreadWorker *worker = arg;
+  CeedThreadPool pool = worker->pool;
+  uint64_t job = 0;
+
+  ceed_thread_id = worker->id;
+  ceed_thread_is_active = true;
+  ceed_thread_pool = pool;
+  pthread_mutex_lock(&pool->lock);
+  while (true) {
+    while (!pool->shutdown && pool->job == job)
+      pthread_cond_wait(&pool->work_cond, &pool->lock);
+    if (pool->shutdown) break;
+    job = pool->job;
+    pthread_mutex_unlock(&pool->lock);
+
+    CeedThreadPoolRunTasks(pool, worker->id);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->num_busy == 0)
+      pthread_cond_signal(&pool->done_cond);
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+
+#ifdef __linux__
+/**
+  @brief Get the CPU a NUMA aware host thread is bound to
+
+  @param cpus         Affinity mask of the thread creating the workers
+  @param thread       Index of the host thread
+  @param num_threads  Number of host threads
+  @param[out] cpu     Variable to store the mask holding the single CPU
+
+  @ref Developer
+**/
+static void CeedThreadPoolGetCpu(const cpu_set_t *cpus, CeedInt thread,
+                                 CeedInt num_threads, cpu_set_t *cpu) {
+  const CeedInt target = (thread*CPU_COUNT(cpus)) / num_threads;
+
+  CPU_ZERO(cpu);
+  for (CeedInt c=0, k=0; c<CPU_SETSIZE; c++)
+    if (CPU_ISSET(c, cpus) && k++ == target) {
+      CPU_SET(c, cpu);
+      break;
+    }
+}
+#endif
+
+/**
+  @brief Start host worker threads for a Ceed context
+
+  @param ceed  Ceed context owning the worker threads
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedThreadPoolCreate(Ceed ceed) {
+  int ierr;
+  CeedThreadPool pool;
+
+  ierr = CeedCalloc(1, &pool); CeedChk(ierr);
+  pool->num_threads = ceed->num_threads;
+  pool->is_static = ceed->is_numa_aware;
+  ierr = CeedCalloc(pool->num_threads, &pool->threads); CeedChk(ierr);
+  ierr = CeedCalloc(pool->num_threads, &pool->workers); CeedChk(ierr);
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_mutex_init(&pool->run_lock, NULL);
+  pthread_cond_init(&pool->work_cond, NULL);
+  pthread_cond_init(&pool->done_cond, NULL);
+  ceed->thread_pool = pool;
+
+  // NUMA aware threads are bound to CPUs spread evenly over the affinity mask
+  //   of the calling thread, so pages stay near the threads that touch them
+  CeedInt num_cpus = 0;
+#ifdef __linux__
+  cpu_set_t *cpus = &pool->caller_cpus, cpu;
+  pool->caller = pthread_self();
+  if (ceed->is_numa_aware &&
+      !pthread_getaffinity_np(pool->caller, sizeof(*cpus), cpus))
+    num_cpus = CPU_COUNT(cpus);
+  if (num_cpus > 1) {
+    // Thread 0 is the calling thread, which works alongside the workers;
+    //   its own mask is restored when the pool is destroyed
+    CeedThreadPoolGetCpu(cpus, 0, pool->num_threads, &cpu);
+    pool->is_caller_bound =
+      !pthread_setaffinity_np(pool->caller, sizeof(cpu), &cpu);
+  }
+#endif
+
+  for (CeedInt i=1; i<pool->num_threads; i++) {
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+#ifdef __linux__
+    if (num_cpus > 1) {
+      CeedThreadPoolGetCpu(cpus, i, pool->num_threads, &cpu);
+      pthread_attr_setaffinity_np(&attr, sizeof(cpu), &cpu);
+    }
+#endif
+    pool->workers[i].pool = pool;
+    pool->workers[i].id = i;
+    int err = pthread_create(&pool->threads[i], &attr, CeedThreadPoolWorkerLoop,
+                             &pool->workers[i]);
+    pthread_attr_destroy(&attr);
+    if (err)
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_MAJOR,
+                       "Unable to create host thread %d", i);
+    // LCOV_EXCL_STOP
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Stop and join host worker threads of a Ceed context, if any
+
+  @param ceed  Ceed context owning the worker threads
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedThreadPoolDestroy(Ceed ceed) {
+  int ierr;
+  CeedThreadPool pool = ceed->thread_pool;
+
+  if (!pool) return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&pool->lock);
+  pool->shutdown = true;
+  pthread_cond_broadcast(&pool->work_cond);
+  pthread_mutex_unlock(&pool->lock);
+  for (CeedInt i=1; i<pool->num_threads; i++)
+    pthread_join(pool->threads[i], NULL);
+#ifdef __linux__
+  // Hand the calling thread back its own affinity mask; another thread may
+  //   not touch it, as the caller may have exited since
+  if (pool->is_caller_bound && pthread_equal(pool->caller, pthread_self()))
+    pthread_setaffinity_np(pool->caller, sizeof(pool->caller_cpus),
+                           &pool->caller_cpus);
+#endif
+  pthread_cond_destroy(&pool->done_cond);
+  pthread_cond_destroy(&pool->work_cond);
+  pthread_mutex_destroy(&pool->run_lock);
+  pthread_mutex_destroy(&pool->lock);
+  ierr = CeedFree(&pool->workers); CeedChk(ierr);
+  ierr = CeedFree(&pool->threads); CeedChk(ierr);
+  ierr = CeedFree(&ceed->thread_pool); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create scratch arenas for the host threads of a Ceed context, one
+           per thread plus one for the asynchronous request thread
+
+  Arenas are created on first use, under ceed_thread_lock, and published
+    last so threads reading ceed->work_arenas without the lock see them
+    complete.
+
+  @param ceed  Thread root Ceed context owning the arenas
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedWorkArenasCreate(Ceed ceed) {
+  int ierr;
+  CeedWorkArena arenas;
+
+  ierr = CeedCalloc(ceed->num_threads + 1, &arenas); CeedChk(ierr);
+  ceed->num_work_arenas = ceed->num_threads + 1;
+  __atomic_store_n(&ceed->work_arenas, arenas, __ATOMIC_RELEASE);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Free scratch arenas of a Ceed context
+
+  @param ceed  Ceed context owning the arenas
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedWorkArenasDestroy(Ceed ceed) {
+  int ierr;
+
+  for (CeedInt i=0; i<ceed->num_work_arenas; i++) {
+    CeedWorkArena arena = &ceed->work_arenas[i];
+
+    if (arena->num_arrays > 0)
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_ACCESS,
+                       "Cannot free work arrays, %d not restored",
+                       arena->num_arrays);
+    // LCOV_EXCL_STOP
+    ierr = CeedFree(&arena->buffer); CeedChk(ierr);
+    ierr = CeedFree(&arena->arrays); CeedChk(ierr);
+  }
+  ierr = CeedFree(&ceed->work_arenas); CeedChk(ierr);
+  ceed->num_work_arenas = 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the scratch arena of the calling host thread
+
+  The thread that created the Ceed context uses arena 0, worker threads of
+    its pool use their own arena, and its request thread uses the last one.
+    Any other thread gets no arena and allocates work arrays directly.
+
+  @param root        Thread root Ceed context
+  @param[out] arena  Variable to store arena, NULL if the calling thread has
+                       no arena in this Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedGetWorkArena(Ceed root, CeedWorkArena *arena) {
+  int ierr = CEED_ERROR_SUCCESS;
+  CeedInt index = -1;
+
+  *arena = NULL;
+  if (ceed_thread_queue) {
+    if (ceed_thread_queue == root->request_queue) index = root->num_threads;
+  } else if (ceed_thread_pool) {
+    if (ceed_thread_pool == root->thread_pool &&
+        ceed_thread_id < root->num_threads)
+      index = ceed_thread_id;
+  } else if (root->work_owner == &ceed_thread_id) {
+    index = 0;
+  }
+  if (index < 0) return CEED_ERROR_SUCCESS;
+
+  // Create arenas on first use
+  CeedWorkArena arenas = __atomic_load_n(&root->work_arenas, __ATOMIC_ACQUIRE);
+  if (!arenas) {
+    pthread_mutex_lock(&ceed_thread_lock);
+    if (!root->work_arenas) ierr = CeedWorkArenasCreate(root);
+    pthread_mutex_unlock(&ceed_thread_lock);
+    CeedChk(ierr);
+    arenas = root->work_arenas;
+  }
+  *arena = &arenas[index];
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Main loop of the background thread for asynchronous requests
+
+  @param arg  CeedRequestQueue to run
+
+  @ref Developer
+**/
+static void *CeedRequestQueueLoop(void *arg) {
+  CeedRequestQueue queue = arg;
+
+  ceed_thread_is_request = true;
+  ceed_thread_queue = queue;
+  pthread_mutex_lock(&queue->lock);
+  while (true) {
+    while (!queue->shutdown && !queue->head)
+      pthread_cond_wait(&queue->work_cond, &queue->lock);
+    if (!queue->head) break;
+    CeedRequest req = queue->head;
+    pthread_mutex_unlock(&queue->lock);
+
+    int ierr = req->run(req->ctx);
+
+    pthread_mutex_lock(&queue->lock);
+    req->ierr = ierr;
+    req->is_done = true;
+    queue->head = req->next;
+    if (!queue->head) queue->tail = NULL;
+    pthread_cond_broadcast(&queue->done_cond);
+  }
+  pthread_mutex_unlock(&queue->lock);
+  return NULL;
+}
+
+/**
+  @brief Start the background thread for asynchronous requests of a Ceed
+           context
+
+  @param ceed  Ceed context owning the background thread
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedRequestQueueCreate(Ceed ceed) {
+  int ierr;
+  CeedRequestQueue queue;
+
+  ierr = CeedCalloc(1, &queue); CeedChk(ierr);
+  pthread_mutex_init(&queue->lock, NULL);
+  pthread_cond_init(&queue->work_cond, NULL);
+  pthread_cond_init(&queue->done_cond, NULL);
+  if (pthread_create(&queue->thread, NULL, CeedRequestQueueLoop, queue))
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_MAJOR,
+                     "Unable to create background thread for requests");
+  // LCOV_EXCL_STOP
+  ceed->request_queue = queue;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Finish pending requests and join the background thread of a Ceed
+           context, if any
+
+  @param ceed  Ceed context owning the background thread
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedRequestQueueDestroy(Ceed ceed) {
+  int ierr;
+  CeedRequestQueue queue = ceed->request_queue;
+
+  if (!queue) return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&queue->lock);
+  queue->shutdown = true;
+  pthread_cond_signal(&queue->work_cond);
+  pthread_mutex_unlock(&queue->lock);
+  pthread_join(queue->thread, NULL);
+  pthread_cond_destroy(&queue->done_cond);
+  pthread_cond_destroy(&queue->work_cond);
+  pthread_mutex_destroy(&queue->lock);
+  ierr = CeedFree(&ceed->request_queue); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Register a Ceed backend internally.
            Note: Backends should call `CeedRegister` instead.
@@ -558,6 +1049,27 @@ int CeedSetDeterministic(Ceed ceed, bool is_deterministic) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Flag Ceed context as supporting asynchronous requests
+
+  Interfaces taking a CeedRequest run on the background thread of the Ceed
+    context when given a request other than @ref CEED_REQUEST_IMMEDIATE or
+    @ref CEED_REQUEST_ORDERED. Only backends whose objects may be used from
+    any host thread should set this flag.
+
+  @param ceed                Ceed to flag
+  @param has_async_requests  Asynchronous request support to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedSetAsyncRequests(Ceed ceed, bool has_async_requests) {
+  ceed->has_async_requests = has_async_requests;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Set a backend function
 
@@ -649,6 +1161,365 @@ int CeedReference(Ceed ceed) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the root of a resource, without query arguments
+
+  For example, the root of "/cpu/self/opt/blocked:threads=4" with delineator
+    ":" is "/cpu/self/opt/blocked". The caller is responsible for freeing the
+    root with CeedFree().
+
+  @param ceed                Ceed context for error handling
+  @param resource            Full resource name
+  @param delineator          Delineator marking the start of query arguments
+  @param[out] resource_root  Variable to store resource root
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetResourceRoot(Ceed ceed, const char *resource,
+                        const char *delineator, char **resource_root) {
+  int ierr;
+  const char *query = strstr(resource, delineator);
+  size_t root_len = query ? (size_t)(query - resource) : strlen(resource);
+
+  ierr = CeedCalloc(root_len + 1, resource_root); CeedChk(ierr);
+  memcpy(*resource_root, resource, root_len);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the number of host threads CPU backends may use
+
+  The thread count is set by the resource query argument ":threads=N" or,
+    if absent, the environment variable CEED_NUM_THREADS. It is shared by a
+    Ceed context and its delegates. Calls from inside a running task of
+    CeedParallelFor() get 1, as nested CeedParallelFor() calls run serially,
+    so backends take their serial paths there.
+
+  @param ceed              Ceed context
+  @param[out] num_threads  Variable to store number of threads
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetNumThreads(Ceed ceed, CeedInt *num_threads) {
+  Ceed root;
+  CeedGetThreadRoot(ceed, &root);
+  *num_threads = ceed_thread_is_active ? 1 : root->num_threads;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the number of host threads CPU backends may use
+
+  Running worker threads are stopped and restarted with the new count on the
+    next call to CeedParallelFor().
+
+  @param ceed         Ceed context
+  @param num_threads  Number of threads, including the calling thread
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedSetNumThreads(Ceed ceed, CeedInt num_threads) {
+  int ierr;
+  Ceed root;
+
+  if (num_threads < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_INCOMPATIBLE,
+                     "Number of threads must be positive, not %d",
+                     num_threads);
+  // LCOV_EXCL_STOP
+  CeedGetThreadRoot(ceed, &root);
+  if (root->num_threads != num_threads) {
+    ierr = CeedThreadPoolDestroy(root); CeedChk(ierr);
+    ierr = CeedWorkArenasDestroy(root); CeedChk(ierr);
+    root->num_threads = num_threads;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get NUMA aware status of the host threads CPU backends may use
+
+  NUMA aware mode is set by the resource query argument ":numa=1" or, if
+    absent, the environment variable CEED_NUMA. Host threads, including the
+    calling thread that starts the workers, are then bound to CPUs spread over
+    its affinity mask, CeedParallelFor() runs fixed task shares on each
+    thread, and CPU backends first touch new arrays with the host threads that
+    later work on them. CeedDestroy(), called on the thread that started the
+    workers, restores the affinity mask of that thread.
+
+  @param ceed                Ceed context
+  @param[out] is_numa_aware  Variable to store NUMA aware status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedIsNumaAware(Ceed ceed, bool *is_numa_aware) {
+  Ceed root;
+  CeedGetThreadRoot(ceed, &root);
+  *is_numa_aware = root->is_numa_aware;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Run tasks on the host threads of a Ceed context
+
+  Calls task(ctx, i, thread) once for each i in [0, num_tasks). Tasks are
+    handed out dynamically, so the host thread running a given task is not
+    fixed; per-task scratch should be indexed by task. If the Ceed context is
+    NUMA aware, see CeedIsNumaAware(), each thread instead runs a fixed
+    contiguous share of the tasks, so memory first touched by task i is local
+    to the thread running task i in later calls with the same num_tasks. The
+    calling thread
+    participates as thread 0. Calls from inside a running task, or with a
+    single thread, run all tasks in order on the calling thread.
+
+  @param ceed       Ceed context
+  @param num_tasks  Number of tasks
+  @param task       Function to run for each task
+  @param ctx        User context passed to task
+
+  @return An error code: 0 - success, otherwise - the first error returned
+            by a task
+
+  @ref Backend
+**/
+int CeedParallelFor(Ceed ceed, CeedInt num_tasks, CeedParallelTask task,
+                    void *ctx) {
+  int ierr;
+  Ceed root;
+  CeedGetThreadRoot(ceed, &root);
+
+  // Serial execution
+  if (root->num_threads == 1 || num_tasks < 2 || ceed_thread_is_active) {
+    for (CeedInt i=0; i<num_tasks; i++) {
+      ierr = task(ctx, i, ceed_thread_id); CeedChk(ierr);
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Start worker threads
+  pthread_mutex_lock(&ceed_thread_lock);
+  ierr = root->thread_pool ? CEED_ERROR_SUCCESS : CeedThreadPoolCreate(root);
+  pthread_mutex_unlock(&ceed_thread_lock);
+  CeedChk(ierr);
+  CeedThreadPool pool = root->thread_pool;
+
+  // Post job
+  pthread_mutex_lock(&pool->run_lock);
+  pthread_mutex_lock(&pool->lock);
+  pool->task = task;
+  pool->ctx = ctx;
+  pool->num_tasks = num_tasks;
+  pool->next_task = 0;
+  pool->ierr = CEED_ERROR_SUCCESS;
+  pool->num_busy = pool->num_threads - 1;
+  pool->job++;
+  pthread_cond_broadcast(&pool->work_cond);
+  pthread_mutex_unlock(&pool->lock);
+
+  // Work alongside workers
+  ceed_thread_is_active = true;
+  CeedThreadPoolRunTasks(pool, 0);
+  ceed_thread_is_active = false;
+
+  // Wait for workers
+  pthread_mutex_lock(&pool->lock);
+  while (pool->num_busy)
+    pthread_cond_wait(&pool->done_cond, &pool->lock);
+  ierr = pool->ierr;
+  pthread_mutex_unlock(&pool->lock);
+  pthread_mutex_unlock(&pool->run_lock);
+  return ierr;
+}
+
+/**
+  @brief Get a scratch array from the work arena of a Ceed context
+
+  Each host thread of the Ceed context, see CeedParallelFor(), has its own
+    arena, so work arrays may be used inside tasks. Other user threads
+    calling into the Ceed context get separately allocated arrays. Arrays
+    are aligned to CEED_ALIGN bytes, are not initialized, and must be
+    restored with CeedRestoreWorkArray() in the reverse order they were
+    taken, also on error paths. Memory is kept by the arena and reused by
+    later calls.
+
+  @param ceed        Ceed context
+  @param length      Number of CeedScalar entries
+  @param[out] array  Variable to store work array
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @sa CeedRestoreWorkArray()
+
+  @ref Backend
+**/
+int CeedGetWorkArray(Ceed ceed, size_t length, CeedScalar **array) {
+  int ierr;
+  Ceed root;
+  CeedWorkArena arena;
+  const size_t bytes = ((length*sizeof(CeedScalar) + CEED_ALIGN - 1) /
+                        CEED_ALIGN + !length) * CEED_ALIGN;
+
+  CeedGetThreadRoot(ceed, &root);
+  ierr = CeedGetWorkArena(root, &arena); CeedChk(ierr);
+  // Threads without an arena allocate directly
+  if (!arena) {
+    ierr = CeedMallocArray(bytes, 1, array); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  if (arena->num_arrays == arena->max_arrays) {
+    arena->max_arrays = arena->max_arrays ? 2*arena->max_arrays : 8;
+    ierr = CeedRealloc(arena->max_arrays, &arena->arrays); CeedChk(ierr);
+  }
+  CeedWorkArray *work = &arena->arrays[arena->num_arrays];
+  work->bytes = bytes;
+  work->is_owned = arena->used + bytes > arena->size;
+  if (work->is_owned) {
+    ierr = CeedMallocArray(bytes, 1, &work->array); CeedChk(ierr);
+  } else {
+    work->array = (CeedScalar *)&arena->buffer[arena->used];
+    arena->used += bytes;
+  }
+  arena->num_arrays++;
+  arena->in_use += bytes;
+  if (arena->in_use > arena->peak) arena->peak = arena->in_use;
+  *array = work->array;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Restore a scratch array taken with CeedGetWorkArray()
+
+  A NULL array is ignored, so cleanup paths may restore arrays that were
+    never taken.
+
+  @param ceed   Ceed context
+  @param array  Work array to restore, set to NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRestoreWorkArray(Ceed ceed, CeedScalar **array) {
+  int ierr;
+  Ceed root;
+  CeedWorkArena arena;
+
+  if (!*array) return CEED_ERROR_SUCCESS;
+  CeedGetThreadRoot(ceed, &root);
+  ierr = CeedGetWorkArena(root, &arena); CeedChk(ierr);
+  if (!arena) {
+    ierr = CeedFree(array); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  if (!arena->num_arrays ||
+      arena->arrays[arena->num_arrays-1].array != *array)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_ACCESS,
+                     "Work arrays must be restored in reverse order of "
+                     "getting them");
+  // LCOV_EXCL_STOP
+  CeedWorkArray *work = &arena->arrays[--arena->num_arrays];
+  if (work->is_owned) {
+    ierr = CeedFree(&work->array); CeedChk(ierr);
+  } else {
+    arena->used -= work->bytes;
+  }
+  arena->in_use -= work->bytes;
+
+  // Grow the buffer to the high water mark, once it is unused
+  if (!arena->num_arrays && arena->peak > arena->size) {
+    ierr = CeedFree(&arena->buffer); CeedChk(ierr);
+    ierr = CeedMallocArray(arena->peak, 1, &arena->buffer); CeedChk(ierr);
+    arena->size = arena->peak;
+  }
+  *array = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check if a request passed to a Ceed interface should be run
+           asynchronously
+
+  A request is run asynchronously when it is neither NULL,
+    @ref CEED_REQUEST_IMMEDIATE, nor @ref CEED_REQUEST_ORDERED, the backend
+    supports asynchronous requests, and the caller is not already running
+    inside a request or a CeedParallelFor() task.
+
+  @param ceed           Ceed context of the object being applied
+  @param request        Request passed by the caller
+  @param[out] is_async  Variable to store asynchronous status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRequestIsAsync(Ceed ceed, CeedRequest *request, bool *is_async) {
+  *is_async = request && request != CEED_REQUEST_IMMEDIATE &&
+              request != CEED_REQUEST_ORDERED && ceed->has_async_requests &&
+              !ceed_thread_is_request && !ceed_thread_is_active;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Run work asynchronously on the background thread of a Ceed context
+
+  Requests of a Ceed context and its delegates run one at a time, in
+    submission order. CeedRequestWait() waits for `run` to complete and then
+    calls `finalize` on the waiting thread, which should release any objects
+    referenced by `ctx` and free it.
+
+  @param ceed           Ceed context
+  @param run            Function to run on the background thread
+  @param finalize       Function to run on the waiting thread, or NULL
+  @param ctx            Context passed to `run` and `finalize`
+  @param[out] request   Address of the variable where the newly created
+                          CeedRequest will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRequestCreate(Ceed ceed, CeedRequestTask run, CeedRequestTask finalize,
+                      void *ctx, CeedRequest *request) {
+  int ierr;
+  Ceed root;
+  CeedGetThreadRoot(ceed, &root);
+
+  // Start background thread
+  pthread_mutex_lock(&ceed_thread_lock);
+  ierr = root->request_queue ? CEED_ERROR_SUCCESS : CeedRequestQueueCreate(root);
+  pthread_mutex_unlock(&ceed_thread_lock);
+  CeedChk(ierr);
+  CeedRequestQueue queue = root->request_queue;
+
+  // Submit request
+  CeedRequest req;
+  ierr = CeedCalloc(1, &req); CeedChk(ierr);
+  req->queue = queue;
+  req->run = run;
+  req->finalize = finalize;
+  req->ctx = ctx;
+  pthread_mutex_lock(&queue->lock);
+  if (queue->tail) queue->tail->next = req;
+  else queue->head = req;
+  queue->tail = req;
+  pthread_cond_signal(&queue->work_cond);
+  pthread_mutex_unlock(&queue->lock);
+  *request = req;
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -762,6 +1633,9 @@ int CeedInit(const char *resource, Ceed *ceed) {
     size_t n;
     const char *prefix = backends[i].prefix;
     for (n=0; prefix[n] && prefix[n] == resource[n+match_help]; n++) {}
+    // A stem that ends inside a path component does not select the backend,
+    //   so "/cpu/self/avx" does not resolve to "/cpu/self/avx512/blocked"
+    if (n == stem_length && prefix[n] && prefix[n] != '/') continue;
     priority = backends[i].priority;
     if (n > match_len || (n == match_len && match_priority > priority)) {
       match_len = n;
@@ -841,6 +1715,8 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorH1),
     CEED_FTABLE_ENTRY(Ceed, BasisCreateH1),
     CEED_FTABLE_ENTRY(Ceed, BasisCreateHdiv),
+    CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorHdiv),
+    CEED_FTABLE_ENTRY(Ceed, BasisCreateH1Collapsed),
     CEED_FTABLE_ENTRY(Ceed, TensorContractCreate),
     CEED_FTABLE_ENTRY(Ceed, QFunctionCreate),
     CEED_FTABLE_ENTRY(Ceed, QFunctionContextCreate),
@@ -857,18 +1733,25 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedVector, RestoreArray),
     CEED_FTABLE_ENTRY(CeedVector, RestoreArrayRead),
     CEED_FTABLE_ENTRY(CeedVector, Norm),
+    CEED_FTABLE_ENTRY(CeedVector, Dot),
+    CEED_FTABLE_ENTRY(CeedVector, MDot),
     CEED_FTABLE_ENTRY(CeedVector, Scale),
     CEED_FTABLE_ENTRY(CeedVector, AXPY),
+    CEED_FTABLE_ENTRY(CeedVector, AXPBY),
+    CEED_FTABLE_ENTRY(CeedVector, LinearCombination),
     CEED_FTABLE_ENTRY(CeedVector, PointwiseMult),
     CEED_FTABLE_ENTRY(CeedVector, Reciprocal),
     CEED_FTABLE_ENTRY(CeedVector, Destroy),
     CEED_FTABLE_ENTRY(CeedElemRestriction, Apply),
     CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyTransposeOverwrite),
     CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, RestoreOffsets),
     CEED_FTABLE_ENTRY(CeedElemRestriction, Destroy),
     CEED_FTABLE_ENTRY(CeedBasis, Apply),
     CEED_FTABLE_ENTRY(CeedBasis, Destroy),
     CEED_FTABLE_ENTRY(CeedTensorContract, Apply),
+    CEED_FTABLE_ENTRY(CeedTensorContract, ApplyEvenOdd),
     CEED_FTABLE_ENTRY(CeedTensorContract, Destroy),
     CEED_FTABLE_ENTRY(CeedQFunction, Apply),
     CEED_FTABLE_ENTRY(CeedQFunction, SetCUDAUserFunction),
@@ -892,10 +1775,13 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleSymbolic),
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssemble),
     CEED_FTABLE_ENTRY(CeedOperator, CreateFDMElementInverse),
+    CEED_FTABLE_ENTRY(CeedOperator, Setup),
     CEED_FTABLE_ENTRY(CeedOperator, Apply),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
+    CEED_FTABLE_ENTRY(CeedOperator, ApplyAddRange),
+    CEED_FTABLE_ENTRY(CeedOperator, ApplyDot),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
     CEED_FTABLE_ENTRY(CeedOperator, Destroy),
     {NULL, 0} // End of lookup table - used in SetBackendFunction loop
@@ -913,6 +1799,20 @@ int CeedInit(const char *resource, Ceed *ceed) {
   (*ceed)->is_debug = !!getenv("CEED_DEBUG") || !!getenv("DEBUG") ||
                       !!getenv("DBG");
 
+  // Record number of host threads from resource or env variable CEED_NUM_THREADS
+  const char *threads_spec = strstr(resource, ":threads=");
+  const char *threads_env = getenv("CEED_NUM_THREADS");
+  (*ceed)->num_threads = threads_spec ? atoi(threads_spec + 9) :
+                         (threads_env ? atoi(threads_env) : 1);
+  if ((*ceed)->num_threads < 1) (*ceed)->num_threads = 1;
+  (*ceed)->work_owner = &ceed_thread_id;
+
+  // Record NUMA aware host threading from resource or env variable CEED_NUMA
+  const char *numa_spec = strstr(resource, ":numa=");
+  const char *numa_env = getenv("CEED_NUMA");
+  (*ceed)->is_numa_aware = numa_spec ? atoi(numa_spec + 6) :
+                           (numa_env ? atoi(numa_env) : 0);
+
   // Backend specific setup
   ierr = backends[match_index].init(&resource[match_help], *ceed); CeedChk(ierr);
 
@@ -1055,6 +1955,9 @@ int CeedDestroy(Ceed *ceed) {
   if ((*ceed)->Destroy) {
     ierr = (*ceed)->Destroy(*ceed); CeedChk(ierr);
   }
+  ierr = CeedRequestQueueDestroy(*ceed); CeedChk(ierr);
+  ierr = CeedThreadPoolDestroy(*ceed); CeedChk(ierr);
+  ierr = CeedWorkArenasDestroy(*ceed); CeedChk(ierr);
 
   ierr = CeedFree(&(*ceed)->f_offsets); CeedChk(ierr);
   ierr = CeedFree(&(*ceed)->resource); CeedChk(ierr);
@@ -0,0 +1,57 @@
+/// @file
+/// Test getting and restoring work arrays of a CEED object
+/// \test Test getting and restoring work arrays of a CEED object
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdint.h>
+
+static int CheckWorkArrays(Ceed ceed, CeedInt length) {
+  CeedScalar *a, *b, *c;
+
+  // Nested arrays, taken larger than the arena on first use
+  CeedGetWorkArray(ceed, length, &a);
+  CeedGetWorkArray(ceed, 3, &b);
+  CeedGetWorkArray(ceed, 2*length, &c);
+  if ((uintptr_t)a % CEED_ALIGN || (uintptr_t)b % CEED_ALIGN ||
+      (uintptr_t)c % CEED_ALIGN)
+    // LCOV_EXCL_START
+    printf("Work array not aligned to %d bytes\n", CEED_ALIGN);
+  // LCOV_EXCL_STOP
+  for (CeedInt i=0; i<length; i++) a[i] = i;
+  for (CeedInt i=0; i<3; i++) b[i] = -1;
+  for (CeedInt i=0; i<2*length; i++) c[i] = 2*i;
+  for (CeedInt i=0; i<length; i++)
+    if (a[i] != i || c[2*i] != 4*i)
+      // LCOV_EXCL_START
+      printf("Work arrays overlap at %d\n", i);
+  // LCOV_EXCL_STOP
+  CeedRestoreWorkArray(ceed, &c);
+  CeedRestoreWorkArray(ceed, &b);
+  CeedRestoreWorkArray(ceed, &a);
+  if (a || b || c)
+    // LCOV_EXCL_START
+    printf("Restored work array not set to NULL\n");
+  // LCOV_EXCL_STOP
+  return 0;
+}
+
+static int WorkArrayTask(void *ctx, CeedInt task, CeedInt thread) {
+  return CheckWorkArrays((Ceed)ctx, 100 + 10*task);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  // Reuse after growing to the high water mark
+  CheckWorkArrays(ceed, 10);
+  CheckWorkArrays(ceed, 1000);
+  CheckWorkArrays(ceed, 1000);
+
+  // Each host thread uses its own arena
+  CeedParallelFor(ceed, 16, WorkArrayTask, ceed);
+
+  CeedDestroy(&ceed);
+  return 0;
+}
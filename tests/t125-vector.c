@@ -0,0 +1,77 @@
+/// @file
+/// Test vector kernels on multiple host threads
+/// \test Test vector kernels on multiple host threads
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <math.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y, w;
+  const CeedInt n = 4*25001;
+  CeedScalar *a, norm;
+  const CeedScalar *b;
+
+  // Backends that support host threads split vector kernels into chunks
+  setenv("CEED_NUM_THREADS", "4", 1);
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorCreate(ceed, n, &y);
+  CeedVectorCreate(ceed, n, &w);
+
+  // Values 1, 2, 3, 4, the sums below are exact in single precision
+  CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &a);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = 1 + i%4;
+  CeedVectorRestoreArray(x, &a);
+
+  // Norms
+  CeedVectorNorm(x, CEED_NORM_1, &norm);
+  if (fabs(norm - 10.*n/4) > 10.*CEED_EPSILON*norm)
+    // LCOV_EXCL_START
+    printf("Error: L1 norm %f != %f\n", norm, 10.*n/4);
+  // LCOV_EXCL_STOP
+  CeedVectorNorm(x, CEED_NORM_2, &norm);
+  if (fabs(norm - sqrt(30.*n/4)) > 10.*CEED_EPSILON*norm)
+    // LCOV_EXCL_START
+    printf("Error: L2 norm %f != %f\n", norm, sqrt(30.*n/4));
+  // LCOV_EXCL_STOP
+  CeedVectorNorm(x, CEED_NORM_MAX, &norm);
+  if (norm != 4.)
+    // LCOV_EXCL_START
+    printf("Error: Max norm %f != 4.0\n", norm);
+  // LCOV_EXCL_STOP
+
+  // y = 1 + 2 (x/2)
+  CeedVectorScale(x, 0.5);
+  CeedVectorSetValue(y, 1.0);
+  CeedVectorAXPY(y, 2.0, x);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(b[i] - (2 + i%4)) > 10.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error: y[%d] %f != %f\n", i, b[i], (CeedScalar)(2 + i%4));
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y, &b);
+
+  // w = 1 / (x/2 .* x/2)
+  CeedVectorPointwiseMult(w, x, x);
+  CeedVectorReciprocal(w);
+  CeedVectorGetArrayRead(w, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++) {
+    const CeedScalar v = 1 + i%4;
+    if (fabs(b[i] - 4./(v*v)) > 10.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error: w[%d] %f != %f\n", i, b[i], 4./(v*v));
+    // LCOV_EXCL_STOP
+  }
+  CeedVectorRestoreArrayRead(w, &b);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&w);
+  CeedDestroy(&ceed);
+  return 0;
+}
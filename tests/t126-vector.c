@@ -0,0 +1,96 @@
+/// @file
+/// Test fused vector reductions and updates on multiple host threads
+/// \test Test fused vector reductions and updates on multiple host threads
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <math.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y, w, z, vecs[3];
+  const CeedInt n = 4*25001;
+  CeedScalar *a, dot, dots[3];
+  const CeedScalar *b;
+  const CeedScalar true_dots[3] = {30.*n/4, 10.*n/4, 20.*n/4};
+
+  // Backends that support host threads split vector kernels into chunks
+  setenv("CEED_NUM_THREADS", "4", 1);
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorCreate(ceed, n, &y);
+  CeedVectorCreate(ceed, n, &w);
+
+  // Values 1, 2, 3, 4, the sums below are exact in single precision
+  CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &a);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = 1 + i%4;
+  CeedVectorRestoreArray(x, &a);
+  CeedVectorSetValue(y, 1.0);
+  CeedVectorSetValue(w, 2.0);
+
+  // Dot product
+  CeedVectorDot(x, y, &dot);
+  if (fabs(dot - 10.*n/4) > 10.*CEED_EPSILON*dot)
+    // LCOV_EXCL_START
+    printf("Error: x.y %f != %f\n", dot, 10.*n/4);
+  // LCOV_EXCL_STOP
+
+  // Multiple dot products
+  vecs[0] = x; vecs[1] = y; vecs[2] = w;
+  CeedVectorMDot(x, 3, vecs, dots);
+  for (CeedInt j=0; j<3; j++)
+    if (fabs(dots[j] - true_dots[j]) > 10.*CEED_EPSILON*dots[j])
+      // LCOV_EXCL_START
+      printf("Error: dots[%d] %f != %f\n", j, dots[j], true_dots[j]);
+  // LCOV_EXCL_STOP
+
+  // y = 2 x + 3 y
+  CeedVectorAXPBY(y, 2.0, 3.0, x);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(b[i] - (2*(1 + i%4) + 3)) > 10.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error: y[%d] %f != %f\n", i, b[i], (CeedScalar)(2*(1 + i%4) + 3));
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y, &b);
+
+  // w = -x + 0.5 y + 2 w, with w also an input
+  {
+    const CeedScalar alpha[3] = {-1.0, 0.5, 2.0};
+
+    vecs[0] = x; vecs[1] = y; vecs[2] = w;
+    CeedVectorLinearCombination(w, 3, alpha, vecs);
+  }
+  CeedVectorGetArrayRead(w, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(b[i] - 5.5) > 10.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error: w[%d] %f != 5.5\n", i, b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(w, &b);
+
+  // z = y - 2 x, with z an output that has no data yet
+  CeedVectorCreate(ceed, n, &z);
+  {
+    const CeedScalar alpha[2] = {1.0, -2.0};
+
+    vecs[0] = y; vecs[1] = x;
+    CeedVectorLinearCombination(z, 2, alpha, vecs);
+  }
+  CeedVectorGetArrayRead(z, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(b[i] - 3.0) > 10.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error: z[%d] %f != 3.0\n", i, b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(z, &b);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&w);
+  CeedVectorDestroy(&z);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,125 @@
+/// @file
+/// Test vectors allocated with NUMA aware first touch on multiple host threads
+/// \test Test vectors allocated with NUMA aware first touch on multiple host threads
+#ifdef __linux__
+#  define _GNU_SOURCE // sched_getaffinity
+#else
+#  define _POSIX_C_SOURCE 200112
+#endif
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define NUM_TASKS 10
+
+typedef struct {
+  CeedInt threads[NUM_TASKS];
+  int cpus[NUM_TASKS];
+} TaskPlacement;
+
+// Record the host thread running each task and, on Linux, its single CPU
+static int RecordPlacement(void *ctx, CeedInt task, CeedInt thread) {
+  TaskPlacement *placement = ctx;
+
+  placement->threads[task] = thread;
+  placement->cpus[task] = -1;
+#ifdef __linux__
+  cpu_set_t cpus;
+  if (!sched_getaffinity(0, sizeof(cpus), &cpus) && CPU_COUNT(&cpus) == 1)
+    for (int c=0; c<CPU_SETSIZE; c++)
+      if (CPU_ISSET(c, &cpus)) placement->cpus[task] = c;
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y;
+  const CeedInt n = 4*25001;
+  CeedScalar *a, norm;
+  const CeedScalar *b;
+
+  // Backends that support host threads bind them and first touch new arrays
+#ifdef __linux__
+  cpu_set_t caller_cpus;
+  sched_getaffinity(0, sizeof(caller_cpus), &caller_cpus);
+#endif
+  setenv("CEED_NUM_THREADS", "4", 1);
+  setenv("CEED_NUMA", "1", 1);
+  CeedInit(argv[1], &ceed);
+
+  // Task placement, each thread runs a fixed contiguous share of the tasks
+  //   and is bound to its own CPU if there are enough
+  TaskPlacement first, second;
+  int num_cpus = 0;
+#ifdef __linux__
+  cpu_set_t cpus;
+  if (!sched_getaffinity(0, sizeof(cpus), &cpus))
+    num_cpus = CPU_COUNT(&cpus);
+#endif
+  CeedParallelFor(ceed, NUM_TASKS, RecordPlacement, &first);
+  CeedParallelFor(ceed, NUM_TASKS, RecordPlacement, &second);
+  for (CeedInt i=0; i<NUM_TASKS; i++) {
+    if (first.threads[i] != second.threads[i] ||
+        first.threads[i] < (i ? first.threads[i-1] : 0))
+      // LCOV_EXCL_START
+      printf("Error: task %d ran on threads %d and %d\n", i, first.threads[i],
+             second.threads[i]);
+    // LCOV_EXCL_STOP
+    if (num_cpus >= 4 && (first.cpus[i] < 0 ||
+                          (i && (first.threads[i] != first.threads[i-1]) ==
+                           (first.cpus[i] == first.cpus[i-1]))))
+      // LCOV_EXCL_START
+      printf("Error: thread %d of task %d bound to CPU %d\n", first.threads[i],
+             i, first.cpus[i]);
+    // LCOV_EXCL_STOP
+  }
+
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorCreate(ceed, n, &y);
+
+  // Copy values into a new array
+  CeedScalar *values = malloc(n*sizeof(values[0]));
+  for (CeedInt i=0; i<n; i++)
+    values[i] = 1 + i%4;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, values);
+  free(values);
+
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (b[i] != 1 + i%4)
+      // LCOV_EXCL_START
+      printf("Error reading array x[%d] = %f\n", i, b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &b);
+
+  // Write into a new array
+  CeedVectorGetArrayWrite(y, CEED_MEM_HOST, &a);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = 2;
+  CeedVectorRestoreArray(y, &a);
+
+  // Vector kernels on the placed arrays
+  CeedVectorAXPY(y, -1.0, x);
+  CeedVectorNorm(y, CEED_NORM_1, &norm);
+  if (fabs(norm - 4.*n/4) > 10.*CEED_EPSILON*norm)
+    // LCOV_EXCL_START
+    printf("Error: |y - x|_1 %f != %f\n", norm, 4.*n/4);
+  // LCOV_EXCL_STOP
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedDestroy(&ceed);
+
+  // The calling thread gets its own affinity mask back
+#ifdef __linux__
+  sched_getaffinity(0, sizeof(cpus), &cpus);
+  if (!CPU_EQUAL(&cpus, &caller_cpus))
+    // LCOV_EXCL_START
+    printf("Error: calling thread affinity not restored\n");
+  // LCOV_EXCL_STOP
+#endif
+  return 0;
+}
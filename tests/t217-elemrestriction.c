@@ -0,0 +1,65 @@
+/// @file
+/// Test coloring of element blocks of a blocked element restriction
+/// \test Test coloring of element blocks of a blocked element restriction
+#include <ceed.h>
+#include <ceed/backend.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedInt num_elem = 20;
+  CeedInt elem_size = 2;
+  CeedInt blk_size = 4;
+  CeedInt num_blk = num_elem / blk_size;
+  CeedInt ind[elem_size*num_elem];
+  CeedInt num_colors, blk_count[num_blk], node_color[num_elem + 1],
+          node_blk[num_elem + 1];
+  const CeedInt *color_offsets, *blocks;
+  CeedElemRestriction r;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<num_elem; i++) {
+    ind[2*i+0] = i;
+    ind[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, 1, 1,
+                                   num_elem+1, CEED_MEM_HOST, CEED_USE_POINTER,
+                                   ind, &r);
+
+  CeedElemRestrictionGetColoring(r, &num_colors, &color_offsets, &blocks);
+  if (num_colors != 2)
+    // LCOV_EXCL_START
+    printf("Error in number of colors: %d != 2\n", num_colors);
+  // LCOV_EXCL_STOP
+
+  // Check each block has one color and blocks of one color share no nodes
+  for (CeedInt b=0; b<num_blk; b++)
+    blk_count[b] = 0;
+  for (CeedInt n=0; n<num_elem+1; n++)
+    node_color[n] = -1;
+  for (CeedInt c=0; c<num_colors; c++)
+    for (CeedInt i=color_offsets[c]; i<color_offsets[c+1]; i++) {
+      CeedInt b = blocks[i];
+      blk_count[b]++;
+      for (CeedInt e=b*blk_size; e<(b+1)*blk_size; e++)
+        for (CeedInt k=0; k<elem_size; k++) {
+          CeedInt n = ind[e*elem_size + k];
+          if (node_color[n] == c && node_blk[n] != b)
+            // LCOV_EXCL_START
+            printf("Error in coloring: node %d shared by blocks of color %d\n",
+                   n, c);
+          // LCOV_EXCL_STOP
+          node_color[n] = c;
+          node_blk[n] = b;
+        }
+    }
+  for (CeedInt b=0; b<num_blk; b++)
+    if (blk_count[b] != 1)
+      // LCOV_EXCL_START
+      printf("Error in coloring: block %d colored %d times\n", b, blk_count[b]);
+  // LCOV_EXCL_STOP
+
+  CeedElemRestrictionDestroy(&r);
+  CeedDestroy(&ceed);
+  return 0;
+}
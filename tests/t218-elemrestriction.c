@@ -0,0 +1,56 @@
+/// @file
+/// Test element restriction and transpose applied with asynchronous requests
+/// \test Test element restriction and transpose applied with asynchronous requests
+#include <ceed.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y, z;
+  CeedInt num_elem = 3;
+  CeedInt ind[2*num_elem];
+  CeedScalar a[num_elem+1];
+  const CeedScalar *zz;
+  CeedElemRestriction r;
+  CeedRequest request_restrict = NULL, request_transpose = NULL;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_elem+1, &x);
+  for (CeedInt i=0; i<num_elem+1; i++)
+    a[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, a);
+
+  for (CeedInt i=0; i<num_elem; i++) {
+    ind[2*i+0] = i;
+    ind[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_elem+1, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind, &r);
+  CeedVectorCreate(ceed, num_elem*2, &y);
+  CeedVectorCreate(ceed, num_elem+1, &z);
+  CeedVectorSetValue(z, 0.0);
+
+  // Requests complete in the order they are submitted
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, x, y, &request_restrict);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, y, z, &request_transpose);
+  CeedRequestWait(&request_transpose);
+  CeedRequestWait(&request_restrict);
+
+  CeedVectorGetArrayRead(z, CEED_MEM_HOST, &zz);
+  for (CeedInt i=0; i<num_elem+1; i++) {
+    CeedInt mult = (i == 0 || i == num_elem) ? 1 : 2;
+    if (mult*(10+i) != zz[i])
+      // LCOV_EXCL_START
+      printf("Error in restricted array z[%d] = %f != %f\n",
+             i, (CeedScalar)zz[i], (CeedScalar)mult*(10+i));
+    // LCOV_EXCL_STOP
+  }
+  CeedVectorRestoreArrayRead(z, &zz);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&z);
+  CeedElemRestrictionDestroy(&r);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,133 @@
+/// @file
+/// Test element restrictions of a structured periodic mesh
+/// \test Test element restrictions of a structured periodic mesh
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+
+/* The offsets of a structured mesh are a base per element plus a few shared
+     patterns, the elements wrapping around the periodic direction have their
+     own pattern; backends may store them compressed */
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt nx = 5, ny = 3, num_elem = nx*ny, elem_size = 9, num_comp = 3,
+                num_nodes = 2*nx*(2*ny+1), blk_size = 8,
+                num_blk = (num_elem + blk_size - 1) / blk_size;
+  CeedInt ind[num_elem*elem_size];
+  CeedScalar u[num_comp*num_nodes], v_true[num_comp*num_nodes];
+  const CeedScalar *v;
+  const CeedInt *offsets;
+  CeedVector U, V, E;
+  CeedElemRestriction r, r_blk, r_strided;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt ey=0; ey<ny; ey++)
+    for (CeedInt ex=0; ex<nx; ex++)
+      for (CeedInt b=0; b<3; b++)
+        for (CeedInt a=0; a<3; a++)
+          ind[(ey*nx + ex)*elem_size + b*3 + a] = (2*ex + a)%(2*nx) +
+                                                  2*nx*(2*ey + b);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++) {
+    u[i] = 10 + i;
+    v_true[i] = 0.;
+  }
+  for (CeedInt k=0; k<num_comp; k++)
+    for (CeedInt i=0; i<num_elem*elem_size; i++)
+      v_true[ind[i] + k*num_nodes] += u[ind[i] + k*num_nodes];
+  CeedVectorCreate(ceed, num_comp*num_nodes, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+  CeedVectorCreate(ceed, num_comp*num_nodes, &V);
+
+  // Standard restriction
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes,
+                            num_comp*num_nodes, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, ind, &r);
+  CeedElemRestrictionCreateVector(r, NULL, &E);
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, U, E, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(E, CEED_MEM_HOST, &v);
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt k=0; k<num_comp; k++)
+      for (CeedInt i=0; i<elem_size; i++)
+        if (v[(e*num_comp + k)*elem_size + i] !=
+            u[ind[e*elem_size + i] + k*num_nodes])
+          // LCOV_EXCL_START
+          printf("Error in restricted array e[%d][%d][%d] = %f\n", e, k, i,
+                 (double)v[(e*num_comp + k)*elem_size + i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(E, &v);
+
+  CeedVectorSetValue(V, 0.0);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, E, V, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++)
+    if (fabs(v[i] - v_true[i]) > 1E-12)
+      // LCOV_EXCL_START
+      printf("Error in transpose v[%d] = %f != %f\n", i, v[i], v_true[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+  CeedVectorDestroy(&E);
+
+  CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
+  for (CeedInt i=0; i<num_elem*elem_size; i++)
+    if (offsets[i] != ind[i])
+      // LCOV_EXCL_START
+      printf("Error in offsets[%d] = %d != %d\n", i, offsets[i], ind[i]);
+  // LCOV_EXCL_STOP
+  CeedElemRestrictionRestoreOffsets(r, &offsets);
+
+  // Blocked restriction, with padding elements in the last block
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size,
+                                   num_comp, num_nodes, num_comp*num_nodes,
+                                   CEED_MEM_HOST, CEED_COPY_VALUES, ind, &r_blk);
+  CeedVectorCreate(ceed, blk_size*num_comp*elem_size, &E);
+  CeedVectorSetValue(V, 0.0);
+  for (CeedInt b=0; b<num_blk; b++) {
+    CeedElemRestrictionApplyBlock(r_blk, b, CEED_NOTRANSPOSE, U, E,
+                                  CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(E, CEED_MEM_HOST, &v);
+    for (CeedInt j=0; j<blk_size; j++) {
+      const CeedInt e = CeedIntMin(b*blk_size + j, num_elem-1);
+      for (CeedInt k=0; k<num_comp; k++)
+        for (CeedInt i=0; i<elem_size; i++)
+          if (v[(k*elem_size + i)*blk_size + j] !=
+              u[ind[e*elem_size + i] + k*num_nodes])
+            // LCOV_EXCL_START
+            printf("Error in blocked array e[%d][%d][%d] = %f\n", e, k, i,
+                   (double)v[(k*elem_size + i)*blk_size + j]);
+      // LCOV_EXCL_STOP
+    }
+    CeedVectorRestoreArrayRead(E, &v);
+    CeedElemRestrictionApplyBlock(r_blk, b, CEED_TRANSPOSE, E, V,
+                                  CEED_REQUEST_IMMEDIATE);
+  }
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++)
+    if (fabs(v[i] - v_true[i]) > 1E-12)
+      // LCOV_EXCL_START
+      printf("Error in blocked transpose v[%d] = %f != %f\n", i, v[i],
+             v_true[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+
+  // Strided restrictions have no offsets
+  CeedElemRestrictionCreateStrided(ceed, num_elem, elem_size, num_comp,
+                                   num_elem*elem_size*num_comp,
+                                   CEED_STRIDES_BACKEND, &r_strided);
+  CeedElemRestrictionGetOffsets(r_strided, CEED_MEM_HOST, &offsets);
+  if (offsets)
+    // LCOV_EXCL_START
+    printf("Strided restriction has offsets\n");
+  // LCOV_EXCL_STOP
+  CeedElemRestrictionRestoreOffsets(r_strided, &offsets);
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&E);
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&r_blk);
+  CeedElemRestrictionDestroy(&r_strided);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,75 @@
+/// @file
+/// Test sharing of blocked copies of an element restriction
+/// \test Test sharing of blocked copies of an element restriction
+#include <ceed.h>
+#include <ceed/backend.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt num_elem = 11, blk_size = 4, num_blk = 3;
+  CeedInt ind[2*num_elem];
+  CeedScalar u[num_elem+1];
+  const CeedScalar *v;
+  CeedVector U, E;
+  CeedElemRestriction r, r_blk_a, r_blk_b, r_blk_c, r_same;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<num_elem; i++) {
+    ind[2*i+0] = i;
+    ind[2*i+1] = i+1;
+  }
+  for (CeedInt i=0; i<num_elem+1; i++)
+    u[i] = 10 + i;
+  CeedVectorCreate(ceed, num_elem+1, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_elem+1, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind, &r);
+
+  // Blocked copies are shared by block size
+  CeedElemRestrictionGetBlocked(r, blk_size, &r_blk_a);
+  CeedElemRestrictionGetBlocked(r, blk_size, &r_blk_b);
+  CeedElemRestrictionGetBlocked(r, 2*blk_size, &r_blk_c);
+  CeedElemRestrictionGetBlocked(r, 1, &r_same);
+  if (r_blk_a != r_blk_b)
+    // LCOV_EXCL_START
+    printf("Blocked restrictions of the same block size are not shared\n");
+  // LCOV_EXCL_STOP
+  if (r_blk_a == r_blk_c)
+    // LCOV_EXCL_START
+    printf("Blocked restrictions of different block sizes are shared\n");
+  // LCOV_EXCL_STOP
+  if (r_same != r)
+    // LCOV_EXCL_START
+    printf("Restriction with the requested block size is not reused\n");
+  // LCOV_EXCL_STOP
+
+  // The cached copies outlive the original restriction
+  CeedElemRestrictionDestroy(&r_same);
+  CeedElemRestrictionDestroy(&r_blk_b);
+  CeedElemRestrictionDestroy(&r_blk_c);
+  CeedElemRestrictionDestroy(&r);
+
+  CeedVectorCreate(ceed, 2*blk_size, &E);
+  for (CeedInt b=0; b<num_blk; b++) {
+    CeedElemRestrictionApplyBlock(r_blk_a, b, CEED_NOTRANSPOSE, U, E,
+                                  CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(E, CEED_MEM_HOST, &v);
+    for (CeedInt j=0; j<blk_size; j++) {
+      const CeedInt e = CeedIntMin(b*blk_size + j, num_elem-1);
+      for (CeedInt n=0; n<2; n++)
+        if (v[n*blk_size + j] != u[ind[2*e + n]])
+          // LCOV_EXCL_START
+          printf("Error in blocked array e[%d][%d] = %f\n", e, n,
+                 (double)v[n*blk_size + j]);
+      // LCOV_EXCL_STOP
+    }
+    CeedVectorRestoreArrayRead(E, &v);
+  }
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&E);
+  CeedElemRestrictionDestroy(&r_blk_a);
+  CeedDestroy(&ceed);
+  return 0;
+}
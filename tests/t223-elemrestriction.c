@@ -0,0 +1,146 @@
+/// @file
+/// Test element restrictions of an unstructured mesh with several components
+/// \test Test element restrictions of an unstructured mesh with several components
+#include <ceed.h>
+#include <math.h>
+
+/* The nodes of a 2D Q2 mesh are randomly renumbered so that the offsets have no
+     structure left to compress and backends gather through them; vectors of
+     five components are tested with both component layouts */
+
+static int CheckRestriction(Ceed ceed, const CeedInt *ind, CeedInt num_elem,
+                            CeedInt elem_size, CeedInt num_nodes,
+                            CeedInt num_comp, bool interlaced) {
+  const CeedInt comp_stride = interlaced ? 1 : num_nodes,
+                node_stride = interlaced ? num_comp : 1,
+                l_size = num_comp*num_nodes, blk_size = 8,
+                num_blk = (num_elem + blk_size - 1) / blk_size;
+  CeedInt offsets[num_elem*elem_size];
+  CeedScalar u[l_size], v_true[l_size];
+  const CeedScalar *v;
+  CeedVector U, V, E;
+  CeedElemRestriction r, r_blk;
+
+  for (CeedInt i=0; i<num_elem*elem_size; i++)
+    offsets[i] = ind[i]*node_stride;
+  for (CeedInt i=0; i<l_size; i++) {
+    u[i] = sin(1.3*i) + 2.;
+    v_true[i] = 0.;
+  }
+  for (CeedInt k=0; k<num_comp; k++)
+    for (CeedInt i=0; i<num_elem*elem_size; i++)
+      v_true[offsets[i] + k*comp_stride] += u[offsets[i] + k*comp_stride];
+  CeedVectorCreate(ceed, l_size, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+  CeedVectorCreate(ceed, l_size, &V);
+
+  // Standard restriction, transpose accumulating and overwriting
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, comp_stride,
+                            l_size, CEED_MEM_HOST, CEED_COPY_VALUES, offsets,
+                            &r);
+  CeedElemRestrictionCreateVector(r, NULL, &E);
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, U, E, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(E, CEED_MEM_HOST, &v);
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt k=0; k<num_comp; k++)
+      for (CeedInt i=0; i<elem_size; i++)
+        if (v[(e*num_comp + k)*elem_size + i] !=
+            u[offsets[e*elem_size + i] + k*comp_stride])
+          // LCOV_EXCL_START
+          printf("Error in restricted array e[%d][%d][%d] = %f\n", e, k, i,
+                 (double)v[(e*num_comp + k)*elem_size + i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(E, &v);
+
+  for (CeedInt m=0; m<2; m++) {
+    CeedVectorSetValue(V, 1.0);
+    if (m == 0)
+      CeedElemRestrictionApply(r, CEED_TRANSPOSE, E, V, CEED_REQUEST_IMMEDIATE);
+    else
+      CeedElemRestrictionApplyTransposeOverwrite(r, E, V,
+          CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+    for (CeedInt i=0; i<l_size; i++)
+      if (fabs(v[i] - v_true[i] - (m == 0)) > 1E-12)
+        // LCOV_EXCL_START
+        printf("Error in transpose %d v[%d] = %f != %f\n", m, i, v[i],
+               v_true[i] + (m == 0));
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &v);
+  }
+  CeedVectorDestroy(&E);
+
+  // Blocked restriction, with padding elements in the last block
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size,
+                                   num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                   CEED_COPY_VALUES, offsets, &r_blk);
+  CeedVectorCreate(ceed, blk_size*num_comp*elem_size, &E);
+  CeedVectorSetValue(V, 0.0);
+  for (CeedInt b=0; b<num_blk; b++) {
+    CeedElemRestrictionApplyBlock(r_blk, b, CEED_NOTRANSPOSE, U, E,
+                                  CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(E, CEED_MEM_HOST, &v);
+    for (CeedInt j=0; j<blk_size; j++) {
+      const CeedInt e = CeedIntMin(b*blk_size + j, num_elem-1);
+      for (CeedInt k=0; k<num_comp; k++)
+        for (CeedInt i=0; i<elem_size; i++)
+          if (v[(k*elem_size + i)*blk_size + j] !=
+              u[offsets[e*elem_size + i] + k*comp_stride])
+            // LCOV_EXCL_START
+            printf("Error in blocked array e[%d][%d][%d] = %f\n", e, k, i,
+                   (double)v[(k*elem_size + i)*blk_size + j]);
+      // LCOV_EXCL_STOP
+    }
+    CeedVectorRestoreArrayRead(E, &v);
+    CeedElemRestrictionApplyBlock(r_blk, b, CEED_TRANSPOSE, E, V,
+                                  CEED_REQUEST_IMMEDIATE);
+  }
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<l_size; i++)
+    if (fabs(v[i] - v_true[i]) > 1E-12)
+      // LCOV_EXCL_START
+      printf("Error in blocked transpose v[%d] = %f != %f\n", i, v[i],
+             v_true[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&E);
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&r_blk);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt nx = 7, ny = 5, num_elem = nx*ny, elem_size = 9,
+                num_nodes = (2*nx+1)*(2*ny+1);
+  CeedInt ind[num_elem*elem_size], perm[num_nodes];
+
+  CeedInit(argv[1], &ceed);
+
+  // Random renumbering of the nodes
+  for (CeedInt i=0; i<num_nodes; i++)
+    perm[i] = i;
+  for (CeedInt i=num_nodes-1, seed=17; i>0; i--) {
+    seed = (1103515245u*seed + 12345u) & 0x7fffffff;
+    const CeedInt j = seed % (i+1), p = perm[i];
+    perm[i] = perm[j];
+    perm[j] = p;
+  }
+  for (CeedInt ey=0; ey<ny; ey++)
+    for (CeedInt ex=0; ex<nx; ex++)
+      for (CeedInt b=0; b<3; b++)
+        for (CeedInt a=0; a<3; a++)
+          ind[(ey*nx + ex)*elem_size + b*3 + a] =
+            perm[(2*ey + b)*(2*nx+1) + 2*ex + a];
+
+  for (CeedInt num_comp=1; num_comp<=5; num_comp+=4) {
+    CheckRestriction(ceed, ind, num_elem, elem_size, num_nodes, num_comp, false);
+    CheckRestriction(ceed, ind, num_elem, elem_size, num_nodes, num_comp, true);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
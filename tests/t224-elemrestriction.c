@@ -0,0 +1,95 @@
+/// @file
+/// Test first transpose of an element restriction on concurrent threads
+/// \test Test first transpose of an element restriction on concurrent threads
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <math.h>
+#include <stdlib.h>
+
+/* Backends may build the data for the transpose on its first use; here the
+     first transposes run at once on the request thread and the main thread,
+     with offsets of a structured mesh that backends may store compressed */
+
+static void CheckTranspose(CeedVector V, const CeedScalar *v_true,
+                           CeedInt size, const char *name) {
+  const CeedScalar *v;
+
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<size; i++)
+    if (fabs(v[i] - v_true[i]) > 1E-12)
+      // LCOV_EXCL_START
+      printf("Error in %s transpose v[%d] = %f != %f\n", name, i, v[i],
+             v_true[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt nx = 6, ny = 4, num_elem = nx*ny, elem_size = 9, num_comp = 2,
+                num_nodes = (2*nx+1)*(2*ny+1);
+  CeedInt ind[num_elem*elem_size];
+  CeedScalar u[num_comp*num_nodes], v_true[num_comp*num_nodes];
+  CeedVector U, V_request, V_immediate, E_request, E_immediate;
+  CeedElemRestriction r;
+  CeedRequest request = NULL;
+
+  // Backends that support host threads split the transpose into chunks
+  setenv("CEED_NUM_THREADS", "2", 1);
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt ey=0; ey<ny; ey++)
+    for (CeedInt ex=0; ex<nx; ex++)
+      for (CeedInt b=0; b<3; b++)
+        for (CeedInt a=0; a<3; a++)
+          ind[(ey*nx + ex)*elem_size + b*3 + a] = 2*ex + a +
+                                                  (2*nx+1)*(2*ey + b);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++) {
+    u[i] = 10 + i;
+    v_true[i] = 0.;
+  }
+  for (CeedInt k=0; k<num_comp; k++)
+    for (CeedInt i=0; i<num_elem*elem_size; i++)
+      v_true[ind[i] + k*num_nodes] += u[ind[i] + k*num_nodes];
+  CeedVectorCreate(ceed, num_comp*num_nodes, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+  CeedVectorCreate(ceed, num_comp*num_nodes, &V_request);
+  CeedVectorCreate(ceed, num_comp*num_nodes, &V_immediate);
+  CeedVectorSetValue(V_request, 0.0);
+  CeedVectorSetValue(V_immediate, 0.0);
+
+  // The restriction keeps its own copy of the offsets
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes,
+                            num_comp*num_nodes, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, ind, &r);
+  CeedElemRestrictionCreateVector(r, NULL, &E_request);
+  CeedElemRestrictionCreateVector(r, NULL, &E_immediate);
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, U, E_request,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, U, E_immediate,
+                           CEED_REQUEST_IMMEDIATE);
+
+  // First transposes
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, E_request, V_request, &request);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, E_immediate, V_immediate,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedRequestWait(&request);
+  CheckTranspose(V_request, v_true, num_comp*num_nodes, "request");
+  CheckTranspose(V_immediate, v_true, num_comp*num_nodes, "immediate");
+
+  // Later transposes reuse the data of the first
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, E_immediate, V_immediate,
+                           CEED_REQUEST_IMMEDIATE);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++)
+    v_true[i] *= 2;
+  CheckTranspose(V_immediate, v_true, num_comp*num_nodes, "second");
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V_request);
+  CeedVectorDestroy(&V_immediate);
+  CeedVectorDestroy(&E_request);
+  CeedVectorDestroy(&E_immediate);
+  CeedElemRestrictionDestroy(&r);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,86 @@
+/// @file
+/// Test single element interpolation and gradient against element blocks
+/// \test Test single element interpolation and gradient against element blocks
+#include <ceed.h>
+#include <math.h>
+
+/* Single elements may be applied with fixed size kernels, blocks of two
+     elements with identical values use the tensor contraction */
+
+static int CheckApply(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P,
+                      CeedInt Q, CeedQuadMode quad_mode) {
+  CeedBasis basis;
+  CeedVector U_1, V_1, U_2, V_2;
+  CeedInt num_nodes = CeedIntPow(P, dim), num_qpts = CeedIntPow(Q, dim);
+  CeedEvalMode eval_modes[2] = {CEED_EVAL_INTERP, CEED_EVAL_GRAD};
+
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, P, Q, quad_mode,
+                                  &basis);
+
+  for (CeedInt m=0; m<2; m++) {
+    CeedInt q_comp = eval_modes[m] == CEED_EVAL_GRAD ? dim : 1;
+    CeedInt len_nodes = num_comp*num_nodes, len_qpts = q_comp*num_comp*num_qpts;
+
+    for (CeedInt t=0; t<2; t++) {
+      CeedTransposeMode t_mode = t ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+      CeedInt len_u = t ? len_qpts : len_nodes, len_v = t ? len_nodes : len_qpts;
+      CeedScalar u_1[len_u], u_2[2*len_u];
+      const CeedScalar *v_1, *v_2;
+
+      for (CeedInt i=0; i<len_u; i++) {
+        u_1[i] = sin(0.7*i + 0.3*dim + P) + 0.1*Q;
+        u_2[2*i+0] = u_1[i];
+        u_2[2*i+1] = u_1[i];
+      }
+      CeedVectorCreate(ceed, len_u, &U_1);
+      CeedVectorSetArray(U_1, CEED_MEM_HOST, CEED_COPY_VALUES, u_1);
+      CeedVectorCreate(ceed, 2*len_u, &U_2);
+      CeedVectorSetArray(U_2, CEED_MEM_HOST, CEED_COPY_VALUES, u_2);
+      CeedVectorCreate(ceed, len_v, &V_1);
+      CeedVectorSetValue(V_1, 1000.0);
+      CeedVectorCreate(ceed, 2*len_v, &V_2);
+
+      CeedBasisApply(basis, 1, t_mode, eval_modes[m], U_1, V_1);
+      CeedBasisApply(basis, 2, t_mode, eval_modes[m], U_2, V_2);
+
+      CeedVectorGetArrayRead(V_1, CEED_MEM_HOST, &v_1);
+      CeedVectorGetArrayRead(V_2, CEED_MEM_HOST, &v_2);
+      for (CeedInt i=0; i<len_v; i++)
+        for (CeedInt e=0; e<2; e++)
+          if (fabs(v_1[i] - v_2[2*i+e]) > 1E3*CEED_EPSILON*fmax(1., fabs(v_1[i])))
+            // LCOV_EXCL_START
+            printf("dim %d P %d Q %d eval mode %d transpose %d: v[%d] %f != %f\n",
+                   dim, P, Q, eval_modes[m], t, i, v_1[i], v_2[2*i+e]);
+      // LCOV_EXCL_STOP
+      CeedVectorRestoreArrayRead(V_1, &v_1);
+      CeedVectorRestoreArrayRead(V_2, &v_2);
+
+      CeedVectorDestroy(&U_1);
+      CeedVectorDestroy(&V_1);
+      CeedVectorDestroy(&U_2);
+      CeedVectorDestroy(&V_2);
+    }
+  }
+  CeedBasisDestroy(&basis);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim=1; dim<=3; dim++) {
+    // Underintegrated, collocated, and overintegrated
+    CheckApply(ceed, dim, 1, 4, 3, CEED_GAUSS);
+    CheckApply(ceed, dim, 2, 4, 4, CEED_GAUSS_LOBATTO);
+    CheckApply(ceed, dim, 1, 2, 3, CEED_GAUSS);
+    CheckApply(ceed, dim, 3, 3, 5, CEED_GAUSS);
+    CheckApply(ceed, dim, 1, 8, 8, CEED_GAUSS);
+    // No fixed size kernel
+    CheckApply(ceed, dim, 2, 5, 9, CEED_GAUSS);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,95 @@
+/// @file
+/// Test interpolation and gradient of symmetric bases against unsymmetric bases
+/// \test Test interpolation and gradient of symmetric bases against unsymmetric bases
+#include <ceed.h>
+#include <math.h>
+#include <string.h>
+
+/* Lagrange bases on GLL nodes are symmetric and may use even-odd tensor
+     contractions, a small perturbation of the 1D matrices breaks the symmetry */
+
+static int CheckApply(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P,
+                      CeedInt Q, CeedQuadMode quad_mode) {
+  CeedBasis basis_sym, basis_unsym;
+  CeedVector U, V_sym, V_unsym;
+  const CeedInt num_elem = 3, num_nodes = CeedIntPow(P, dim),
+                num_qpts = CeedIntPow(Q, dim);
+  const CeedScalar *interp_1d, *grad_1d, *q_ref_1d, *q_weight_1d;
+  const CeedScalar eps = 1E-10;
+  CeedScalar interp_unsym[P*Q], grad_unsym[P*Q];
+  CeedEvalMode eval_modes[2] = {CEED_EVAL_INTERP, CEED_EVAL_GRAD};
+
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, P, Q, quad_mode,
+                                  &basis_sym);
+  CeedBasisGetInterp1D(basis_sym, &interp_1d);
+  CeedBasisGetGrad1D(basis_sym, &grad_1d);
+  CeedBasisGetQRef(basis_sym, &q_ref_1d);
+  CeedBasisGetQWeights(basis_sym, &q_weight_1d);
+  memcpy(interp_unsym, interp_1d, P*Q*sizeof(interp_1d[0]));
+  memcpy(grad_unsym, grad_1d, P*Q*sizeof(grad_1d[0]));
+  interp_unsym[0] += eps;
+  grad_unsym[0] += eps;
+  CeedBasisCreateTensorH1(ceed, dim, num_comp, P, Q, interp_unsym, grad_unsym,
+                          q_ref_1d, q_weight_1d, &basis_unsym);
+
+  for (CeedInt m=0; m<2; m++) {
+    CeedInt q_comp = eval_modes[m] == CEED_EVAL_GRAD ? dim : 1;
+    CeedInt len_nodes = num_elem*num_comp*num_nodes,
+            len_qpts = num_elem*q_comp*num_comp*num_qpts;
+
+    for (CeedInt t=0; t<2; t++) {
+      CeedTransposeMode t_mode = t ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+      CeedInt len_u = t ? len_qpts : len_nodes, len_v = t ? len_nodes : len_qpts;
+      CeedScalar u[len_u];
+      const CeedScalar *v_sym, *v_unsym;
+
+      for (CeedInt i=0; i<len_u; i++)
+        u[i] = sin(0.7*i + 0.3*dim + P) + 0.1*Q;
+      CeedVectorCreate(ceed, len_u, &U);
+      CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+      CeedVectorCreate(ceed, len_v, &V_sym);
+      CeedVectorCreate(ceed, len_v, &V_unsym);
+
+      CeedBasisApply(basis_sym, num_elem, t_mode, eval_modes[m], U, V_sym);
+      CeedBasisApply(basis_unsym, num_elem, t_mode, eval_modes[m], U, V_unsym);
+
+      CeedVectorGetArrayRead(V_sym, CEED_MEM_HOST, &v_sym);
+      CeedVectorGetArrayRead(V_unsym, CEED_MEM_HOST, &v_unsym);
+      for (CeedInt i=0; i<len_v; i++)
+        if (fabs(v_sym[i] - v_unsym[i]) > 1E5*eps*fmax(1., fabs(v_sym[i])))
+          // LCOV_EXCL_START
+          printf("dim %d P %d Q %d eval mode %d transpose %d: v[%d] %f != %f\n",
+                 dim, P, Q, eval_modes[m], t, i, v_sym[i], v_unsym[i]);
+      // LCOV_EXCL_STOP
+      CeedVectorRestoreArrayRead(V_sym, &v_sym);
+      CeedVectorRestoreArrayRead(V_unsym, &v_unsym);
+
+      CeedVectorDestroy(&U);
+      CeedVectorDestroy(&V_sym);
+      CeedVectorDestroy(&V_unsym);
+    }
+  }
+  CeedBasisDestroy(&basis_sym);
+  CeedBasisDestroy(&basis_unsym);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim=1; dim<=3; dim++) {
+    // Even and odd numbers of nodes and quadrature points
+    CheckApply(ceed, dim, 1, 6, 8, CEED_GAUSS);
+    CheckApply(ceed, dim, 2, 7, 9, CEED_GAUSS);
+    CheckApply(ceed, dim, 1, 7, 8, CEED_GAUSS);
+    CheckApply(ceed, dim, 3, 6, 5, CEED_GAUSS);
+    // Collocated gradient
+    CheckApply(ceed, dim, 1, 7, 7, CEED_GAUSS_LOBATTO);
+    CheckApply(ceed, dim, 2, 6, 6, CEED_GAUSS);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,157 @@
+/// @file
+/// Test interpolation and divergence of tensor-product Raviart-Thomas bases
+/// \test Test interpolation and divergence of tensor-product Raviart-Thomas bases
+#include <ceed.h>
+#include <math.h>
+
+/* The tensor basis applies the 1D matrices by sum factorization, it must match
+     its own dense matrices applied as a non-tensor H(div) basis */
+
+static int CheckApply(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_1d,
+                      CeedInt Q_1d, CeedQuadMode quad_mode) {
+  CeedBasis basis_tensor, basis_dense;
+  CeedVector U, V_tensor, V_dense;
+  const CeedInt num_elem = 3;
+  CeedInt num_nodes, num_qpts;
+  const CeedScalar *interp, *div, *q_ref, *q_weight;
+  CeedEvalMode eval_modes[2] = {CEED_EVAL_INTERP, CEED_EVAL_DIV};
+  CeedElemTopology topos[3] = {CEED_TOPOLOGY_LINE, CEED_TOPOLOGY_QUAD,
+                               CEED_TOPOLOGY_HEX
+                              };
+
+  CeedBasisCreateTensorHdivRaviartThomas(ceed, dim, num_comp, P_1d, Q_1d,
+                                         quad_mode, &basis_tensor);
+  CeedBasisGetNumNodes(basis_tensor, &num_nodes);
+  CeedBasisGetNumQuadraturePoints(basis_tensor, &num_qpts);
+  CeedBasisGetInterp(basis_tensor, &interp);
+  CeedBasisGetDiv(basis_tensor, &div);
+  CeedBasisGetQRef(basis_tensor, &q_ref);
+  CeedBasisGetQWeights(basis_tensor, &q_weight);
+  CeedBasisCreateHdiv(ceed, topos[dim-1], num_comp, num_nodes, num_qpts,
+                      interp, div, q_ref, q_weight, &basis_dense);
+
+  for (CeedInt m=0; m<2; m++) {
+    CeedInt q_comp = eval_modes[m] == CEED_EVAL_INTERP ? dim : 1;
+    CeedInt len_nodes = num_elem*num_comp*num_nodes,
+            len_qpts = num_elem*q_comp*num_comp*num_qpts;
+
+    for (CeedInt t=0; t<2; t++) {
+      CeedTransposeMode t_mode = t ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+      CeedInt len_u = t ? len_qpts : len_nodes, len_v = t ? len_nodes : len_qpts;
+      CeedScalar u[len_u];
+      const CeedScalar *v_tensor, *v_dense;
+
+      for (CeedInt i=0; i<len_u; i++)
+        u[i] = sin(0.7*i + 0.3*dim + P_1d) + 0.1*Q_1d;
+      CeedVectorCreate(ceed, len_u, &U);
+      CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+      CeedVectorCreate(ceed, len_v, &V_tensor);
+      CeedVectorCreate(ceed, len_v, &V_dense);
+
+      CeedBasisApply(basis_tensor, num_elem, t_mode, eval_modes[m], U, V_tensor);
+      CeedBasisApply(basis_dense, num_elem, t_mode, eval_modes[m], U, V_dense);
+
+      CeedVectorGetArrayRead(V_tensor, CEED_MEM_HOST, &v_tensor);
+      CeedVectorGetArrayRead(V_dense, CEED_MEM_HOST, &v_dense);
+      for (CeedInt i=0; i<len_v; i++)
+        if (fabs(v_tensor[i] - v_dense[i]) > 1E-10*fmax(1., fabs(v_dense[i])))
+          // LCOV_EXCL_START
+          printf("dim %d P %d Q %d eval mode %d transpose %d: v[%d] %f != %f\n",
+                 dim, P_1d, Q_1d, eval_modes[m], t, i, v_tensor[i], v_dense[i]);
+      // LCOV_EXCL_STOP
+      CeedVectorRestoreArrayRead(V_tensor, &v_tensor);
+      CeedVectorRestoreArrayRead(V_dense, &v_dense);
+
+      CeedVectorDestroy(&U);
+      CeedVectorDestroy(&V_tensor);
+      CeedVectorDestroy(&V_dense);
+    }
+  }
+  CeedBasisDestroy(&basis_tensor);
+  CeedBasisDestroy(&basis_dense);
+  return 0;
+}
+
+/* The field (x, y, z) is in every RT_k space, its nodal values are the
+     coordinates of the Gauss-Lobatto nodes in the normal direction of each
+     vector component, and its divergence is dim */
+
+static int CheckLinear(Ceed ceed, CeedInt dim, CeedInt P_1d, CeedInt Q_1d) {
+  CeedBasis basis;
+  CeedVector U, V;
+  CeedInt num_nodes, num_qpts;
+  const CeedInt num_block_nodes = P_1d*CeedIntPow(P_1d-1, dim-1);
+  const CeedScalar *q_ref, *v;
+  CeedScalar nodes[P_1d];
+
+  CeedBasisCreateTensorHdivRaviartThomas(ceed, dim, 1, P_1d, Q_1d, CEED_GAUSS,
+                                         &basis);
+  CeedBasisGetNumNodes(basis, &num_nodes);
+  CeedBasisGetNumQuadraturePoints(basis, &num_qpts);
+  CeedBasisGetQRef(basis, &q_ref);
+  CeedLobattoQuadrature(P_1d, nodes, NULL);
+
+  CeedScalar u[num_nodes];
+  for (CeedInt d=0; d<dim; d++)
+    for (CeedInt i=0; i<num_block_nodes; i++) {
+      CeedInt i_d = i;
+      for (CeedInt e=0; e<d; e++)
+        i_d /= P_1d-1;
+      u[d*num_block_nodes + i] = nodes[i_d%P_1d];
+    }
+  CeedVectorCreate(ceed, num_nodes, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+
+  CeedVectorCreate(ceed, dim*num_qpts, &V);
+  CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, V);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<dim*num_qpts; i++)
+    if (fabs(v[i] - q_ref[i]) > 1E-12)
+      // LCOV_EXCL_START
+      printf("dim %d P %d Q %d: interp[%d] %f != %f\n", dim, P_1d, Q_1d, i,
+             v[i], q_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+  CeedVectorDestroy(&V);
+
+  CeedVectorCreate(ceed, num_qpts, &V);
+  CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_DIV, U, V);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<num_qpts; i++)
+    if (fabs(v[i] - dim) > 1E-12)
+      // LCOV_EXCL_START
+      printf("dim %d P %d Q %d: div[%d] %f != %d\n", dim, P_1d, Q_1d, i, v[i],
+             dim);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+  CeedVectorDestroy(&V);
+
+  CeedVectorDestroy(&U);
+  CeedBasisDestroy(&basis);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  // Test skipped if using single precision
+  if (CEED_SCALAR_TYPE == CEED_SCALAR_FP32)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Test not implemented in single precision");
+  // LCOV_EXCL_STOP
+
+  for (CeedInt dim=2; dim<=3; dim++) {
+    // Lowest order and higher order elements
+    CheckApply(ceed, dim, 1, 2, 2, CEED_GAUSS);
+    CheckApply(ceed, dim, 2, 3, 4, CEED_GAUSS);
+    CheckApply(ceed, dim, 1, 4, 4, CEED_GAUSS_LOBATTO);
+    CheckLinear(ceed, dim, 2, 2);
+    CheckLinear(ceed, dim, 4, 5);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
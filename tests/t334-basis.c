@@ -0,0 +1,202 @@
+/// @file
+/// Test interpolation and gradient of collapsed coordinate simplex bases
+/// \test Test interpolation and gradient of collapsed coordinate simplex bases
+#include <ceed.h>
+#include <math.h>
+
+/* The collapsed basis applies its 1D functions by sum factorization, it must
+     match its own dense matrices applied as a non-tensor H^1 basis */
+
+static int CheckApply(Ceed ceed, CeedElemTopology topo, CeedInt num_comp,
+                      CeedInt P_1d, CeedInt Q_1d) {
+  CeedBasis basis_collapsed, basis_dense;
+  CeedVector U, V_collapsed, V_dense;
+  const CeedInt num_elem = 3;
+  CeedInt dim, num_nodes, num_qpts;
+  const CeedScalar *interp, *grad, *q_ref, *q_weight;
+  CeedEvalMode eval_modes[2] = {CEED_EVAL_INTERP, CEED_EVAL_GRAD};
+
+  CeedBasisCreateH1Collapsed(ceed, topo, num_comp, P_1d, Q_1d,
+                             &basis_collapsed);
+  CeedBasisGetDimension(basis_collapsed, &dim);
+  CeedBasisGetNumNodes(basis_collapsed, &num_nodes);
+  CeedBasisGetNumQuadraturePoints(basis_collapsed, &num_qpts);
+  CeedBasisGetInterp(basis_collapsed, &interp);
+  CeedBasisGetGrad(basis_collapsed, &grad);
+  CeedBasisGetQRef(basis_collapsed, &q_ref);
+  CeedBasisGetQWeights(basis_collapsed, &q_weight);
+  CeedBasisCreateH1(ceed, topo, num_comp, num_nodes, num_qpts, interp, grad,
+                    q_ref, q_weight, &basis_dense);
+
+  for (CeedInt m=0; m<2; m++) {
+    CeedInt q_comp = eval_modes[m] == CEED_EVAL_GRAD ? dim : 1;
+    CeedInt len_nodes = num_elem*num_comp*num_nodes,
+            len_qpts = num_elem*q_comp*num_comp*num_qpts;
+
+    for (CeedInt t=0; t<2; t++) {
+      CeedTransposeMode t_mode = t ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+      CeedInt len_u = t ? len_qpts : len_nodes, len_v = t ? len_nodes : len_qpts;
+      CeedScalar u[len_u];
+      const CeedScalar *v_collapsed, *v_dense;
+
+      for (CeedInt i=0; i<len_u; i++)
+        u[i] = sin(0.7*i + 0.3*dim + P_1d) + 0.1*Q_1d;
+      CeedVectorCreate(ceed, len_u, &U);
+      CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+      CeedVectorCreate(ceed, len_v, &V_collapsed);
+      CeedVectorCreate(ceed, len_v, &V_dense);
+
+      CeedBasisApply(basis_collapsed, num_elem, t_mode, eval_modes[m], U,
+                     V_collapsed);
+      CeedBasisApply(basis_dense, num_elem, t_mode, eval_modes[m], U, V_dense);
+
+      CeedVectorGetArrayRead(V_collapsed, CEED_MEM_HOST, &v_collapsed);
+      CeedVectorGetArrayRead(V_dense, CEED_MEM_HOST, &v_dense);
+      for (CeedInt i=0; i<len_v; i++)
+        if (fabs(v_collapsed[i] - v_dense[i]) > 1E-10*fmax(1., fabs(v_dense[i])))
+          // LCOV_EXCL_START
+          printf("dim %d P %d Q %d eval mode %d transpose %d: v[%d] %f != %f\n",
+                 dim, P_1d, Q_1d, eval_modes[m], t, i, v_collapsed[i],
+                 v_dense[i]);
+      // LCOV_EXCL_STOP
+      CeedVectorRestoreArrayRead(V_collapsed, &v_collapsed);
+      CeedVectorRestoreArrayRead(V_dense, &v_dense);
+
+      CeedVectorDestroy(&U);
+      CeedVectorDestroy(&V_collapsed);
+      CeedVectorDestroy(&V_dense);
+    }
+  }
+  CeedBasisDestroy(&basis_collapsed);
+  CeedBasisDestroy(&basis_dense);
+  return 0;
+}
+
+/* The basis spans the polynomials of degree P_1d-1 on the simplex, so the
+     L^2 projection of such a polynomial reproduces its values and gradient at
+     the quadrature points */
+
+static CeedScalar Eval(CeedInt dim, CeedInt p, const CeedScalar *x,
+                       CeedScalar *dx) {
+  const CeedScalar c[3] = {1.0, 0.3, -0.2};
+  CeedScalar s = 0.5;
+  for (CeedInt d=0; d<dim; d++)
+    s += c[d]*x[d];
+  for (CeedInt d=0; d<dim; d++)
+    dx[d] = p*c[d]*pow(s, p-1);
+  dx[0] += p > 1 ? (p-1)*pow(x[0], p-2)*x[dim-1] : 0.;
+  dx[dim-1] += pow(x[0], p-1);
+  return pow(s, p) + pow(x[0], p-1)*x[dim-1];
+}
+
+static int CheckProjection(Ceed ceed, CeedElemTopology topo, CeedInt P_1d) {
+  CeedBasis basis;
+  CeedVector U, V;
+  CeedInt dim, num_nodes, num_qpts;
+  const CeedScalar *interp, *q_ref, *q_weight, *v;
+
+  CeedBasisCreateH1Collapsed(ceed, topo, 1, P_1d, P_1d+1, &basis);
+  CeedBasisGetDimension(basis, &dim);
+  CeedBasisGetNumNodes(basis, &num_nodes);
+  CeedBasisGetNumQuadraturePoints(basis, &num_qpts);
+  CeedBasisGetInterp(basis, &interp);
+  CeedBasisGetQRef(basis, &q_ref);
+  CeedBasisGetQWeights(basis, &q_weight);
+
+  // Values and gradient of the polynomial at the quadrature points
+  const CeedInt p = P_1d-1;
+  CeedScalar f[num_qpts], df[dim*num_qpts], sum_weights = 0.;
+  for (CeedInt q=0; q<num_qpts; q++) {
+    CeedScalar x[3], dx[3];
+    for (CeedInt d=0; d<dim; d++)
+      x[d] = q_ref[d*num_qpts + q];
+    f[q] = Eval(dim, p, x, dx);
+    for (CeedInt d=0; d<dim; d++)
+      df[d*num_qpts + q] = dx[d];
+    sum_weights += q_weight[q];
+  }
+  if (fabs(sum_weights - (dim == 2 ? 2. : 4./3)) > 1E-12)
+    // LCOV_EXCL_START
+    printf("dim %d P %d: sum of weights %f\n", dim, P_1d, sum_weights);
+  // LCOV_EXCL_STOP
+
+  // Normal equations, solved by Gaussian elimination
+  CeedScalar M[num_nodes*num_nodes], u[num_nodes];
+  for (CeedInt i=0; i<num_nodes; i++) {
+    u[i] = 0.;
+    for (CeedInt j=0; j<num_nodes; j++)
+      M[i*num_nodes + j] = 0.;
+    for (CeedInt q=0; q<num_qpts; q++) {
+      u[i] += interp[q*num_nodes + i]*q_weight[q]*f[q];
+      for (CeedInt j=0; j<num_nodes; j++)
+        M[i*num_nodes + j] += interp[q*num_nodes + i]*q_weight[q]*
+                              interp[q*num_nodes + j];
+    }
+  }
+  for (CeedInt k=0; k<num_nodes; k++)
+    for (CeedInt i=k+1; i<num_nodes; i++) {
+      const CeedScalar s = M[i*num_nodes + k] / M[k*num_nodes + k];
+      for (CeedInt j=k; j<num_nodes; j++)
+        M[i*num_nodes + j] -= s*M[k*num_nodes + j];
+      u[i] -= s*u[k];
+    }
+  for (CeedInt i=num_nodes-1; i>=0; i--) {
+    for (CeedInt j=i+1; j<num_nodes; j++)
+      u[i] -= M[i*num_nodes + j]*u[j];
+    u[i] /= M[i*num_nodes + i];
+  }
+  CeedVectorCreate(ceed, num_nodes, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+
+  CeedVectorCreate(ceed, num_qpts, &V);
+  CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, V);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt q=0; q<num_qpts; q++)
+    if (fabs(v[q] - f[q]) > 1E-10)
+      // LCOV_EXCL_START
+      printf("dim %d P %d: interp[%d] %f != %f\n", dim, P_1d, q, v[q], f[q]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+  CeedVectorDestroy(&V);
+
+  CeedVectorCreate(ceed, dim*num_qpts, &V);
+  CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, V);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<dim*num_qpts; i++)
+    if (fabs(v[i] - df[i]) > 1E-9)
+      // LCOV_EXCL_START
+      printf("dim %d P %d: grad[%d] %f != %f\n", dim, P_1d, i, v[i], df[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+  CeedVectorDestroy(&V);
+
+  CeedVectorDestroy(&U);
+  CeedBasisDestroy(&basis);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemTopology topos[2] = {CEED_TOPOLOGY_TRIANGLE, CEED_TOPOLOGY_TET};
+
+  CeedInit(argv[1], &ceed);
+
+  // Test skipped if using single precision
+  if (CEED_SCALAR_TYPE == CEED_SCALAR_FP32)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Test not implemented in single precision");
+  // LCOV_EXCL_STOP
+
+  for (CeedInt t=0; t<2; t++) {
+    // Linear, quadratic, and higher order elements
+    CheckApply(ceed, topos[t], 1, 2, 2);
+    CheckApply(ceed, topos[t], 2, 3, 4);
+    CheckApply(ceed, topos[t], 1, 6, 5);
+    for (CeedInt P_1d=2; P_1d<=5; P_1d++)
+      CheckProjection(ceed, topos[t], P_1d);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,154 @@
+/// @file
+/// Test mass matrix operator applied on multiple host threads
+/// \test Test mass matrix operator applied on multiple host threads
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u, elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector q_data, X, U, V, V_add;
+  const CeedScalar *hv, *hv_add;
+  CeedInt num_elem = 75, P = 5, Q = 8;
+  CeedInt num_nodes_x = num_elem+1, num_nodes_u = num_elem*(P-1)+1;
+  CeedInt ind_x[num_elem*2], ind_u[num_elem*P];
+  CeedScalar x[num_nodes_x], u[num_nodes_u], v_threads[num_nodes_u];
+  CeedScalar sum;
+
+  // Backends that support host threads split the element loop
+  setenv("CEED_NUM_THREADS", "4", 1);
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<num_nodes_x; i++)
+    x[i] = (CeedScalar) i / (num_nodes_x - 1);
+  for (CeedInt i=0; i<num_elem; i++) {
+    ind_x[2*i+0] = i;
+    ind_x[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_x, &elem_restr_x);
+
+  for (CeedInt i=0; i<num_elem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      ind_u[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, P, 1, 1, num_nodes_u, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_u, &elem_restr_u);
+  CeedInt strides_qd[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, Q, 1, Q*num_elem, strides_qd,
+                                   &elem_restr_qd_i);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+
+  CeedVectorCreate(ceed, num_nodes_x, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, num_elem*Q, &q_data);
+
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_mass, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorCreate(ceed, num_nodes_u, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, num_nodes_u, &V);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+  sum = 0.;
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    sum += hv[i];
+  if (fabs(sum-1.)>1000.*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Computed Area: %f != True Area: 1.0\n", sum);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &hv);
+
+  // Apply to a varying input, then add a second apply
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    u[i] = 1. + (i%7)/7. - (i%3)/5.;
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    v_threads[i] = hv[i];
+  CeedVectorRestoreArrayRead(V, &hv);
+  CeedVectorCreate(ceed, num_nodes_u, &V_add);
+  CeedVectorSetValue(V_add, 0.0);
+  CeedOperatorApplyAdd(op_mass, U, V_add, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_mass, U, V_add, CEED_REQUEST_IMMEDIATE);
+
+  // Check against the same applies on a single thread, entry by entry
+  CeedSetNumThreads(ceed, 1);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(V_add, CEED_MEM_HOST, &hv_add);
+  for (CeedInt i=0; i<num_nodes_u; i++) {
+    if (fabs(v_threads[i] - hv[i]) > 100.*CEED_EPSILON*fabs(hv[i]))
+      // LCOV_EXCL_START
+      printf("Threaded v[%d] = %f != %f\n", i, v_threads[i], hv[i]);
+    // LCOV_EXCL_STOP
+    if (fabs(hv_add[i] - 2.*hv[i]) > 100.*CEED_EPSILON*fabs(hv[i]))
+      // LCOV_EXCL_START
+      printf("Threaded v_add[%d] = %f != %f\n", i, hv_add[i], 2.*hv[i]);
+    // LCOV_EXCL_STOP
+  }
+  CeedVectorRestoreArrayRead(V, &hv);
+  CeedVectorRestoreArrayRead(V_add, &hv_add);
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedElemRestrictionDestroy(&elem_restr_x);
+  CeedElemRestrictionDestroy(&elem_restr_qd_i);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&V_add);
+  CeedVectorDestroy(&q_data);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,147 @@
+/// @file
+/// Test that mass matrix operator apply overwrites the output vectors
+/// \test Test that mass matrix operator apply overwrites the output vectors
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+/* The last two L-vector entries are touched by no element, and the outputs
+     hold stale values before each apply */
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u, elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector q_data, q_data_add, X, U, V, V_add;
+  const CeedScalar *hv, *hv_add;
+  CeedInt num_elem = 15, P = 5, Q = 8;
+  CeedInt num_nodes_x = num_elem+1, num_nodes_u = num_elem*(P-1)+1 + 2;
+  CeedInt ind_x[num_elem*2], ind_u[num_elem*P];
+  CeedScalar x[num_nodes_x], u[num_nodes_u];
+
+  for (CeedInt i=0; i<num_nodes_x; i++)
+    x[i] = (CeedScalar) i / (num_nodes_x - 1);
+  for (CeedInt i=0; i<num_elem; i++) {
+    ind_x[2*i+0] = i;
+    ind_x[2*i+1] = i+1;
+    for (CeedInt j=0; j<P; j++)
+      ind_u[P*i+j] = i*(P-1) + j;
+  }
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    u[i] = 1.0 + (CeedScalar) (i % 7) / 7;
+
+  // Serial, then on multiple host threads for backends that support them
+  for (CeedInt t=0; t<2; t++) {
+    if (t == 1) setenv("CEED_NUM_THREADS", "4", 1);
+    CeedInit(argv[1], &ceed);
+
+    // Restrictions
+    CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST,
+                              CEED_USE_POINTER, ind_x, &elem_restr_x);
+    CeedElemRestrictionCreate(ceed, num_elem, P, 1, 1, num_nodes_u, CEED_MEM_HOST,
+                              CEED_USE_POINTER, ind_u, &elem_restr_u);
+    CeedInt strides_qd[3] = {1, Q, Q};
+    CeedElemRestrictionCreateStrided(ceed, num_elem, Q, 1, Q*num_elem, strides_qd,
+                                     &elem_restr_qd_i);
+
+    // Bases
+    CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &basis_x);
+    CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+    // QFunctions
+    CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+    CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+    CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+    CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+    CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+    CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+    CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+    CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+    // Operators
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_setup);
+    CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x,
+                         CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_setup, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                         CEED_VECTOR_ACTIVE);
+
+    CeedVectorCreate(ceed, num_nodes_x, &X);
+    CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+    CeedVectorCreate(ceed, num_elem*Q, &q_data);
+    CeedVectorCreate(ceed, num_elem*Q, &q_data_add);
+
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_mass);
+    CeedOperatorSetField(op_mass, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                         q_data);
+    CeedOperatorSetField(op_mass, "u", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass, "v", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+
+    // Setup, overwriting stale values
+    CeedVectorSetValue(q_data, 1000.0);
+    CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+    CeedVectorSetValue(q_data_add, 0.0);
+    CeedOperatorApplyAdd(op_setup, X, q_data_add, CEED_REQUEST_IMMEDIATE);
+
+    CeedVectorGetArrayRead(q_data, CEED_MEM_HOST, &hv);
+    CeedVectorGetArrayRead(q_data_add, CEED_MEM_HOST, &hv_add);
+    for (CeedInt i=0; i<num_elem*Q; i++)
+      if (fabs(hv[i] - hv_add[i]) > 100.*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("[%d] Setup apply %f != Setup apply add %f\n", i, hv[i], hv_add[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(q_data, &hv);
+    CeedVectorRestoreArrayRead(q_data_add, &hv_add);
+
+    CeedVectorCreate(ceed, num_nodes_u, &U);
+    CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+    CeedVectorCreate(ceed, num_nodes_u, &V);
+    CeedVectorCreate(ceed, num_nodes_u, &V_add);
+
+    // Apply twice over stale values
+    CeedVectorSetValue(V, 1000.0);
+    for (CeedInt k=0; k<2; k++)
+      CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+    CeedVectorSetValue(V_add, 0.0);
+    CeedOperatorApplyAdd(op_mass, U, V_add, CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+    CeedVectorGetArrayRead(V_add, CEED_MEM_HOST, &hv_add);
+    for (CeedInt i=0; i<num_nodes_u; i++)
+      if (fabs(hv[i] - hv_add[i]) > 100.*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("[%d] Apply %f != Apply add %f\n", i, hv[i], hv_add[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &hv);
+    CeedVectorRestoreArrayRead(V_add, &hv_add);
+
+    // Cleanup
+    CeedQFunctionDestroy(&qf_setup);
+    CeedQFunctionDestroy(&qf_mass);
+    CeedOperatorDestroy(&op_setup);
+    CeedOperatorDestroy(&op_mass);
+    CeedElemRestrictionDestroy(&elem_restr_u);
+    CeedElemRestrictionDestroy(&elem_restr_x);
+    CeedElemRestrictionDestroy(&elem_restr_qd_i);
+    CeedBasisDestroy(&basis_u);
+    CeedBasisDestroy(&basis_x);
+    CeedVectorDestroy(&X);
+    CeedVectorDestroy(&U);
+    CeedVectorDestroy(&V);
+    CeedVectorDestroy(&V_add);
+    CeedVectorDestroy(&q_data);
+    CeedVectorDestroy(&q_data_add);
+    CeedDestroy(&ceed);
+  }
+  return 0;
+}
@@ -0,0 +1,179 @@
+/// @file
+/// Test composite mass matrix operator with sub-operators applied on multiple host threads
+/// \test Test composite mass matrix operator with sub-operators applied on multiple host threads
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+/* The line is split into one large interior sub-operator and several small
+     sub-operators; the last two small sub-operators share a QFunction, and an
+     extra sub-operator repeats the second one with the same restrictions */
+
+#define NUM_SUB 6
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x[NUM_SUB], elem_restr_u[NUM_SUB],
+                      elem_restr_qd_i[NUM_SUB];
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_mass[NUM_SUB], qf_shared;
+  CeedOperator op_setup[NUM_SUB], op_mass[NUM_SUB], op_shared, op_composite;
+  CeedVector q_data[NUM_SUB], q_data_shared, X, U, V;
+  const CeedScalar *hv;
+  CeedInt num_elem = 60, P = 5, Q = 8;
+  CeedInt elem_start[NUM_SUB+1] = {0, 40, 44, 48, 52, 56, 60};
+  CeedInt num_nodes_x = num_elem+1, num_nodes_u = num_elem*(P-1)+1;
+  CeedInt ind_x[num_elem*2], ind_u[num_elem*P];
+  CeedScalar x[num_nodes_x];
+  CeedScalar sum, area = 1. + (CeedScalar)(elem_start[2] - elem_start[1]) /
+                           num_elem;
+
+  // Backends that support host threads apply small sub-operators concurrently
+  setenv("CEED_NUM_THREADS", "4", 1);
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<num_nodes_x; i++)
+    x[i] = (CeedScalar) i / (num_nodes_x - 1);
+  for (CeedInt i=0; i<num_elem; i++) {
+    ind_x[2*i+0] = i;
+    ind_x[2*i+1] = i+1;
+    for (CeedInt j=0; j<P; j++)
+      ind_u[P*i+j] = i*(P-1) + j;
+  }
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  for (CeedInt s=0; s<NUM_SUB-1; s++) {
+    CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass[s]);
+    CeedQFunctionAddInput(qf_mass[s], "rho", 1, CEED_EVAL_NONE);
+    CeedQFunctionAddInput(qf_mass[s], "u", 1, CEED_EVAL_INTERP);
+    CeedQFunctionAddOutput(qf_mass[s], "v", 1, CEED_EVAL_INTERP);
+  }
+  qf_mass[NUM_SUB-1] = NULL;
+  CeedQFunctionReferenceCopy(qf_mass[NUM_SUB-2], &qf_mass[NUM_SUB-1]);
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_shared);
+  CeedQFunctionAddInput(qf_shared, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_shared, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_shared, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, num_nodes_x, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Sub-operators
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  for (CeedInt s=0; s<NUM_SUB; s++) {
+    CeedInt num_elem_s = elem_start[s+1] - elem_start[s];
+    CeedInt strides_qd[3] = {1, Q, Q};
+
+    CeedElemRestrictionCreate(ceed, num_elem_s, 2, 1, 1, num_nodes_x,
+                              CEED_MEM_HOST, CEED_USE_POINTER,
+                              &ind_x[2*elem_start[s]], &elem_restr_x[s]);
+    CeedElemRestrictionCreate(ceed, num_elem_s, P, 1, 1, num_nodes_u,
+                              CEED_MEM_HOST, CEED_USE_POINTER,
+                              &ind_u[P*elem_start[s]], &elem_restr_u[s]);
+    CeedElemRestrictionCreateStrided(ceed, num_elem_s, Q, 1, Q*num_elem_s,
+                                     strides_qd, &elem_restr_qd_i[s]);
+    CeedVectorCreate(ceed, Q*num_elem_s, &q_data[s]);
+
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_setup[s]);
+    CeedOperatorSetField(op_setup[s], "weight", CEED_ELEMRESTRICTION_NONE,
+                         basis_x, CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_setup[s], "dx", elem_restr_x[s], basis_x,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_setup[s], "rho", elem_restr_qd_i[s],
+                         CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+    CeedOperatorApply(op_setup[s], X, q_data[s], CEED_REQUEST_IMMEDIATE);
+
+    CeedOperatorCreate(ceed, qf_mass[s], CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_mass[s]);
+    CeedOperatorSetField(op_mass[s], "rho", elem_restr_qd_i[s],
+                         CEED_BASIS_COLLOCATED, q_data[s]);
+    CeedOperatorSetField(op_mass[s], "u", elem_restr_u[s], basis_u,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[s], "v", elem_restr_u[s], basis_u,
+                         CEED_VECTOR_ACTIVE);
+    CeedCompositeOperatorAddSub(op_composite, op_mass[s]);
+  }
+
+  // Sub-operator sharing restrictions, but no vectors, with the second one
+  CeedVectorCreate(ceed, Q*(elem_start[2] - elem_start[1]), &q_data_shared);
+  CeedOperatorApply(op_setup[1], X, q_data_shared, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorCreate(ceed, qf_shared, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_shared);
+  CeedOperatorSetField(op_shared, "rho", elem_restr_qd_i[1],
+                       CEED_BASIS_COLLOCATED, q_data_shared);
+  CeedOperatorSetField(op_shared, "u", elem_restr_u[1], basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_shared, "v", elem_restr_u[1], basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedCompositeOperatorAddSub(op_composite, op_shared);
+
+  CeedVectorCreate(ceed, num_nodes_u, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, num_nodes_u, &V);
+
+  // Apply twice, the second apply may use a different schedule than the first
+  for (CeedInt k=0; k<2; k++) {
+    CeedOperatorApply(op_composite, U, V, CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+    sum = 0.;
+    for (CeedInt i=0; i<num_nodes_u; i++)
+      sum += hv[i];
+    if (fabs(sum-area)>1000.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Computed Area: %f != True Area: %f\n", sum, area);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &hv);
+  }
+
+  // Apply again, adding to the previous result
+  CeedOperatorApplyAdd(op_composite, U, V, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+  sum = 0.;
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    sum += hv[i];
+  if (fabs(sum-2.*area)>1000.*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Computed Area: %f != True Area: %f\n", sum, 2.*area);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &hv);
+
+  // Cleanup
+  for (CeedInt s=0; s<NUM_SUB; s++) {
+    CeedQFunctionDestroy(&qf_mass[s]);
+    CeedOperatorDestroy(&op_setup[s]);
+    CeedOperatorDestroy(&op_mass[s]);
+    CeedElemRestrictionDestroy(&elem_restr_x[s]);
+    CeedElemRestrictionDestroy(&elem_restr_u[s]);
+    CeedElemRestrictionDestroy(&elem_restr_qd_i[s]);
+    CeedVectorDestroy(&q_data[s]);
+  }
+  CeedQFunctionDestroy(&qf_shared);
+  CeedOperatorDestroy(&op_shared);
+  CeedVectorDestroy(&q_data_shared);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedOperatorDestroy(&op_composite);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+  return 0;
+}
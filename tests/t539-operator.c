@@ -0,0 +1,122 @@
+/// @file
+/// Test H(div) mass and divergence operator with a tensor Raviart-Thomas basis
+/// \test Test H(div) mass and divergence operator with a tensor Raviart-Thomas basis
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t539-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_u;
+  CeedBasis basis_u;
+  CeedQFunction qf_mass_div;
+  CeedOperator op_mass_div;
+  CeedVector U, A, V;
+  CeedInt num_elem = 10, P_1d = 3, Q_1d = 4, dim = 2;
+  CeedInt P, Q;
+  const CeedScalar *interp, *div, *q_weight, *v;
+
+  CeedInit(argv[1], &ceed);
+
+  // Test skipped if using single precision
+  if (CEED_SCALAR_TYPE == CEED_SCALAR_FP32)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Test not implemented in single precision");
+  // LCOV_EXCL_STOP
+
+  // Basis
+  CeedBasisCreateTensorHdivRaviartThomas(ceed, dim, 1, P_1d, Q_1d, CEED_GAUSS,
+                                         &basis_u);
+  CeedBasisGetNumNodes(basis_u, &P);
+  CeedBasisGetNumQuadraturePoints(basis_u, &Q);
+
+  // Restriction, each element has its own nodes
+  CeedInt strides_u[3] = {1, P, P};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, P, 1, num_elem*P, strides_u,
+                                   &elem_restr_u);
+
+  // Vectors
+  CeedScalar u[num_elem*P], a[num_elem*P];
+  for (CeedInt i=0; i<num_elem*P; i++) {
+    u[i] = sin(0.3*i);
+    a[i] = cos(0.7*i);
+  }
+  CeedVectorCreate(ceed, num_elem*P, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+  CeedVectorCreate(ceed, num_elem*P, &A);
+  CeedVectorSetArray(A, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+  CeedVectorCreate(ceed, num_elem*P, &V);
+
+  // QFunction
+  CeedQFunctionCreateInterior(ceed, 1, mass_div, mass_div_loc, &qf_mass_div);
+  CeedQFunctionAddInput(qf_mass_div, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_mass_div, "u", dim, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_mass_div, "div u", 1, CEED_EVAL_DIV);
+  CeedQFunctionAddInput(qf_mass_div, "a", dim, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass_div, "v", dim, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass_div, "div v", 1, CEED_EVAL_DIV);
+
+  // Operator
+  CeedOperatorCreate(ceed, qf_mass_div, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_mass_div);
+  CeedOperatorSetField(op_mass_div, "weight", CEED_ELEMRESTRICTION_NONE,
+                       basis_u, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_mass_div, "u", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_div, "div u", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_div, "a", elem_restr_u, basis_u, A);
+  CeedOperatorSetField(op_mass_div, "v", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_div, "div v", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+
+  // Apply
+  CeedOperatorApply(op_mass_div, U, V, CEED_REQUEST_IMMEDIATE);
+
+  // Check output against the dense matrices, B^T W B (u + a) + D^T W D u
+  CeedBasisGetInterp(basis_u, &interp);
+  CeedBasisGetDiv(basis_u, &div);
+  CeedBasisGetQWeights(basis_u, &q_weight);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt e=0; e<num_elem; e++) {
+    const CeedScalar *u_e = &u[e*P], *a_e = &a[e*P];
+    CeedScalar v_e[P];
+    for (CeedInt j=0; j<P; j++)
+      v_e[j] = 0.0;
+    for (CeedInt q=0; q<Q; q++) {
+      CeedScalar div_u = 0.0;
+      for (CeedInt j=0; j<P; j++)
+        div_u += div[q*P+j] * u_e[j];
+      for (CeedInt j=0; j<P; j++)
+        v_e[j] += div[q*P+j] * q_weight[q] * div_u;
+      for (CeedInt d=0; d<dim; d++) {
+        CeedScalar u_q = 0.0;
+        for (CeedInt j=0; j<P; j++)
+          u_q += interp[(d*Q+q)*P+j] * (u_e[j] + a_e[j]);
+        for (CeedInt j=0; j<P; j++)
+          v_e[j] += interp[(d*Q+q)*P+j] * q_weight[q] * u_q;
+      }
+    }
+    for (CeedInt j=0; j<P; j++)
+      if (fabs(v[e*P+j] - v_e[j]) > 1E-12)
+        // LCOV_EXCL_START
+        printf("[%d, %d] Error in operator apply: %f != %f\n", e, j,
+               v[e*P+j], v_e[j]);
+    // LCOV_EXCL_STOP
+  }
+  CeedVectorRestoreArrayRead(V, &v);
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_mass_div);
+  CeedOperatorDestroy(&op_mass_div);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedBasisDestroy(&basis_u);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&A);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,29 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+
+CEED_QFUNCTION(mass_div)(void *ctx, const CeedInt Q,
+                         const CeedScalar *const *in,
+                         CeedScalar *const *out) {
+  const CeedScalar *weight = in[0], *u = in[1], *div_u = in[2], *a = in[3];
+  CeedScalar *v = out[0], *div_v = out[1];
+  for (CeedInt i=0; i<Q; i++) {
+    for (CeedInt d=0; d<2; d++)
+      v[i+Q*d] = weight[i] * (u[i+Q*d] + a[i+Q*d]);
+    div_v[i] = weight[i] * div_u[i];
+  }
+  return 0;
+}